@@ -27,6 +27,21 @@ int deviceCalSweep(
     const double bw,
     const std::string &dir,
     const std::string &chans);
+int deviceRecord(
+    const std::string &argStr,
+    const std::string &path,
+    const double rate,
+    const double freq,
+    const double duration,
+    const std::string &chans,
+    const std::string &format,
+    const bool packed);
+int deviceShare(
+    const std::string &argStr,
+    const std::string &name,
+    const double rate,
+    const double freq,
+    const std::string &chans);
 
 /***********************************************************************
  * print help
@@ -56,6 +71,21 @@ static int printHelp(void)
     std::cout << "    --dir[=direction, default=BOTH]    \t Calibration direction, RX, TX, BOTH" << std::endl;
     std::cout << "    --chans[=channels, default=ALL]    \t Calibration channels, 0, 1, ALL" << std::endl;
     std::cout << std::endl;
+    std::cout << "  Stream recording (SigMF):" << std::endl;
+    std::cout << "    --record=\"filename\"             \t Record RX channels, file name without extension" << std::endl;
+    std::cout << "    --rate[=sampleRate]                \t Sample rate (Hz)" << std::endl;
+    std::cout << "    --freq[=frequency]                 \t RX center frequency (Hz)" << std::endl;
+    std::cout << "    --duration[=seconds, default=0]    \t Recording length, 0 until Ctrl+C" << std::endl;
+    std::cout << "    --format[=format, default=I16]     \t Sample format, I16, I12, I8, F16, F32" << std::endl;
+    std::cout << "    --packed                           \t Store I12 samples packed, 3 bytes per sample" << std::endl;
+    std::cout << "    --chans[=channels, default=ALL]    \t Recorded channels, 0, 1, ALL" << std::endl;
+    std::cout << std::endl;
+    std::cout << "  Stream sharing:" << std::endl;
+    std::cout << "    --share=\"name\"                  \t Publish RX channels to shared memory as name-chN" << std::endl;
+    std::cout << "    --rate[=sampleRate]                \t Sample rate (Hz)" << std::endl;
+    std::cout << "    --freq[=frequency]                 \t RX center frequency (Hz)" << std::endl;
+    std::cout << "    --chans[=channels, default=ALL]    \t Shared channels, 0, 1, ALL" << std::endl;
+    std::cout << std::endl;
     return EXIT_SUCCESS;
 }
 
@@ -321,12 +351,19 @@ int main(int argc, char *argv[])
         {"bw",      required_argument, 0, 'b'},
         {"dir",     required_argument, 0, 'd'},
         {"chans",   required_argument, 0, 'c'},
+        {"record",  required_argument, 0, 'r'},
+        {"rate",    required_argument, 0, 'x'},
+        {"freq",    required_argument, 0, 'q'},
+        {"duration",required_argument, 0, 'n'},
+        {"format",  required_argument, 0, 'o'},
+        {"packed",  no_argument,       0, 'k'},
+        {"share",   required_argument, 0, 'y'},
         {0, 0, 0,  0}
     };
 
-    std::string argStr, dir("BOTH"), chans("ALL");
-    double start(0.0), stop(0.0), step(1e6), bw(30e6);
-    bool testTiming(false), calSweep(false);
+    std::string argStr, dir("BOTH"), chans("ALL"), recordPath, shareName, format("I16");
+    double start(0.0), stop(0.0), step(1e6), bw(30e6), rate(0.0), freq(0.0), duration(0.0);
+    bool testTiming(false), calSweep(false), packed(false);
     int long_index = 0;
     int option = 0;
     while ((option = getopt_long_only(argc, argv, "", long_options, &long_index)) != -1)
@@ -354,11 +391,20 @@ int main(int argc, char *argv[])
         case 'b': if (optarg != NULL) bw = std::stod(optarg); break;
         case 'd': if (optarg != NULL) dir = optarg; break;
         case 'c': if (optarg != NULL) chans = optarg; break;
+        case 'r': if (optarg != NULL) recordPath = optarg; break;
+        case 'x': if (optarg != NULL) rate = std::stod(optarg); break;
+        case 'q': if (optarg != NULL) freq = std::stod(optarg); break;
+        case 'n': if (optarg != NULL) duration = std::stod(optarg); break;
+        case 'o': if (optarg != NULL) format = optarg; break;
+        case 'k': packed = true; break;
+        case 'y': if (optarg != NULL) shareName = optarg; break;
         }
     }
 
     if (testTiming) return deviceTestTiming(argStr);
     if (calSweep) return deviceCalSweep(argStr, start, stop, step, bw, dir, chans);
+    if (not recordPath.empty()) return deviceRecord(argStr, recordPath, rate, freq, duration, chans, format, packed);
+    if (not shareName.empty()) return deviceShare(argStr, shareName, rate, freq, chans);
 
     //unknown or unspecified options, do help...
     return printHelp();
@@ -0,0 +1,162 @@
+/**
+    @file LimeUtilRecord.cpp
+    @author Lime Microsystems
+    @brief Record RX streams to SigMF files
+*/
+
+#include "lime/LimeSuite.h"
+#include <iostream>
+#include <cstdlib>
+#include <csignal>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <thread>
+
+static volatile sig_atomic_t stopRecording = 0;
+
+static void sigIntHandler(const int)
+{
+    stopRecording = 1;
+}
+
+int deviceRecord(
+    const std::string &argStr,
+    const std::string &path,
+    const double rate,
+    const double freq,
+    const double duration,
+    const std::string &chansStr,
+    const std::string &formatStr,
+    const bool packed)
+{
+    //get a list of the channels to record
+    std::vector<size_t> channels;
+    if (chansStr == "0") channels.push_back(0);
+    else if (chansStr == "1") channels.push_back(1);
+    else if (chansStr == "ALL")
+    {
+        channels.push_back(0);
+        channels.push_back(1);
+    }
+    else
+    {
+        std::cerr << "Unknown channels --chans=" << chansStr << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    lms_stream_t stream = {};
+    if (formatStr == "I16") stream.dataFmt = lms_stream_t::LMS_FMT_I16;
+    else if (formatStr == "I12") stream.dataFmt = lms_stream_t::LMS_FMT_I12;
+    else if (formatStr == "I8") stream.dataFmt = lms_stream_t::LMS_FMT_I8;
+    else if (formatStr == "F16") stream.dataFmt = lms_stream_t::LMS_FMT_F16;
+    else if (formatStr == "F32") stream.dataFmt = lms_stream_t::LMS_FMT_F32;
+    else
+    {
+        std::cerr << "Unknown format --format=" << formatStr << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    //open the device
+    lms_device_t *device(nullptr);
+    if (LMS_Open(&device, argStr.empty()?nullptr:argStr.c_str(), nullptr) != 0)
+    {
+        std::cerr << "Failed to open: " << LMS_GetLastErrorMessage() << std::endl;
+        return EXIT_FAILURE;
+    }
+    if (LMS_Init(device) != 0)
+    {
+        std::cerr << "Failed to init: " << LMS_GetLastErrorMessage() << std::endl;
+        LMS_Close(device);
+        return EXIT_FAILURE;
+    }
+
+    for (const auto ch : channels)
+    {
+        if (LMS_EnableChannel(device, LMS_CH_RX, ch, true) != 0 ||
+            (freq > 0 && LMS_SetLOFrequency(device, LMS_CH_RX, ch, freq) != 0))
+        {
+            std::cerr << "Failed to configure channel " << ch << ": " << LMS_GetLastErrorMessage() << std::endl;
+            LMS_Close(device);
+            return EXIT_FAILURE;
+        }
+    }
+    if (rate > 0 && LMS_SetSampleRate(device, rate, 0) != 0)
+    {
+        std::cerr << "Failed to set sample rate: " << LMS_GetLastErrorMessage() << std::endl;
+        LMS_Close(device);
+        return EXIT_FAILURE;
+    }
+
+    //large FIFO absorbs disk latency spikes
+    std::vector<lms_stream_t> streams(channels.size(), stream);
+    for (size_t i = 0; i < channels.size(); ++i)
+    {
+        streams[i].channel = channels[i];
+        streams[i].fifoSize = 1024*1024;
+        streams[i].throughputVsLatency = 1.0;
+        streams[i].isTx = false;
+        if (LMS_SetupStream(device, &streams[i]) != 0)
+        {
+            std::cerr << "Failed to setup stream: " << LMS_GetLastErrorMessage() << std::endl;
+            LMS_Close(device);
+            return EXIT_FAILURE;
+        }
+    }
+    for (auto &s : streams)
+        LMS_StartStream(&s);
+
+    std::cout << "Recording to " << path << ".sigmf-data, press Ctrl+C to stop" << std::endl;
+    int status = LMS_StartRecording(device, streams.data(), streams.size(), path.c_str(), packed);
+    if (status != 0)
+        std::cerr << "Failed to start recording: " << LMS_GetLastErrorMessage() << std::endl;
+
+    stopRecording = 0;
+    signal(SIGINT, sigIntHandler);
+    const auto t0 = std::chrono::steady_clock::now();
+    auto lastReport = t0;
+    while (status == 0 && !stopRecording)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        const auto now = std::chrono::steady_clock::now();
+        if (duration > 0 && std::chrono::duration<double>(now-t0).count() >= duration)
+            break;
+        if (now - lastReport < std::chrono::seconds(1))
+            continue;
+        lastReport = now;
+
+        lms_recording_status_t recStatus;
+        lms_stream_status_t streamStatus;
+        LMS_GetRecordingStatus(device, &recStatus);
+        LMS_GetStreamStatus(&streams[0], &streamStatus);
+        std::cout << "  " << recStatus.bytesWritten/1e6 << " MB written, "
+                  << "FIFO " << 100*streamStatus.fifoFilledCount/streamStatus.fifoSize << "%, "
+                  << "gaps " << recStatus.gaps << ", "
+                  << "writer stalls " << recStatus.writerStalls << std::endl;
+        if (recStatus.error)
+        {
+            std::cerr << "Disk write failed" << std::endl;
+            status = -1;
+        }
+    }
+    signal(SIGINT, SIG_DFL);
+
+    if (LMS_StopRecording(device) != 0)
+    {
+        std::cerr << "Failed to write metadata: " << LMS_GetLastErrorMessage() << std::endl;
+        status = -1;
+    }
+    lms_recording_status_t recStatus;
+    LMS_GetRecordingStatus(device, &recStatus);
+    std::cout << "Recorded " << recStatus.samples << " samples per channel, "
+              << recStatus.droppedSamples << " samples missing in "
+              << recStatus.gaps << " gaps" << std::endl;
+
+    for (auto &s : streams)
+    {
+        LMS_StopStream(&s);
+        LMS_DestroyStream(device, &s);
+    }
+    LMS_Close(device);
+    return (status==0)?EXIT_SUCCESS:EXIT_FAILURE;
+}
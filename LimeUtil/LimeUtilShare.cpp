@@ -0,0 +1,127 @@
+/**
+    @file LimeUtilShare.cpp
+    @author Lime Microsystems
+    @brief Serve RX streams to local processes through shared memory
+*/
+
+#include "lime/LimeSuite.h"
+#include <iostream>
+#include <cstdlib>
+#include <csignal>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <thread>
+
+static volatile sig_atomic_t stopSharing = 0;
+
+static void sigIntHandler(const int)
+{
+    stopSharing = 1;
+}
+
+int deviceShare(
+    const std::string &argStr,
+    const std::string &name,
+    const double rate,
+    const double freq,
+    const std::string &chansStr)
+{
+    std::vector<size_t> channels;
+    if (chansStr == "0") channels.push_back(0);
+    else if (chansStr == "1") channels.push_back(1);
+    else if (chansStr == "ALL")
+    {
+        channels.push_back(0);
+        channels.push_back(1);
+    }
+    else
+    {
+        std::cerr << "Unknown channels --chans=" << chansStr << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    lms_device_t *device(nullptr);
+    if (LMS_Open(&device, argStr.empty()?nullptr:argStr.c_str(), nullptr) != 0)
+    {
+        std::cerr << "Failed to open: " << LMS_GetLastErrorMessage() << std::endl;
+        return EXIT_FAILURE;
+    }
+    if (LMS_Init(device) != 0)
+    {
+        std::cerr << "Failed to init: " << LMS_GetLastErrorMessage() << std::endl;
+        LMS_Close(device);
+        return EXIT_FAILURE;
+    }
+
+    for (const auto ch : channels)
+    {
+        if (LMS_EnableChannel(device, LMS_CH_RX, ch, true) != 0 ||
+            (freq > 0 && LMS_SetLOFrequency(device, LMS_CH_RX, ch, freq) != 0))
+        {
+            std::cerr << "Failed to configure channel " << ch << ": " << LMS_GetLastErrorMessage() << std::endl;
+            LMS_Close(device);
+            return EXIT_FAILURE;
+        }
+    }
+    if (rate > 0 && LMS_SetSampleRate(device, rate, 0) != 0)
+    {
+        std::cerr << "Failed to set sample rate: " << LMS_GetLastErrorMessage() << std::endl;
+        LMS_Close(device);
+        return EXIT_FAILURE;
+    }
+
+    //ring size follows FIFO size, samples are only delivered to shared memory
+    std::vector<lms_stream_t> streams(channels.size());
+    int status = 0;
+    for (size_t i = 0; i < channels.size() && status == 0; ++i)
+    {
+        streams[i].channel = channels[i];
+        streams[i].fifoSize = 1024*1024;
+        streams[i].throughputVsLatency = 0.5;
+        streams[i].isTx = false;
+        streams[i].dataFmt = lms_stream_t::LMS_FMT_I16;
+        const std::string ringName = name + "-ch" + std::to_string(channels[i]);
+        status = LMS_SetupStream(device, &streams[i]);
+        if (status == 0)
+            status = LMS_ShareStream(device, &streams[i], ringName.c_str(), true);
+        if (status != 0)
+            std::cerr << "Failed to share stream: " << LMS_GetLastErrorMessage() << std::endl;
+        else
+            std::cout << "Channel " << channels[i] << " shared as " << ringName << std::endl;
+    }
+    if (status == 0)
+    {
+        for (auto &s : streams)
+            LMS_StartStream(&s);
+        std::cout << "Press Ctrl+C to stop" << std::endl;
+    }
+
+    stopSharing = 0;
+    signal(SIGINT, sigIntHandler);
+    auto lastReport = std::chrono::steady_clock::now();
+    while (status == 0 && !stopSharing)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        const auto now = std::chrono::steady_clock::now();
+        if (now - lastReport < std::chrono::seconds(1))
+            continue;
+        lastReport = now;
+        lms_stream_status_t streamStatus;
+        LMS_GetStreamStatus(&streams[0], &streamStatus);
+        std::cout << "  RX " << streamStatus.linkRate/1e6 << " MB/s, "
+                  << "dropped packets " << streamStatus.droppedPackets << std::endl;
+    }
+    signal(SIGINT, SIG_DFL);
+
+    for (auto &s : streams)
+    {
+        if (s.handle == 0)
+            continue;
+        LMS_StopStream(&s);
+        LMS_UnshareStream(device, &s);
+        LMS_DestroyStream(device, &s);
+    }
+    LMS_Close(device);
+    return (status==0)?EXIT_SUCCESS:EXIT_FAILURE;
+}
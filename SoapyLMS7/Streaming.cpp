@@ -7,6 +7,7 @@
 #include "SoapyLMS7.h"
 #include "LMS7002M.h"
 #include <IConnection.h>
+#include <BufferPool.h>
 #include <SoapySDR/Formats.hpp>
 #include <SoapySDR/Logger.hpp>
 #include <SoapySDR/Time.hpp>
@@ -44,6 +45,8 @@ std::vector<std::string> SoapyLMS7::getStreamFormats(const int direction, const
     formats.push_back(SOAPY_SDR_CF32);
     formats.push_back(SOAPY_SDR_CS12);
     formats.push_back(SOAPY_SDR_CS16);
+    formats.push_back(SOAPY_SDR_CS8);
+    formats.push_back(SOAPY_SDR_CF16);
     return formats;
 }
 
@@ -84,6 +87,51 @@ SoapySDR::ArgInfoList SoapyLMS7::getStreamArgsInfo(const int direction, const si
         argInfos.push_back(info);
     }
 
+    //int8 bit selection
+    {
+        SoapySDR::ArgInfo info;
+        info.value = "4";
+        info.key = "int8Shift";
+        info.name = "Int8 Shift";
+        info.description = "Number of least significant bits dropped from 12 bit samples in CS8 format.";
+        info.type = SoapySDR::ArgInfo::INT;
+        info.range = SoapySDR::Range(0, 8);
+        argInfos.push_back(info);
+    }
+
+    //huge pages
+    {
+        SoapySDR::ArgInfo info;
+        info.value = "false";
+        info.key = "hugePages";
+        info.name = "Huge Pages";
+        info.description = "Allocate stream buffers using 2 MB huge pages.";
+        info.type = SoapySDR::ArgInfo::BOOL;
+        argInfos.push_back(info);
+    }
+
+    //memory locking
+    {
+        SoapySDR::ArgInfo info;
+        info.value = "false";
+        info.key = "lockMemory";
+        info.name = "Lock Memory";
+        info.description = "Lock stream buffers in RAM, limited by RLIMIT_MEMLOCK.";
+        info.type = SoapySDR::ArgInfo::BOOL;
+        argInfos.push_back(info);
+    }
+
+    //NUMA node
+    {
+        SoapySDR::ArgInfo info;
+        info.value = "-1";
+        info.key = "numaNode";
+        info.name = "NUMA Node";
+        info.description = "NUMA node for stream buffers and threads, -1 selects the node of the device controller, -2 disables binding.";
+        info.type = SoapySDR::ArgInfo::INT;
+        argInfos.push_back(info);
+    }
+
     return argInfos;
 }
 
@@ -117,6 +165,8 @@ SoapySDR::Stream *SoapyLMS7::setupStream(
         if (format == SOAPY_SDR_CF32) config.format = StreamConfig::STREAM_COMPLEX_FLOAT32;
         else if (format == SOAPY_SDR_CS16) config.format = StreamConfig::STREAM_12_BIT_IN_16;
         else if (format == SOAPY_SDR_CS12) config.format = StreamConfig::STREAM_12_BIT_COMPRESSED;
+        else if (format == SOAPY_SDR_CS8) config.format = StreamConfig::STREAM_COMPLEX_INT8;
+        else if (format == SOAPY_SDR_CF16) config.format = StreamConfig::STREAM_COMPLEX_FLOAT16;
         else throw std::runtime_error("SoapyLMS7::setupStream(format="+format+") unsupported format");
 
         //optional buffer length if specified (from device args)
@@ -142,6 +192,23 @@ SoapySDR::Stream *SoapyLMS7::setupStream(
                 config.performanceLatency = 1;
         }
 
+        //optional bit selection for CS8 format
+        if (args.count("int8Shift") != 0)
+            config.int8Shift = std::stoi(args.at("int8Shift"));
+
+        //optional buffer allocation options
+        if (args.count("hugePages") != 0 && args.at("hugePages") == "true")
+            config.bufferFlags |= BufferPool::HUGE_PAGES;
+        if (args.count("lockMemory") != 0 && args.at("lockMemory") == "true")
+            config.bufferFlags |= BufferPool::LOCK_MEMORY;
+
+        //optional NUMA node (from device args, stream args take precedence)
+        const auto devArgsNumaNode = _deviceArgs.find("numaNode");
+        if (devArgsNumaNode != _deviceArgs.end())
+            config.numaNode = std::stoi(devArgsNumaNode->second);
+        if (args.count("numaNode") != 0)
+            config.numaNode = std::stoi(args.at("numaNode"));
+
         //create the stream
         size_t streamID(~0);
         const int status = _conn->SetupStream(streamID, config);
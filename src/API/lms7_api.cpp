@@ -11,6 +11,7 @@
 #include "FPGA_common.h"
 #include "Logger.h"
 #include "LMS64CProtocol.h"
+#include "SharedStream.h"
 
 using namespace std;
 
@@ -1124,6 +1125,25 @@ API_EXPORT int CALL_CONV LMS_SetGFIR(lms_device_t * device, bool dir_tx, size_t
     return lms->SetGFIR(dir_tx,chan,filt,enabled);
 }
 
+static lime::StreamConfig::StreamDataFormat GetStreamFormat(int dataFmt)
+{
+    switch(dataFmt)
+    {
+        case lms_stream_t::LMS_FMT_F32:
+            return lime::StreamConfig::STREAM_COMPLEX_FLOAT32;
+        case lms_stream_t::LMS_FMT_I16:
+            return lime::StreamConfig::STREAM_12_BIT_IN_16;
+        case lms_stream_t::LMS_FMT_I12:
+            return lime::StreamConfig::STREAM_12_BIT_COMPRESSED;
+        case lms_stream_t::LMS_FMT_I8:
+            return lime::StreamConfig::STREAM_COMPLEX_INT8;
+        case lms_stream_t::LMS_FMT_F16:
+            return lime::StreamConfig::STREAM_COMPLEX_FLOAT16;
+        default:
+            return lime::StreamConfig::STREAM_COMPLEX_FLOAT32;
+    }
+}
+
 API_EXPORT int CALL_CONV LMS_SetupStream(lms_device_t *device, lms_stream_t *stream)
 {
     if(device == nullptr)
@@ -1137,24 +1157,89 @@ API_EXPORT int CALL_CONV LMS_SetupStream(lms_device_t *device, lms_stream_t *str
     config.bufferLength = stream->fifoSize;
     config.channelID = stream->channel;
     config.performanceLatency = stream->throughputVsLatency;
-    switch(stream->dataFmt)
-    {
-        case lms_stream_t::LMS_FMT_F32:
-            config.format = lime::StreamConfig::STREAM_COMPLEX_FLOAT32;
-            break;
-        case lms_stream_t::LMS_FMT_I16:
-            config.format = lime::StreamConfig::STREAM_12_BIT_IN_16;
-            break;
-        case lms_stream_t::LMS_FMT_I12:
-            config.format = lime::StreamConfig::STREAM_12_BIT_COMPRESSED;
-            break;
-        default:
-            config.format = lime::StreamConfig::STREAM_COMPLEX_FLOAT32;
-    }
+    config.format = GetStreamFormat(stream->dataFmt);
     config.isTx = stream->isTx;
     return lms->GetConnection(stream->channel)->SetupStream(stream->handle, config);
 }
 
+API_EXPORT int CALL_CONV LMS_SetupResampledStream(lms_device_t *device, lms_stream_t *stream, const lms_resampler_t *resampler)
+{
+    if(device == nullptr)
+        return lime::ReportError(EINVAL, "Device is NULL.");
+    if(stream == nullptr || resampler == nullptr)
+        return lime::ReportError(EINVAL, "stream or resampler is NULL.");
+    if(stream->isTx)
+        return lime::ReportError(EINVAL, "Only RX streams can be resampled.");
+
+    LMS7_Device* lms = (LMS7_Device*)device;
+
+    lime::StreamConfig config;
+    config.bufferLength = stream->fifoSize;
+    config.channelID = stream->channel;
+    config.performanceLatency = stream->throughputVsLatency;
+    config.format = GetStreamFormat(stream->dataFmt);
+    config.isTx = false;
+    config.resampling.interpolation = resampler->interpolation;
+    config.resampling.decimation = resampler->decimation;
+    if (resampler->taps)
+        config.resampling.taps = resampler->taps;
+    if (resampler->passband > 0)
+        config.resampling.passband = resampler->passband;
+    if (resampler->stopband > 0)
+        config.resampling.stopband = resampler->stopband;
+    return lms->GetConnection(stream->channel)->SetupStream(stream->handle, config);
+}
+
+API_EXPORT int CALL_CONV LMS_SetupBurstStream(lms_device_t *device, lms_stream_t *stream)
+{
+    if(device == nullptr)
+        return lime::ReportError(EINVAL, "Device is NULL.");
+    if(stream == nullptr)
+        return lime::ReportError(EINVAL, "stream is NULL.");
+    if(!stream->isTx)
+        return lime::ReportError(EINVAL, "Only TX streams merge bursts.");
+
+    LMS7_Device* lms = (LMS7_Device*)device;
+
+    lime::StreamConfig config;
+    config.bufferLength = stream->fifoSize;
+    config.channelID = stream->channel;
+    config.performanceLatency = stream->throughputVsLatency;
+    config.format = GetStreamFormat(stream->dataFmt);
+    config.isTx = true;
+    config.mergeBursts = true;
+    return lms->GetConnection(stream->channel)->SetupStream(stream->handle, config);
+}
+
+API_EXPORT int CALL_CONV LMS_SetupSubStream(lms_device_t *device, lms_stream_t *wideband, lms_stream_t *stream, float_type frequencyOffset, const lms_resampler_t *resampler)
+{
+    if(device == nullptr)
+        return lime::ReportError(EINVAL, "Device is NULL.");
+    if(wideband == nullptr || stream == nullptr)
+        return lime::ReportError(EINVAL, "stream is NULL.");
+
+    LMS7_Device* lms = (LMS7_Device*)device;
+
+    lime::StreamConfig config;
+    config.bufferLength = stream->fifoSize;
+    config.format = GetStreamFormat(stream->dataFmt);
+    config.isTx = false;
+    if (resampler)
+    {
+        config.resampling.interpolation = resampler->interpolation;
+        config.resampling.decimation = resampler->decimation;
+        if (resampler->taps)
+            config.resampling.taps = resampler->taps;
+        if (resampler->passband > 0)
+            config.resampling.passband = resampler->passband;
+        if (resampler->stopband > 0)
+            config.resampling.stopband = resampler->stopband;
+    }
+    stream->isTx = false;
+    stream->channel = wideband->channel;
+    return lms->GetConnection(wideband->channel)->SetupSubStream(stream->handle, wideband->handle, frequencyOffset, config);
+}
+
 API_EXPORT int CALL_CONV LMS_DestroyStream(lms_device_t *device, lms_stream_t *stream)
 {
     if(stream == nullptr)
@@ -1257,6 +1342,204 @@ API_EXPORT int CALL_CONV LMS_EnableTxWFM(lms_device_t *device, unsigned ch, bool
     return status;
 }
 
+API_EXPORT int CALL_CONV LMS_StartRecording(lms_device_t *device, lms_stream_t *streams, size_t streamCount, const char *filename, bool packed)
+{
+    if (device == nullptr)
+        return lime::ReportError(EINVAL, "Device is NULL.");
+    if (streams == nullptr || streamCount == 0 || filename == nullptr)
+        return lime::ReportError(EINVAL, "Invalid recording parameters.");
+
+    LMS7_Device* lms = (LMS7_Device*)device;
+    std::vector<lime::IStreamChannel*> channels;
+    for (size_t i = 0; i < streamCount; i++)
+    {
+        if (streams[i].handle == 0 || streams[i].isTx)
+            return lime::ReportError(EINVAL, "Only RX streams can be recorded.");
+        if (streams[i].dataFmt != streams[0].dataFmt)
+            return lime::ReportError(EINVAL, "Recorded streams must use the same data format.");
+        channels.push_back((lime::IStreamChannel*)streams[i].handle);
+    }
+
+    lime::RecorderConfig config;
+    config.path = filename;
+    config.format = GetStreamFormat(streams[0].dataFmt);
+    config.packed = packed;
+    config.sampleRate = lms->GetRate(false, streams[0].channel);
+    config.frequency = lms->GetTRXFrequency(false, streams[0].channel);
+    auto conn = lms->GetConnection(streams[0].channel);
+    if (conn)
+        config.hardware = conn->GetDeviceInfo().deviceName;
+    return lms->StartRecording(channels, config) == 0 ? 0 : -1;
+}
+
+API_EXPORT int CALL_CONV LMS_StopRecording(lms_device_t *device)
+{
+    if (device == nullptr)
+        return lime::ReportError(EINVAL, "Device is NULL.");
+    LMS7_Device* lms = (LMS7_Device*)device;
+    return lms->StopRecording() == 0 ? 0 : -1;
+}
+
+API_EXPORT int CALL_CONV LMS_GetRecordingStatus(lms_device_t *device, lms_recording_status_t *status)
+{
+    if (device == nullptr || status == nullptr)
+        return lime::ReportError(EINVAL, "Invalid parameter.");
+    LMS7_Device* lms = (LMS7_Device*)device;
+    const lime::StreamRecorder::Status info = lms->GetRecordingStatus();
+    status->active = info.active;
+    status->error = info.error;
+    status->samples = info.samples;
+    status->bytesWritten = info.bytesWritten;
+    status->gaps = info.gaps;
+    status->droppedSamples = info.droppedSamples;
+    status->writerStalls = info.writerStalls;
+    return 0;
+}
+
+API_EXPORT int CALL_CONV LMS_StartPlayback(lms_device_t *device, lms_stream_t *stream, const lms_playback_t *playback)
+{
+    if (device == nullptr)
+        return lime::ReportError(EINVAL, "Device is NULL.");
+    if (stream == nullptr || stream->handle == 0 || playback == nullptr || playback->filename == nullptr)
+        return lime::ReportError(EINVAL, "Invalid playback parameters.");
+
+    LMS7_Device* lms = (LMS7_Device*)device;
+    lime::PlaybackConfig config;
+    config.path = playback->filename;
+    switch (playback->fileFmt)
+    {
+        case lms_playback_t::LMS_PLAYBACK_CS12_PACKED:
+            config.format = lime::PlaybackConfig::FILE_CS12_PACKED;
+            break;
+        case lms_playback_t::LMS_PLAYBACK_CF32:
+            config.format = lime::PlaybackConfig::FILE_CF32;
+            break;
+        default:
+            config.format = lime::PlaybackConfig::FILE_CS16;
+    }
+    config.channelsCount = playback->channels;
+    config.loop = playback->loop;
+    config.useTimestamp = playback->waitForTimestamp;
+    config.timestamp = playback->timestamp;
+    config.sampleRate = playback->sampleRate;
+    return lms->GetConnection(stream->channel)->StartPlayback(stream->handle, config) == 0 ? 0 : -1;
+}
+
+API_EXPORT int CALL_CONV LMS_StopPlayback(lms_device_t *device, lms_stream_t *stream)
+{
+    if (device == nullptr)
+        return lime::ReportError(EINVAL, "Device is NULL.");
+    if (stream == nullptr || stream->handle == 0)
+        return lime::ReportError(EINVAL, "stream is NULL.");
+    LMS7_Device* lms = (LMS7_Device*)device;
+    return lms->GetConnection(stream->channel)->StopPlayback(stream->handle) == 0 ? 0 : -1;
+}
+
+API_EXPORT int CALL_CONV LMS_ShareStream(lms_device_t *device, lms_stream_t *stream, const char *name, bool exclusive)
+{
+    if (device == nullptr)
+        return lime::ReportError(EINVAL, "Device is NULL.");
+    if (stream == nullptr || stream->handle == 0 || name == nullptr)
+        return lime::ReportError(EINVAL, "Invalid shared stream parameters.");
+    LMS7_Device* lms = (LMS7_Device*)device;
+    return lms->GetConnection(stream->channel)->ShareStream(stream->handle, name, exclusive) == 0 ? 0 : -1;
+}
+
+API_EXPORT int CALL_CONV LMS_UnshareStream(lms_device_t *device, lms_stream_t *stream)
+{
+    if (device == nullptr)
+        return lime::ReportError(EINVAL, "Device is NULL.");
+    if (stream == nullptr || stream->handle == 0)
+        return lime::ReportError(EINVAL, "stream is NULL.");
+    LMS7_Device* lms = (LMS7_Device*)device;
+    return lms->GetConnection(stream->channel)->UnshareStream(stream->handle) == 0 ? 0 : -1;
+}
+
+API_EXPORT int CALL_CONV LMS_SetStreamCorrection(lms_device_t *device, lms_stream_t *stream, const lms_iq_correction_t *correction)
+{
+    if (device == nullptr)
+        return lime::ReportError(EINVAL, "Device is NULL.");
+    if (stream == nullptr || stream->handle == 0)
+        return lime::ReportError(EINVAL, "stream is NULL.");
+    LMS7_Device* lms = (LMS7_Device*)device;
+    if (correction == nullptr)
+        return lms->GetConnection(stream->channel)->SetStreamCorrection(stream->handle, nullptr) == 0 ? 0 : -1;
+    lime::IQCorrection corr;
+    corr.dcI = correction->dc_i;
+    corr.dcQ = correction->dc_q;
+    corr.matrix[0][0] = correction->matrix[0];
+    corr.matrix[0][1] = correction->matrix[1];
+    corr.matrix[1][0] = correction->matrix[2];
+    corr.matrix[1][1] = correction->matrix[3];
+    return lms->GetConnection(stream->channel)->SetStreamCorrection(stream->handle, &corr) == 0 ? 0 : -1;
+}
+
+API_EXPORT int CALL_CONV LMS_SetStreamTrigger(lms_device_t *device, lms_stream_t *stream, const lms_trigger_t *trigger)
+{
+    if (device == nullptr)
+        return lime::ReportError(EINVAL, "Device is NULL.");
+    if (stream == nullptr || stream->handle == 0)
+        return lime::ReportError(EINVAL, "stream is NULL.");
+    LMS7_Device* lms = (LMS7_Device*)device;
+    if (trigger == nullptr)
+        return lms->GetConnection(stream->channel)->SetStreamTrigger(stream->handle, nullptr) == 0 ? 0 : -1;
+    lime::TriggerConfig config;
+    config.level = trigger->level;
+    if (trigger->window)
+        config.window = trigger->window;
+    config.preTriggerPackets = trigger->preTrigger;
+    config.postTriggerPackets = trigger->postTrigger;
+    return lms->GetConnection(stream->channel)->SetStreamTrigger(stream->handle, &config) == 0 ? 0 : -1;
+}
+
+API_EXPORT int CALL_CONV LMS_AttachSharedStream(lms_shared_stream_t **stream, const char *name)
+{
+    if (stream == nullptr || name == nullptr)
+        return lime::ReportError(EINVAL, "Invalid shared stream parameters.");
+    lime::SharedStreamConsumer* consumer = new lime::SharedStreamConsumer();
+    if (consumer->Attach(name) != 0)
+    {
+        delete consumer;
+        return -1;
+    }
+    *stream = consumer;
+    return 0;
+}
+
+API_EXPORT int CALL_CONV LMS_AcquireSharedSamples(lms_shared_stream_t *stream, const int16_t **samples, lms_stream_meta_t *meta, unsigned timeout_ms)
+{
+    if (stream == nullptr || samples == nullptr)
+        return lime::ReportError(EINVAL, "Invalid shared stream parameters.");
+    lime::SharedStreamConsumer* consumer = (lime::SharedStreamConsumer*)stream;
+    const lime::complex16_t* data = nullptr;
+    uint64_t timestamp = 0;
+    const int count = consumer->Acquire(&data, &timestamp, nullptr, timeout_ms);
+    if (count > 0)
+        *samples = (const int16_t*)data;
+    if (meta)
+        meta->timestamp = timestamp;
+    return count;
+}
+
+API_EXPORT int CALL_CONV LMS_ReleaseSharedSamples(lms_shared_stream_t *stream)
+{
+    if (stream == nullptr)
+        return -1;
+    return ((lime::SharedStreamConsumer*)stream)->Release() ? 0 : -1;
+}
+
+API_EXPORT uint64_t CALL_CONV LMS_GetSharedStreamOverflows(lms_shared_stream_t *stream)
+{
+    if (stream == nullptr)
+        return 0;
+    return ((lime::SharedStreamConsumer*)stream)->GetInfo().overflows;
+}
+
+API_EXPORT void CALL_CONV LMS_DetachSharedStream(lms_shared_stream_t *stream)
+{
+    delete (lime::SharedStreamConsumer*)stream;
+}
+
 API_EXPORT int CALL_CONV LMS_GetStreamStatus(lms_stream_t *stream, lms_stream_status_t* status)
 {
     assert(stream != nullptr);
@@ -0,0 +1,162 @@
+/**
+    @file lms7_async.cpp
+    @author Lime Microsystems
+    @brief Runs device control operations on a worker thread.
+*/
+
+#include "lms7_async.h"
+#include "lms7_device.h"
+#include "ErrorReporting.h"
+#include <algorithm>
+#include <cerrno>
+#include <exception>
+
+LMS7_AsyncControl::LMS7_AsyncControl(LMS7_Device* device) :
+    device(device),
+    running(false),
+    coalescing(true),
+    terminate(false)
+{
+    worker = std::thread(&LMS7_AsyncControl::WorkerLoop, this);
+}
+
+LMS7_AsyncControl::~LMS7_AsyncControl()
+{
+    {
+        std::lock_guard<std::mutex> lck(lock);
+        terminate = true;
+    }
+    queued.notify_all();
+    worker.join();
+}
+
+std::future<int> LMS7_AsyncControl::Submit(Operation op, const Key key, Callback done)
+{
+    Request request;
+    request.op = op;
+    request.key = key;
+    request.promises.push_back(std::make_shared<std::promise<int>>());
+    if (done)
+        request.callbacks.push_back(done);
+    std::future<int> result = request.promises.back()->get_future();
+
+    std::lock_guard<std::mutex> lck(lock);
+    if (coalescing && key != 0)
+    {
+        //requests with key 0 are barriers, only requests queued after the last one are replaced
+        auto barrier = std::find_if(requests.rbegin(), requests.rend(), [](const Request &r){return r.key == 0;});
+        //replaced request is moved to the end, after requests submitted before this one
+        auto same = std::find_if(barrier.base(), requests.end(), [key](const Request &r){return r.key == key;});
+        if (same != requests.end())
+        {
+            request.promises.insert(request.promises.begin(), same->promises.begin(), same->promises.end());
+            request.callbacks.insert(request.callbacks.begin(), same->callbacks.begin(), same->callbacks.end());
+            requests.erase(same);
+        }
+    }
+    requests.push_back(std::move(request));
+    queued.notify_one();
+    return result;
+}
+
+std::future<int> LMS7_AsyncControl::SetFrequency(bool tx, size_t chan, double f_Hz, Callback done)
+{
+    return Submit([=](LMS7_Device* dev){
+            return tx ? dev->SetTxFrequency(chan, f_Hz) : dev->SetRxFrequency(chan, f_Hz);
+        }, MakeKey(OP_FREQUENCY, tx, chan), done);
+}
+
+std::future<int> LMS7_AsyncControl::SetRate(double f_Hz, int oversample, Callback done)
+{
+    //both directions, separate key from single direction rate
+    return Submit([=](LMS7_Device* dev){return dev->SetRate(f_Hz, oversample);},
+        MakeKey(OP_RATE, false, 0x7FFF), done);
+}
+
+std::future<int> LMS7_AsyncControl::SetRate(bool tx, double f_Hz, unsigned oversample, Callback done)
+{
+    return Submit([=](LMS7_Device* dev){return dev->SetRate(tx, f_Hz, oversample);},
+        MakeKey(OP_RATE, tx, 0), done);
+}
+
+std::future<int> LMS7_AsyncControl::SetGain(bool tx, size_t chan, unsigned gain, Callback done)
+{
+    return Submit([=](LMS7_Device* dev){return dev->SetGain(tx, chan, gain);},
+        MakeKey(OP_GAIN, tx, chan), done);
+}
+
+std::future<int> LMS7_AsyncControl::SetNormalizedGain(bool tx, size_t chan, double gain, Callback done)
+{
+    return Submit([=](LMS7_Device* dev){return dev->SetNormalizedGain(tx, chan, gain);},
+        MakeKey(OP_GAIN, tx, chan), done);
+}
+
+std::future<int> LMS7_AsyncControl::SetLPF(bool tx, size_t chan, bool enabled, double bandwidth, Callback done)
+{
+    return Submit([=](LMS7_Device* dev){return dev->SetLPF(tx, chan, true, enabled, bandwidth);},
+        MakeKey(OP_LPF, tx, chan), done);
+}
+
+std::future<int> LMS7_AsyncControl::Calibrate(bool tx, size_t chan, double bandwidth, unsigned flags, Callback done)
+{
+    //calibration depends on settings applied before it, never replaced
+    return Submit([=](LMS7_Device* dev){return dev->Calibrate(tx, chan, bandwidth, flags);}, 0, done);
+}
+
+void LMS7_AsyncControl::SetCoalescing(bool enable)
+{
+    std::lock_guard<std::mutex> lck(lock);
+    coalescing = enable;
+}
+
+void LMS7_AsyncControl::Wait()
+{
+    std::unique_lock<std::mutex> lck(lock);
+    idle.wait(lck, [this]{return requests.empty() && not running;});
+}
+
+size_t LMS7_AsyncControl::GetPendingCount()
+{
+    std::lock_guard<std::mutex> lck(lock);
+    return requests.size() + (running ? 1 : 0);
+}
+
+void LMS7_AsyncControl::WorkerLoop()
+{
+    std::unique_lock<std::mutex> lck(lock);
+    while (true)
+    {
+        queued.wait(lck, [this]{return not requests.empty() || terminate;});
+        //queued operations are completed before stopping
+        if (requests.empty())
+            return;
+        Request request = std::move(requests.front());
+        requests.pop_front();
+        running = true;
+        lck.unlock();
+
+        int status;
+        try
+        {
+            status = request.op(device);
+        }
+        catch (const std::exception &ex)
+        {
+            status = lime::ReportError(EIO, "Async operation failed: %s", ex.what());
+        }
+        catch (...)
+        {
+            status = lime::ReportError(EIO, "Async operation failed: unknown exception");
+        }
+        const char* message = status != 0 ? lime::GetLastErrorMessage() : "";
+        for (auto &callback : request.callbacks)
+            callback(status, message);
+        for (auto &promise : request.promises)
+            promise->set_value(status);
+
+        lck.lock();
+        running = false;
+        if (requests.empty())
+            idle.notify_all();
+    }
+}
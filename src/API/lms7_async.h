@@ -0,0 +1,121 @@
+/**
+    @file lms7_async.h
+    @author Lime Microsystems
+    @brief Runs device control operations on a worker thread.
+*/
+
+#ifndef LMS7_ASYNC_H
+#define LMS7_ASYNC_H
+#include "LimeSuiteConfig.h"
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class LMS7_Device;
+
+/*!
+ * LMS7_AsyncControl queues slow control operations (tuning, rate changes,
+ * calibrations) and executes them one at a time on a worker thread, so the
+ * submitting thread does not wait for them. Operations are executed in
+ * submission order, settings of each chip are applied in the order given.
+ *
+ * Operations with the same coalescing key replace each other while waiting
+ * in queue, only the last one is executed. Futures and callbacks of
+ * replaced operations are completed with the result of the replacing one.
+ * Operations with key 0 are never replaced or skipped over, operations
+ * queued before them are not replaced by ones submitted after them.
+ *
+ * Exceptions thrown by operations are reported as EIO status.
+ *
+ * While operations are queued, device should not be used directly from
+ * other threads, Wait() returns when the queue is empty.
+ */
+class LIME_API LMS7_AsyncControl
+{
+public:
+    typedef std::function<int(LMS7_Device*)> Operation;
+
+    /*!
+     * Called from worker thread when operation completes
+     * @param status 0 on success
+     * @param message error message reported by operation, empty on success
+     */
+    typedef std::function<void(int status, const char* message)> Callback;
+
+    //! Coalescing key of operation, 0 means never replaced
+    typedef uint32_t Key;
+
+    LMS7_AsyncControl(LMS7_Device* device);
+    //! Executes queued operations and stops worker
+    ~LMS7_AsyncControl();
+
+    /** @brief Queues operation
+        @param op operation, called with device on worker thread
+        @param key coalescing key, see MakeKey()
+        @param done optional completion callback
+        @return future of operation status
+    */
+    std::future<int> Submit(Operation op, const Key key = 0, Callback done = nullptr);
+
+    std::future<int> SetFrequency(bool tx, size_t chan, double f_Hz, Callback done = nullptr);
+    std::future<int> SetRate(double f_Hz, int oversample, Callback done = nullptr);
+    std::future<int> SetRate(bool tx, double f_Hz, unsigned oversample = 0, Callback done = nullptr);
+    std::future<int> SetGain(bool tx, size_t chan, unsigned gain, Callback done = nullptr);
+    std::future<int> SetNormalizedGain(bool tx, size_t chan, double gain, Callback done = nullptr);
+    std::future<int> SetLPF(bool tx, size_t chan, bool enabled, double bandwidth, Callback done = nullptr);
+    std::future<int> Calibrate(bool tx, size_t chan, double bandwidth, unsigned flags, Callback done = nullptr);
+
+    //! @brief Enables replacing of queued operations with same key, enabled by default
+    void SetCoalescing(bool enable);
+
+    //! @brief Blocks until all queued operations are completed
+    void Wait();
+
+    //! @brief Returns number of operations waiting or running
+    size_t GetPendingCount();
+
+    enum OperationType
+    {
+        OP_FREQUENCY = 1,
+        OP_RATE,
+        OP_GAIN,
+        OP_LPF,
+        OP_USER = 0x100,    ///<first type available for user operations
+    };
+
+    //! @brief Builds coalescing key from operation type, direction and channel
+    static Key MakeKey(unsigned type, bool tx, size_t chan)
+    {
+        return (type << 16) | (tx ? 0x8000 : 0) | (chan & 0x7FFF);
+    }
+
+private:
+    LMS7_AsyncControl(const LMS7_AsyncControl&) = delete;
+    LMS7_AsyncControl& operator=(const LMS7_AsyncControl&) = delete;
+    void WorkerLoop();
+
+    struct Request
+    {
+        Operation op;
+        Key key;
+        std::vector<std::shared_ptr<std::promise<int>>> promises; ///<including replaced requests
+        std::vector<Callback> callbacks;
+    };
+
+    LMS7_Device* device;
+    std::mutex lock;
+    std::condition_variable queued;
+    std::condition_variable idle;
+    std::deque<Request> requests;
+    bool running;           ///<worker is executing operation
+    bool coalescing;
+    bool terminate;
+    std::thread worker;
+};
+
+#endif	/* LMS7_ASYNC_H */
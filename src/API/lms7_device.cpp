@@ -6,6 +6,7 @@
  */
 
 #include "lms7_device.h"
+#include "lms7_async.h"
 #include "qLimeSDR.h"
 #include "LimeSDR_mini.h"
 #include "GFIR/lms_gfir.h"
@@ -51,10 +52,14 @@ LMS7_Device* LMS7_Device::CreateDevice(lime::IConnection* conn, LMS7_Device *obj
     return device;
 }
 
-LMS7_Device::LMS7_Device(LMS7_Device *obj) : connection(nullptr), lms_chip_id(0)
+LMS7_Device::LMS7_Device(LMS7_Device *obj) : connection(nullptr), asyncControl(nullptr), lms_chip_id(0)
 {
     if (obj != nullptr)
     {
+        //finish queued operations while old object still owns chips
+        delete obj->asyncControl;
+        obj->asyncControl = nullptr;
+        this->recorder = std::move(obj->recorder);
         this->lms_list = obj->lms_list;
         obj->lms_list.clear();
         this->rx_channels = obj->rx_channels;
@@ -66,6 +71,8 @@ LMS7_Device::LMS7_Device(LMS7_Device *obj) : connection(nullptr), lms_chip_id(0)
 
 LMS7_Device::~LMS7_Device()
 {
+    delete asyncControl;
+    recorder.reset();
     for (unsigned i = 0; i < this->lms_list.size();i++)
         delete this->lms_list[i];
 
@@ -157,21 +164,23 @@ int LMS7_Device::ConfigureGFIR(bool enabled,bool tx, double bandwidth, size_t ch
 
     bandwidth /= 1e6;
     lime::LMS7002M* lms = lms_list[ch / 2];
+    //bypass, ratio and coefficient writes are sent together on return
+    lime::LMS7002M_SPIBatch batch(lms);
     if (lms->Modify_SPI_Reg_bits(LMS7param(MAC),(ch%2)+1,true)!=0)
         return -1;
 
     if (tx)
     {
-        lms->Modify_SPI_Reg_bits(LMS7param(GFIR1_BYP_TXTSP),enabled==false,true);
-        lms->Modify_SPI_Reg_bits(LMS7param(GFIR2_BYP_TXTSP),enabled==false,true);
-        lms->Modify_SPI_Reg_bits(LMS7param(GFIR3_BYP_TXTSP),enabled==false,true);
+        const uint16_t bypass = enabled==false;
+        lms->Modify_SPI_Reg_bits<LMS7param(GFIR1_BYP_TXTSP), LMS7param(GFIR2_BYP_TXTSP),
+            LMS7param(GFIR3_BYP_TXTSP)>({bypass, bypass, bypass}, true);
 
     }
     else
     {
-        lms->Modify_SPI_Reg_bits(LMS7param(GFIR1_BYP_RXTSP), enabled == false, true);
-        lms->Modify_SPI_Reg_bits(LMS7param(GFIR2_BYP_RXTSP), enabled == false, true);
-        lms->Modify_SPI_Reg_bits(LMS7param(GFIR3_BYP_RXTSP), enabled == false, true);
+        const uint16_t bypass = enabled==false;
+        lms->Modify_SPI_Reg_bits<LMS7param(GFIR1_BYP_RXTSP), LMS7param(GFIR2_BYP_RXTSP),
+            LMS7param(GFIR3_BYP_RXTSP)>({bypass, bypass, bypass}, true);
         if (lms->Get_SPI_Reg_bits(LMS7_MASK, true) != 0)
         {
             if (ch%2)
@@ -270,24 +279,20 @@ int LMS7_Device::ConfigureGFIR(bool enabled,bool tx, double bandwidth, size_t ch
 
     if (tx)
     {
-        if (lms->Modify_SPI_Reg_bits(LMS7param(GFIR1_L_TXTSP), L, true) != 0)
+        const uint16_t ratio[] = {uint16_t(L), uint16_t(div)};
+        if (lms->Modify_SPI_Reg_bits<LMS7param(GFIR1_L_TXTSP), LMS7param(GFIR1_N_TXTSP)>(ratio, true) != 0)
            return -1;
-        lms->Modify_SPI_Reg_bits(LMS7param(GFIR1_N_TXTSP), div, true);
-        lms->Modify_SPI_Reg_bits(LMS7param(GFIR2_L_TXTSP), L, true);
-        lms->Modify_SPI_Reg_bits(LMS7param(GFIR2_N_TXTSP), div, true);
-        lms->Modify_SPI_Reg_bits(LMS7param(GFIR3_L_TXTSP), L, true);
-        lms->Modify_SPI_Reg_bits(LMS7param(GFIR3_N_TXTSP), div, true);
+        lms->Modify_SPI_Reg_bits<LMS7param(GFIR2_L_TXTSP), LMS7param(GFIR2_N_TXTSP)>(ratio, true);
+        lms->Modify_SPI_Reg_bits<LMS7param(GFIR3_L_TXTSP), LMS7param(GFIR3_N_TXTSP)>(ratio, true);
 
     }
     else
     {
-        if (lms->Modify_SPI_Reg_bits(LMS7param(GFIR1_L_RXTSP), L, true) != 0)
+        const uint16_t ratio[] = {uint16_t(L), uint16_t(div)};
+        if (lms->Modify_SPI_Reg_bits<LMS7param(GFIR1_L_RXTSP), LMS7param(GFIR1_N_RXTSP)>(ratio, true) != 0)
           return -1;
-        lms->Modify_SPI_Reg_bits(LMS7param(GFIR1_N_RXTSP), div, true);
-        lms->Modify_SPI_Reg_bits(LMS7param(GFIR2_L_RXTSP), L, true);
-        lms->Modify_SPI_Reg_bits(LMS7param(GFIR2_N_RXTSP), div, true);
-        lms->Modify_SPI_Reg_bits(LMS7param(GFIR3_L_RXTSP), L, true);
-        lms->Modify_SPI_Reg_bits(LMS7param(GFIR3_N_RXTSP), div, true);
+        lms->Modify_SPI_Reg_bits<LMS7param(GFIR2_L_RXTSP), LMS7param(GFIR2_N_RXTSP)>(ratio, true);
+        lms->Modify_SPI_Reg_bits<LMS7param(GFIR3_L_RXTSP), LMS7param(GFIR3_N_RXTSP)>(ratio, true);
 
     }
 
@@ -296,7 +301,7 @@ int LMS7_Device::ConfigureGFIR(bool enabled,bool tx, double bandwidth, size_t ch
         || (lms->SetGFIRCoefficients(tx, 2, gfir1, 120) != 0))
         return -1;
 
-  return 0;
+  return lms->FlushSPIBatch();
 }
 
 int LMS7_Device::ConfigureTXLPF(bool enabled,int ch,double bandwidth)
@@ -1987,6 +1992,8 @@ int LMS7_Device::SaveConfig(const char *filename)
 int LMS7_Device::ReadLMSReg(uint16_t address, uint16_t *val)
 {
     int status;
+    //register access API always reads chip
+    lms_list.at(lms_chip_id)->InvalidateRegisterCache(address & 0xFFFF);
     *val = lms_list.at(lms_chip_id)->SPI_read(address & 0xFFFF, true, &status);
     return status;
 }
@@ -2008,6 +2015,8 @@ int LMS7_Device::ReadParam(struct LMS7Parameter param, uint16_t *val, bool force
             break;
         }
     }
+    if (forceReadFromChip)
+        lms_list.at(lms_chip_id)->InvalidateRegisterCache(param.address);
     *val = lms_list.at(lms_chip_id)->Get_SPI_Reg_bits(param, forceReadFromChip);
     return LMS_SUCCESS;
 }
@@ -2041,6 +2050,153 @@ int LMS7_Device::UploadWFM(const void **samples, uint8_t chCount, int sample_cou
     return connection->UploadWFM(samples, chCount%2 ? 1 : 2, sample_count, fmt, (chCount-1)/2);
 }
 
+int LMS7_Device::StartRecording(const std::vector<lime::IStreamChannel*> &streams, const lime::RecorderConfig &config)
+{
+    if (recorder == nullptr)
+        recorder.reset(new lime::StreamRecorder());
+    return recorder->Start(streams, config);
+}
+
+int LMS7_Device::StopRecording()
+{
+    return recorder ? recorder->Stop() : 0;
+}
+
+lime::StreamRecorder::Status LMS7_Device::GetRecordingStatus() const
+{
+    if (recorder)
+        return recorder->GetStatus();
+    lime::StreamRecorder::Status status = {};
+    return status;
+}
+
+LMS7_AsyncControl* LMS7_Device::GetAsyncControl()
+{
+    if (asyncControl == nullptr)
+        asyncControl = new LMS7_AsyncControl(this);
+    return asyncControl;
+}
+
+/** @brief Interface clock rates of FPGA matching chip TSP configuration
+*/
+static void GetInterfaceRates(lime::LMS7002M* lms, float_type &txRate, float_type &rxRate)
+{
+    const int interp = lms->Get_SPI_Reg_bits(LMS7param(HBI_OVR_TXTSP));
+    const int decim = lms->Get_SPI_Reg_bits(LMS7param(HBD_OVR_RXTSP));
+    txRate = lms->GetReferenceClk_TSP(lime::LMS7002M::Tx);
+    if (interp != 7)
+        txRate /= pow(2.0, interp);
+    rxRate = lms->GetReferenceClk_TSP(lime::LMS7002M::Rx);
+    if (decim != 7)
+        rxRate /= pow(2.0, decim);
+}
+
+/** @brief Captures configuration of all chips, FPGA and channels
+    @param snapshot receives configuration
+    @param fpgaRegisters FPGA register addresses to capture
+    @return 0-success, other-failure
+*/
+int LMS7_Device::CaptureSnapshot(LMS7_Snapshot &snapshot, const std::vector<uint32_t> &fpgaRegisters)
+{
+    LMS7_Snapshot captured;
+    captured.chips.resize(lms_list.size());
+    for (unsigned i = 0; i < lms_list.size(); i++)
+    {
+        lime::LMS7002M* lms = lms_list[i];
+        LMS7_Snapshot::Chip &chip = captured.chips[i];
+        if (lms->CaptureRegisterMap(chip.registers) != 0)
+            return -1;
+        chip.refClkRx = lms->GetReferenceClk_SX(lime::LMS7002M::Rx);
+        chip.refClkTx = lms->GetReferenceClk_SX(lime::LMS7002M::Tx);
+    }
+    for (const lms_channel_info &info : rx_channels)
+        captured.rxChannels.push_back({info.lpf_bw, info.cF_offset_nco, info.sample_rate, info.freq});
+    for (const lms_channel_info &info : tx_channels)
+        captured.txChannels.push_back({info.lpf_bw, info.cF_offset_nco, info.sample_rate, info.freq});
+
+    if (connection && not fpgaRegisters.empty())
+    {
+        captured.fpgaAddresses = fpgaRegisters;
+        captured.fpgaValues.resize(fpgaRegisters.size());
+        if (connection->ReadRegisters(fpgaRegisters.data(), captured.fpgaValues.data(), fpgaRegisters.size()) != 0)
+            return -1;
+    }
+    snapshot = std::move(captured);
+    return 0;
+}
+
+/** @brief Restores configuration captured by CaptureSnapshot()
+    Only registers differing from device are written, each chip in one batch.
+    Should not be used while streaming.
+    @param snapshot configuration of the same device type
+    @return 0-success, other-failure
+*/
+int LMS7_Device::ApplySnapshot(const LMS7_Snapshot &snapshot)
+{
+    if (snapshot.chips.size() != lms_list.size())
+        return lime::ReportError(EINVAL, "Snapshot has %i chips, device has %i",
+            int(snapshot.chips.size()), int(lms_list.size()));
+
+    for (unsigned i = 0; i < lms_list.size(); i++)
+    {
+        lime::LMS7002M* lms = lms_list[i];
+        const LMS7_Snapshot::Chip &chip = snapshot.chips[i];
+        if (lms->GetReferenceClk_SX(lime::LMS7002M::Rx) != chip.refClkRx
+         && lms->SetReferenceClk_SX(lime::LMS7002M::Rx, chip.refClkRx) != 0)
+            return -1;
+        if (lms->GetReferenceClk_SX(lime::LMS7002M::Tx) != chip.refClkTx
+         && lms->SetReferenceClk_SX(lime::LMS7002M::Tx, chip.refClkTx) != 0)
+            return -1;
+
+        float_type txBefore, rxBefore, txAfter, rxAfter;
+        GetInterfaceRates(lms, txBefore, rxBefore);
+        if (lms->ApplyRegisterMap(chip.registers) != 0)
+            return -1;
+        //FPGA interface clocks are reconfigured only when chip rates changed
+        GetInterfaceRates(lms, txAfter, rxAfter);
+        if (connection && (txAfter != txBefore || rxAfter != rxBefore)
+         && connection->UpdateExternalDataRate(i, txAfter/2, rxAfter/2) != 0)
+            return -1;
+    }
+
+    const size_t fpgaCount = std::min(snapshot.fpgaAddresses.size(), snapshot.fpgaValues.size());
+    if (connection && fpgaCount > 0)
+    {
+        std::vector<uint32_t> current(fpgaCount);
+        if (connection->ReadRegisters(snapshot.fpgaAddresses.data(), current.data(), fpgaCount) != 0)
+            return -1;
+        std::vector<uint32_t> addrs;
+        std::vector<uint32_t> values;
+        for (size_t i = 0; i < fpgaCount; ++i)
+        {
+            if (current[i] == snapshot.fpgaValues[i])
+                continue;
+            addrs.push_back(snapshot.fpgaAddresses[i]);
+            values.push_back(snapshot.fpgaValues[i]);
+        }
+        if (not addrs.empty() && connection->WriteRegisters(addrs.data(), values.data(), addrs.size()) != 0)
+            return -1;
+    }
+
+    for (size_t i = 0; i < rx_channels.size() && i < snapshot.rxChannels.size(); ++i)
+    {
+        const LMS7_Snapshot::Channel &ch = snapshot.rxChannels[i];
+        rx_channels[i].lpf_bw = ch.lpfBandwidth;
+        rx_channels[i].cF_offset_nco = ch.ncoOffset;
+        rx_channels[i].sample_rate = ch.sampleRate;
+        rx_channels[i].freq = ch.frequency;
+    }
+    for (size_t i = 0; i < tx_channels.size() && i < snapshot.txChannels.size(); ++i)
+    {
+        const LMS7_Snapshot::Channel &ch = snapshot.txChannels[i];
+        tx_channels[i].lpf_bw = ch.lpfBandwidth;
+        tx_channels[i].cF_offset_nco = ch.ncoOffset;
+        tx_channels[i].sample_rate = ch.sampleRate;
+        tx_channels[i].freq = ch.frequency;
+    }
+    return 0;
+}
+
 int LMS7_Device::MCU_AGCStart(uint8_t rssiMin, uint8_t pgaCeil)
 {
     lime::MCU_BD *mcu = lms_list.at(lms_chip_id)->GetMCUControls();
@@ -2059,6 +2215,9 @@ int LMS7_Device::MCU_AGCStart(uint8_t rssiMin, uint8_t pgaCeil)
 
     lms_list.at(lms_chip_id)->Modify_SPI_Reg_bits(0x002D, 15, 0, pgaCeil << 8 | rssiMin);
     mcu->RunProcedure(254);
+    //AGC changes gain registers on its own
+    lms_list.at(lms_chip_id)->InvalidateRegisterCache();
+    lms_list.at(lms_chip_id)->SetAGCRunning(true);
     return 0;
 }
 
@@ -2066,6 +2225,8 @@ int LMS7_Device::MCU_AGCStop()
 {
     lime::MCU_BD *mcu = lms_list.at(lms_chip_id)->GetMCUControls();
     mcu->RunProcedure(0);
+    lms_list.at(lms_chip_id)->SetAGCRunning(false);
+    lms_list.at(lms_chip_id)->InvalidateRegisterCache();
     lms_list.at(lms_chip_id)->Modify_SPI_Reg_bits(0x0006, 0, 0, 0);
     return 0;
 }
@@ -9,11 +9,16 @@
 #define	LMS7_DEVICE_H
 #include "LMS7002M.h"
 #include "lime/LimeSuite.h"
+#include <memory>
 #include <mutex>
 #include <vector>
 #include <map>
 #include <string>
 #include "IConnection.h"
+#include "StreamRecorder.h"
+#include "lms7_snapshot.h"
+
+class LMS7_AsyncControl;
 
 class LIME_API LMS7_Device
 {
@@ -92,8 +97,20 @@ public:
     static LMS7_Device* CreateDevice(lime::IConnection* conn, LMS7_Device *obj = nullptr);
     std::map<std::string, double> extra_parameters;
 
+    int StartRecording(const std::vector<lime::IStreamChannel*> &streams, const lime::RecorderConfig &config);
+    int StopRecording();
+    lime::StreamRecorder::Status GetRecordingStatus() const;
+
     int MCU_AGCStart(uint8_t rssiMin, uint8_t pgaCeil);
     int MCU_AGCStop();
+
+    //! Returns queue executing operations of this device on worker thread, created on first use
+    LMS7_AsyncControl* GetAsyncControl();
+
+    //! Captures configuration of chips, FPGA registers and channels into memory
+    int CaptureSnapshot(LMS7_Snapshot &snapshot, const std::vector<uint32_t> &fpgaRegisters = LMS7_Snapshot::defaultFPGARegisters);
+    //! Writes only configuration differing from snapshot
+    int ApplySnapshot(const LMS7_Snapshot &snapshot);
 protected:
     const double maxTxGain = 60.0;
     lms_dev_info_t devInfo;
@@ -102,6 +119,8 @@ protected:
     static const double LMS_CGEN_MAX;
     lime::IConnection* connection;
     std::vector<lime::LMS7002M*> lms_list;
+    std::unique_ptr<lime::StreamRecorder> recorder;
+    LMS7_AsyncControl* asyncControl;
     int ConfigureRXLPF(bool enabled,int ch,float_type bandwidth);
     int ConfigureTXLPF(bool enabled,int ch,float_type bandwidth);
     int ConfigureGFIR(bool enabled,bool tx, float_type bandwidth,size_t ch);
@@ -0,0 +1,201 @@
+/**
+    @file lms7_snapshot.cpp
+    @author Lime Microsystems
+    @brief In-memory device configuration snapshot.
+*/
+
+#include "lms7_snapshot.h"
+#include "ErrorReporting.h"
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+using namespace lime;
+
+const std::vector<uint32_t> LMS7_Snapshot::defaultFPGARegisters = {0x0007, 0x0008};
+
+//encoding: magic, version, then values in little endian order
+static const char snapshotMagic[4] = {'L', 'M', 'S', 'S'};
+static const uint16_t snapshotVersion = 1;
+//smallest encoded entries, counts are checked against them before allocating
+static const size_t chipMinSize = 2*8 + 2*2;
+static const size_t channelSize = 4*8;
+static const size_t fpgaRegisterSize = 2*4;
+
+namespace
+{
+class Writer
+{
+public:
+    Writer(std::vector<uint8_t> &data) : data(data) {}
+    void Put(uint64_t value, int bytes)
+    {
+        for (int i = 0; i < bytes; ++i)
+            data.push_back((value >> (8*i)) & 0xFF);
+    }
+    void PutDouble(double value)
+    {
+        uint64_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        Put(bits, 8);
+    }
+private:
+    std::vector<uint8_t> &data;
+};
+
+class Reader
+{
+public:
+    Reader(const uint8_t* data, size_t length) : data(data), remaining(length) {}
+    bool Get(uint64_t &value, int bytes)
+    {
+        if (remaining < size_t(bytes))
+            return false;
+        value = 0;
+        for (int i = 0; i < bytes; ++i)
+            value |= uint64_t(data[i]) << (8*i);
+        data += bytes;
+        remaining -= bytes;
+        return true;
+    }
+    bool GetDouble(double &value)
+    {
+        uint64_t bits;
+        if (not Get(bits, 8))
+            return false;
+        memcpy(&value, &bits, sizeof(value));
+        return true;
+    }
+    bool AtEnd() const {return remaining == 0;}
+    size_t Remaining() const {return remaining;}
+private:
+    const uint8_t* data;
+    size_t remaining;
+};
+}
+
+void LMS7_Snapshot::Serialize(std::vector<uint8_t> &data) const
+{
+    data.assign(snapshotMagic, snapshotMagic+sizeof(snapshotMagic));
+    Writer out(data);
+    out.Put(snapshotVersion, 2);
+    out.Put(chips.size(), 2);
+    for (const Chip &chip : chips)
+    {
+        out.PutDouble(chip.refClkRx);
+        out.PutDouble(chip.refClkTx);
+        //only registers present in map are stored
+        for (int space = 0; space < 2; ++space)
+        {
+            const std::vector<uint16_t> addresses = chip.registers.GetUsedAddresses(space);
+            out.Put(addresses.size(), 2);
+            for (const uint16_t addr : addresses)
+            {
+                out.Put(addr, 2);
+                out.Put(chip.registers.GetValue(space, addr), 2);
+            }
+        }
+    }
+    for (const std::vector<Channel>* channels : {&rxChannels, &txChannels})
+    {
+        out.Put(channels->size(), 2);
+        for (const Channel &ch : *channels)
+        {
+            out.PutDouble(ch.lpfBandwidth);
+            out.PutDouble(ch.ncoOffset);
+            out.PutDouble(ch.sampleRate);
+            out.PutDouble(ch.frequency);
+        }
+    }
+    out.Put(fpgaAddresses.size(), 2);
+    for (size_t i = 0; i < fpgaAddresses.size(); ++i)
+    {
+        out.Put(fpgaAddresses[i], 4);
+        out.Put(i < fpgaValues.size() ? fpgaValues[i] : 0, 4);
+    }
+}
+
+int LMS7_Snapshot::Deserialize(const uint8_t* data, const size_t length)
+{
+    if (length < sizeof(snapshotMagic) || memcmp(data, snapshotMagic, sizeof(snapshotMagic)) != 0)
+        return ReportError(EINVAL, "Snapshot: data is not a configuration snapshot");
+    Reader in(data+sizeof(snapshotMagic), length-sizeof(snapshotMagic));
+    uint64_t version = 0;
+    if (not in.Get(version, 2) || version != snapshotVersion)
+        return ReportError(EINVAL, "Snapshot: unsupported version %i", int(version));
+
+    LMS7_Snapshot decoded;
+    uint64_t count = 0;
+    if (not in.Get(count, 2) || count > in.Remaining()/chipMinSize)
+        return ReportError(EINVAL, "Snapshot: data is truncated");
+    decoded.chips.resize(count);
+    for (Chip &chip : decoded.chips)
+    {
+        if (not in.GetDouble(chip.refClkRx) || not in.GetDouble(chip.refClkTx))
+            return ReportError(EINVAL, "Snapshot: data is truncated");
+        for (int space = 0; space < 2; ++space)
+        {
+            if (not in.Get(count, 2))
+                return ReportError(EINVAL, "Snapshot: data is truncated");
+            for (uint64_t i = 0; i < count; ++i)
+            {
+                uint64_t addr, value;
+                if (not in.Get(addr, 2) || not in.Get(value, 2))
+                    return ReportError(EINVAL, "Snapshot: data is truncated");
+                if (addr >= LMS7002M_RegistersMap::addressCount)
+                    return ReportError(EINVAL, "Snapshot: register address 0x%04X is out of range", unsigned(addr));
+                chip.registers.SetValue(space, addr, value);
+            }
+        }
+    }
+    for (std::vector<Channel>* channels : {&decoded.rxChannels, &decoded.txChannels})
+    {
+        if (not in.Get(count, 2) || count > in.Remaining()/channelSize)
+            return ReportError(EINVAL, "Snapshot: data is truncated");
+        channels->resize(count);
+        for (Channel &ch : *channels)
+            if (not in.GetDouble(ch.lpfBandwidth) || not in.GetDouble(ch.ncoOffset)
+             || not in.GetDouble(ch.sampleRate) || not in.GetDouble(ch.frequency))
+                return ReportError(EINVAL, "Snapshot: data is truncated");
+    }
+    if (not in.Get(count, 2) || count > in.Remaining()/fpgaRegisterSize)
+        return ReportError(EINVAL, "Snapshot: data is truncated");
+    decoded.fpgaAddresses.resize(count);
+    decoded.fpgaValues.resize(count);
+    for (uint64_t i = 0; i < count; ++i)
+    {
+        uint64_t addr, value;
+        if (not in.Get(addr, 4) || not in.Get(value, 4))
+            return ReportError(EINVAL, "Snapshot: data is truncated");
+        decoded.fpgaAddresses[i] = addr;
+        decoded.fpgaValues[i] = value;
+    }
+    if (not in.AtEnd())
+        return ReportError(EINVAL, "Snapshot: unexpected data after end");
+
+    *this = std::move(decoded);
+    return 0;
+}
+
+int LMS7_Snapshot::Save(const char* filename) const
+{
+    std::vector<uint8_t> data;
+    Serialize(data);
+    std::ofstream fout(filename, std::ios::out | std::ios::binary);
+    if (not fout.good())
+        return ReportError(errno, "Snapshot: cannot open %s for writing", filename);
+    fout.write(reinterpret_cast<const char*>(data.data()), data.size());
+    if (not fout.good())
+        return ReportError(EIO, "Snapshot: failed to write %s", filename);
+    return 0;
+}
+
+int LMS7_Snapshot::Load(const char* filename)
+{
+    std::ifstream fin(filename, std::ios::in | std::ios::binary);
+    if (not fin.good())
+        return ReportError(errno, "Snapshot: cannot open %s", filename);
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(fin)), std::istreambuf_iterator<char>());
+    return Deserialize(data.data(), data.size());
+}
@@ -0,0 +1,68 @@
+/**
+    @file lms7_snapshot.h
+    @author Lime Microsystems
+    @brief In-memory device configuration snapshot.
+*/
+
+#ifndef LMS7_SNAPSHOT_H
+#define LMS7_SNAPSHOT_H
+#include "LimeSuiteConfig.h"
+#include "LMS7002M_RegistersMap.h"
+#include <cstdint>
+#include <vector>
+
+/*!
+ * LMS7_Snapshot holds complete configuration of a device: registers of both
+ * MAC channels of every chip (including SXR and SXT), selected FPGA registers
+ * and host side channel settings. Snapshots are captured and applied with
+ * LMS7_Device::CaptureSnapshot() and LMS7_Device::ApplySnapshot(), applying
+ * writes only registers differing from device.
+ *
+ * Snapshots can be stored in compact binary form, to switch between
+ * prepared profiles without tuning or calibrating at startup.
+ */
+class LIME_API LMS7_Snapshot
+{
+public:
+    struct Chip
+    {
+        lime::LMS7002M_RegistersMap registers;
+        double refClkRx;    ///<SXR reference clock, Hz
+        double refClkTx;    ///<SXT reference clock, Hz
+    };
+
+    //! Host side channel settings, not readable from chip
+    struct Channel
+    {
+        double lpfBandwidth;
+        double ncoOffset;
+        double sampleRate;
+        double frequency;
+    };
+
+    std::vector<Chip> chips;
+    std::vector<Channel> rxChannels;
+    std::vector<Channel> txChannels;
+    std::vector<uint32_t> fpgaAddresses;
+    std::vector<uint32_t> fpgaValues;
+
+    //! FPGA registers captured by default: channel enables and interface mode
+    static const std::vector<uint32_t> defaultFPGARegisters;
+
+    /** @brief Encodes snapshot in binary form
+        @param data receives encoded snapshot
+    */
+    void Serialize(std::vector<uint8_t> &data) const;
+
+    /** @brief Decodes snapshot encoded by Serialize()
+        @param data encoded snapshot
+        @param length size of data in bytes
+        @return 0-success, other-failure, snapshot is not modified
+    */
+    int Deserialize(const uint8_t* data, const size_t length);
+
+    int Save(const char* filename) const;
+    int Load(const char* filename);
+};
+
+#endif	/* LMS7_SNAPSHOT_H */
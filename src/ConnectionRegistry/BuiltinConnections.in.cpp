@@ -9,6 +9,7 @@
 #cmakedefine ENABLE_NOVENARF7
 #cmakedefine ENABLE_uLimeSDR
 #cmakedefine ENABLE_PCIE_XILLYBUS
+#cmakedefine ENABLE_REMOTE
 
 void __loadConnectionEVB7COMEntry(void);
 void __loadConnectionSTREAMEntry(void);
@@ -16,6 +17,7 @@ void __loadConnectionSTREAM_UNITEEntry(void);
 void __loadConnectionNovenaRF7Entry(void);
 void __loadConnection_uLimeSDREntry(void);
 void __loadConnectionXillybusEntry(void);
+void __loadConnectionRemoteEntry(void);
 
 void __loadAllConnections(void)
 {
@@ -42,4 +44,8 @@ void __loadAllConnections(void)
     #ifdef ENABLE_PCIE_XILLYBUS
     __loadConnectionXillybusEntry();
     #endif
+
+    #ifdef ENABLE_REMOTE
+    __loadConnectionRemoteEntry();
+    #endif
 }
@@ -6,6 +6,7 @@
 
 #include "IConnection.h"
 #include "ErrorReporting.h"
+#include "BufferPool.h"
 #include <cstring> //memcpy
 #include <chrono>
 #include <thread>
@@ -34,8 +35,47 @@ StreamConfig::StreamConfig(void):
     isTx(false),
     performanceLatency(0.5),
     bufferLength(0),
+    bufferFlags(BufferPool::PREFAULT),
+    numaNode(NUMA_AUTO),
     format(STREAM_12_BIT_IN_16),
+    int8Shift(4),
+    mergeBursts(false),
     linkFormat(STREAM_12_BIT_IN_16)
+{
+    resampling.interpolation = 1;
+    resampling.decimation = 1;
+    resampling.taps = 16;
+    resampling.passband = 0.8f;
+    resampling.stopband = 1.0f;
+    return;
+}
+
+PlaybackConfig::PlaybackConfig(void):
+    format(FILE_CS16),
+    channelsCount(1),
+    loop(false),
+    useTimestamp(false),
+    timestamp(0),
+    sampleRate(0)
+{
+    return;
+}
+
+IQCorrection::IQCorrection(void):
+    dcI(0),
+    dcQ(0)
+{
+    matrix[0][0] = 1;
+    matrix[0][1] = 0;
+    matrix[1][0] = 0;
+    matrix[1][1] = 1;
+}
+
+TriggerConfig::TriggerConfig(void):
+    level(0),
+    window(64),
+    preTriggerPackets(4),
+    postTriggerPackets(4)
 {
     return;
 }
@@ -221,6 +261,41 @@ int IConnection::UploadWFM(const void * const* samples, uint8_t chCount, size_t
     return ReportError(EPERM, "UploadTxWFM not implemented");
 }
 
+int IConnection::StartPlayback(const size_t streamID, const PlaybackConfig &config)
+{
+    return ReportError(EPERM, "StartPlayback not implemented");
+}
+
+int IConnection::StopPlayback(const size_t streamID)
+{
+    return ReportError(EPERM, "StopPlayback not implemented");
+}
+
+int IConnection::ShareStream(const size_t streamID, const std::string &name, const bool exclusive)
+{
+    return ReportError(EPERM, "ShareStream not implemented");
+}
+
+int IConnection::UnshareStream(const size_t streamID)
+{
+    return ReportError(EPERM, "UnshareStream not implemented");
+}
+
+int IConnection::SetupSubStream(size_t &subStreamID, const size_t streamID, const double frequencyOffset, const StreamConfig &config)
+{
+    return ReportError(EPERM, "SetupSubStream not implemented");
+}
+
+int IConnection::SetStreamCorrection(const size_t streamID, const IQCorrection* correction)
+{
+    return ReportError(EPERM, "SetStreamCorrection not implemented");
+}
+
+int IConnection::SetStreamTrigger(const size_t streamID, const TriggerConfig* config)
+{
+    return ReportError(EPERM, "SetStreamTrigger not implemented");
+}
+
 /** @brief Sets callback function which gets called each time data is sent or received
 */
 void IConnection::SetDataLogCallback(std::function<void(bool, const unsigned char*, const unsigned int)> callback)
@@ -138,6 +138,8 @@ struct LIME_API StreamConfig
         STREAM_12_BIT_IN_16,
         STREAM_12_BIT_COMPRESSED,
         STREAM_COMPLEX_FLOAT32,
+        STREAM_COMPLEX_INT8,
+        STREAM_COMPLEX_FLOAT16,
     };
 
     /*!
@@ -147,9 +149,63 @@ struct LIME_API StreamConfig
      */
     size_t bufferLength;
 
+    /*!
+     * Options for allocating FIFO and transfer buffers,
+     * combination of lime::BufferPool::Flags (prefault,
+     * huge pages, memory locking).
+     * Default: BufferPool::PREFAULT
+     */
+    unsigned bufferFlags;
+
+    //! Special values for numaNode
+    enum
+    {
+        NUMA_AUTO = -1, ///<node local to the device controller
+        NUMA_NONE = -2, ///<do not bind buffers and threads
+    };
+
+    /*!
+     * NUMA node for stream buffers and streaming threads.
+     * Default: NUMA_AUTO, used only on multi-node systems
+     */
+    int numaNode;
+
     //! The format of the samples in Read/WriteStream().
     StreamDataFormat format;
 
+    /*!
+     * Bit selection for STREAM_COMPLEX_INT8 format, number of
+     * least significant bits dropped from 12 bit samples.
+     * Range [0,8], smaller values add gain and saturate large samples.
+     * Default: 4, the 8 most significant bits
+     */
+    int int8Shift;
+
+    //! Host side rational resampling of receive streams
+    struct Resampling
+    {
+        uint32_t interpolation; ///<upsampling factor
+        uint32_t decimation;    ///<downsampling factor
+        uint32_t taps;          ///<filter taps per unit of the larger factor
+        float passband;         ///<passband edge, fraction of the lower Nyquist frequency
+        float stopband;         ///<stopband edge, fraction of the lower Nyquist frequency
+    };
+
+    /*!
+     * Read samples are resampled to device rate * interpolation / decimation,
+     * timestamps remain in device sample units.
+     * Default: 1/1, resampling disabled
+     */
+    Resampling resampling;
+
+    /*!
+     * TX only: Write() is called concurrently by several threads, each call
+     * is a separate burst with SYNC_TIMESTAMP. Bursts are merged by timestamp,
+     * overlapping and late bursts are dropped.
+     * Default: false
+     */
+    bool mergeBursts;
+
     /*!
      * The format of samples over the wire.
      * This is not the format presented to the API caller.
@@ -160,6 +216,81 @@ struct LIME_API StreamConfig
     StreamDataFormat linkFormat;
 };
 
+/*!
+ * Options for transmitting samples memory mapped from a file,
+ * see IConnection::StartPlayback().
+ */
+struct LIME_API PlaybackConfig
+{
+    PlaybackConfig(void);
+
+    //! Possible file sample formats
+    enum FileFormat
+    {
+        FILE_CS16,          ///<complex int16
+        FILE_CS12_PACKED,   ///<compressed link payload, 3 bytes per complex sample
+        FILE_CF32,          ///<complex float
+    };
+
+    //! Path of the file to transmit
+    std::string path;
+
+    //! Format of samples in the file
+    FileFormat format;
+
+    //! Number of interleaved channels in file, must match TX channels in use
+    uint8_t channelsCount;
+
+    //! Restart from the beginning of file when end is reached
+    bool loop;
+
+    //! Transmit first sample at given timestamp, otherwise immediately
+    bool useTimestamp;
+    uint64_t timestamp;
+
+    //! Sample rate of the file in Hz, checked against TX rate, 0 to skip the check
+    double sampleRate;
+};
+
+/*!
+ * Host side DC offset and IQ imbalance correction of received samples,
+ * see IConnection::SetStreamCorrection().
+ * Corrected sample [I Q]' = matrix * ([I Q] - dc)
+ */
+struct LIME_API IQCorrection
+{
+    IQCorrection(void);
+
+    //! DC offset in sample units, subtracted first
+    float dcI;
+    float dcQ;
+
+    //! Row major 2x2 matrix applied to [I Q], default identity
+    float matrix[2][2];
+};
+
+/*!
+ * Power trigger of received samples, see IConnection::SetStreamTrigger().
+ * Only packets around bursts reach the stream FIFO, each captured segment
+ * ends with END_BURST flag, so a read never spans two segments.
+ */
+struct LIME_API TriggerConfig
+{
+    TriggerConfig(void);
+
+    //! RMS amplitude over the window that starts capture, in sample units
+    float level;
+
+    //! Number of samples in sliding power window
+    uint32_t window;
+
+    //! Packets received before trigger that are kept and delivered
+    uint32_t preTriggerPackets;
+
+    //! Packets delivered after power falls below level, at least one
+    uint32_t postTriggerPackets;
+};
+
 /*!
  * IConnection is the interface class for a device with 1 or more Lime RFICs.
  * The LMS7002M driver class calls into IConnection to interface with the hardware
@@ -441,6 +572,69 @@ public:
     */
     virtual int UploadWFM(const void* const* samples, uint8_t chCount, size_t sample_count, StreamConfig::StreamDataFormat format, int epIndex);
 
+    /** @brief Transmits samples memory mapped from file instead of stream FIFO
+    When playback ends without looping, stream continues from its FIFO.
+    @param streamID TX stream, set up and started by caller
+    @param config playback options
+    @return 0 on success
+    */
+    virtual int StartPlayback(const size_t streamID, const PlaybackConfig &config);
+
+    /**	@brief Stops file playback, stream continues from its FIFO
+    @param streamID TX stream passed to StartPlayback()
+    @return 0 on success
+    */
+    virtual int StopPlayback(const size_t streamID);
+
+    /** @brief Publishes received samples to named shared memory ring
+    Other local processes attach to the ring with SharedStreamConsumer.
+    @param streamID RX stream
+    @param name shared memory object name, e.g. "/lime-rx0"
+    @param exclusive samples only go to the ring, stream FIFO is not filled
+    @return 0 on success
+    */
+    virtual int ShareStream(const size_t streamID, const std::string &name, const bool exclusive);
+
+    /**	@brief Stops publishing and removes shared memory ring
+    @param streamID RX stream passed to ShareStream()
+    @return 0 on success
+    */
+    virtual int UnshareStream(const size_t streamID);
+
+    /** @brief Creates narrowband stream extracted from wideband RX stream
+    Channel is shifted to baseband and resampled on the host as configured by
+    config.resampling. Once sub-streams are set up, wideband samples go only to
+    them and the wideband stream itself cannot be read. Sub-streams are started
+    and stopped individually, wideband stream has to be running for them to
+    receive samples. They are destroyed together with the wideband stream.
+    @param subStreamID returns sub-stream handle for ReadStream()
+    @param streamID wideband RX stream, must not be running
+    @param frequencyOffset channel center relative to stream center, Hz
+    @param config sub-stream format, FIFO size and resampling
+    @return 0 on success
+    */
+    virtual int SetupSubStream(size_t &subStreamID, const size_t streamID, const double frequencyOffset, const StreamConfig &config);
+
+    /** @brief Sets host side DC and IQ correction of received samples
+    Correction is applied to every packet after decoding. It can be changed
+    while streaming, each packet is corrected with either old or new
+    coefficients, never a mix of them.
+    @param streamID RX stream
+    @param correction coefficients, nullptr disables correction
+    @return 0 on success
+    */
+    virtual int SetStreamCorrection(const size_t streamID, const IQCorrection* correction);
+
+    /** @brief Enables triggered capture of received samples
+    Packets are kept in a ring on the host and only segments around bursts
+    are pushed to the stream FIFO, with their original timestamps.
+    Trigger can be changed while streaming.
+    @param streamID RX stream
+    @param config trigger settings, nullptr passes all samples again
+    @return 0 on success
+    */
+    virtual int SetStreamTrigger(const size_t streamID, const TriggerConfig* config);
+
     /**	@brief Read raw stream data from device streaming port
     @param buffer       read buffer pointer
     @param length       number of bytes to read
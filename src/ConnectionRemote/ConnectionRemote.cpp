@@ -0,0 +1,212 @@
+/**
+    @file ConnectionRemote.cpp
+    @author Lime Microsystems
+    @brief Connection to a board served by RemoteServer over TCP.
+*/
+
+#include "ConnectionRemote.h"
+#include "RemoteProtocol.h"
+#include "ErrorReporting.h"
+#include "Logger.h"
+#include <cerrno>
+#include <cstring>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include <ciso646>
+
+using namespace lime;
+
+ConnectionRemote::ConnectionRemote(const std::string &host, const int port) :
+    host(host),
+    port(port),
+    controlSocket(-1)
+{
+    RxLoopFunction = bind(&ConnectionRemote::ReceivePacketsLoop, this, std::placeholders::_1);
+    TxLoopFunction = bind(&ConnectionRemote::TransmitPacketsLoop, this, std::placeholders::_1);
+    refClockRate[0] = refClockRate[1] = 30.72e6;
+
+    controlSocket = remote::Connect(host, port);
+    if (controlSocket < 0)
+    {
+        ReportError(ECONNREFUSED, "Remote: failed to connect %s:%i", host.c_str(), port);
+        return;
+    }
+    remote::Hello hello = {remote::magic, remote::version, remote::CHANNEL_CONTROL, 0, 0, 0};
+    remote::ResponseHeader response;
+    if (remote::SendAll(controlSocket, &hello, sizeof(hello)) != 0
+        || remote::RecvAll(controlSocket, &response, sizeof(response), 1000) != 0
+        || response.status != 0)
+    {
+        ReportError(ECONNREFUSED, "Remote: %s:%i refused connection", host.c_str(), port);
+        close(controlSocket);
+        controlSocket = -1;
+        return;
+    }
+
+    for (int tx = 0; tx < 2; ++tx)
+    {
+        const uint32_t dir = tx;
+        std::vector<unsigned char> reply;
+        if (Request(remote::CMD_GET_REFERENCE_CLOCK, &dir, sizeof(dir), &reply) == 0 && reply.size() == sizeof(double))
+            memcpy(&refClockRate[tx], reply.data(), sizeof(double));
+    }
+}
+
+ConnectionRemote::~ConnectionRemote(void)
+{
+    for (auto i : mStreamers)
+        i->UpdateThreads(true);
+    if (controlSocket >= 0)
+        close(controlSocket);
+}
+
+bool ConnectionRemote::IsOpen(void)
+{
+    return controlSocket >= 0;
+}
+
+/** @brief Sends command to server and waits for its response
+    @param command remote::Command
+    @param data command parameters
+    @param length parameters size in bytes
+    @param reply returns response data, optional
+    @return status returned by server, -1 when connection failed
+*/
+int ConnectionRemote::Request(const uint32_t command, const void* data, const size_t length, std::vector<unsigned char>* reply)
+{
+    std::lock_guard<std::mutex> lock(controlLock);
+    if (controlSocket < 0)
+        return ReportError(ENOTCONN, "Remote: not connected");
+
+    remote::RequestHeader request = {command, uint32_t(length)};
+    remote::ResponseHeader response;
+    if (remote::SendAll(controlSocket, &request, sizeof(request)) != 0
+        || remote::SendAll(controlSocket, data, length) != 0
+        || remote::RecvAll(controlSocket, &response, sizeof(response)) != 0)
+    {
+        //stream state is unknown, connection can not be reused
+        close(controlSocket);
+        controlSocket = -1;
+        return ReportError(ECONNRESET, "Remote: connection to %s lost", host.c_str());
+    }
+    std::vector<unsigned char> payload(response.length);
+    if (response.length > 0 && remote::RecvAll(controlSocket, payload.data(), payload.size()) != 0)
+    {
+        close(controlSocket);
+        controlSocket = -1;
+        return ReportError(ECONNRESET, "Remote: connection to %s lost", host.c_str());
+    }
+    if (reply)
+        reply->swap(payload);
+    return response.status;
+}
+
+int ConnectionRemote::TransferPacket(GenericPacket& pkt)
+{
+    std::vector<unsigned char> data(sizeof(remote::PacketHeader) + pkt.outBuffer.size());
+    remote::PacketHeader header = {uint32_t(pkt.cmd), uint32_t(pkt.status), pkt.periphID};
+    memcpy(data.data(), &header, sizeof(header));
+    if (not pkt.outBuffer.empty())
+        memcpy(&data[sizeof(header)], pkt.outBuffer.data(), pkt.outBuffer.size());
+
+    std::vector<unsigned char> reply;
+    const int status = Request(remote::CMD_TRANSFER_PACKET, data.data(), data.size(), &reply);
+    if (reply.size() < sizeof(header))
+        return status != 0 ? status : ReportError(EPROTO, "Remote: invalid packet response");
+    memcpy(&header, reply.data(), sizeof(header));
+    pkt.status = eCMD_STATUS(header.status);
+    pkt.inBuffer.assign(reply.begin()+sizeof(header), reply.end());
+    return status;
+}
+
+int ConnectionRemote::Write(const unsigned char *, int, int)
+{
+    return ReportError(EPERM, "Remote: raw control access not supported");
+}
+
+int ConnectionRemote::Read(unsigned char *, int, int)
+{
+    return ReportError(EPERM, "Remote: raw control access not supported");
+}
+
+int ConnectionRemote::UpdateExternalDataRate(const size_t channel, const double txRate, const double rxRate)
+{
+    const remote::DataRate rate = {uint32_t(channel), 0, txRate, rxRate, 0, 0};
+    return Request(remote::CMD_UPDATE_DATA_RATE, &rate, sizeof(rate));
+}
+
+int ConnectionRemote::UpdateExternalDataRate(const size_t channel, const double txRate, const double rxRate, const double txPhase, const double rxPhase)
+{
+    const remote::DataRate rate = {uint32_t(channel), 1, txRate, rxRate, txPhase, rxPhase};
+    return Request(remote::CMD_UPDATE_DATA_RATE, &rate, sizeof(rate));
+}
+
+int ConnectionRemote::ResetStreamBuffers()
+{
+    return Request(remote::CMD_RESET_STREAM_BUFFERS, nullptr, 0);
+}
+
+int ConnectionRemote::SetReferenceClock(const bool tx, const double rate)
+{
+    const remote::ReferenceClock clock = {tx, rate};
+    const int status = Request(remote::CMD_SET_REFERENCE_CLOCK, &clock, sizeof(clock));
+    if (status == 0)
+        refClockRate[tx] = rate;
+    return status;
+}
+
+double ConnectionRemote::GetReferenceClockRate(void)
+{
+    return refClockRate[0];
+}
+
+int ConnectionRemote::SetReferenceClockRate(const double rate)
+{
+    return SetReferenceClock(false, rate);
+}
+
+double ConnectionRemote::GetTxReferenceClockRate(void)
+{
+    return refClockRate[1];
+}
+
+int ConnectionRemote::SetTxReferenceClockRate(const double rate)
+{
+    return SetReferenceClock(true, rate);
+}
+
+/** @brief Opens socket for stream packets, server starts forwarding device packets
+    @param stream streamer using the socket
+    @param tx transmit direction
+    @return socket descriptor, -1 on failure
+*/
+int ConnectionRemote::OpenDataSocket(Streamer* stream, const bool tx)
+{
+    StreamChannel* channel = tx ? stream->mTxStreams[0] : stream->mRxStreams[0];
+    const bool packed = channel->config.linkFormat == StreamConfig::STREAM_12_BIT_COMPRESSED;
+    const int fd = remote::Connect(host, port);
+    if (fd < 0)
+    {
+        ReportError(ECONNREFUSED, "Remote: failed to open data connection");
+        return -1;
+    }
+    //do not block stream threads for long on stalled server
+    struct timeval tv = {1, 0};
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+
+    remote::Hello hello = {remote::magic, remote::version,
+        uint32_t(tx ? remote::CHANNEL_TX : remote::CHANNEL_RX),
+        uint32_t(stream->streamSize), packed, channel->config.performanceLatency};
+    remote::ResponseHeader response;
+    if (remote::SendAll(fd, &hello, sizeof(hello)) != 0
+        || remote::RecvAll(fd, &response, sizeof(response), 5000) != 0
+        || response.status != 0)
+    {
+        ReportError(EIO, "Remote: server failed to start %s stream", tx ? "TX" : "RX");
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
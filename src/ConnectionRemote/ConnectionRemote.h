@@ -0,0 +1,72 @@
+/**
+    @file ConnectionRemote.h
+    @author Lime Microsystems
+    @brief Connection to a board served by RemoteServer over TCP.
+*/
+
+#pragma once
+#include <ConnectionRegistry.h>
+#include <ILimeSDRStreaming.h>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace lime{
+
+/*!
+ * ConnectionRemote tunnels LMS64C control packets to RemoteServer and
+ * exchanges raw FPGA packets on separate RX and TX sockets, so the link
+ * format (3 bytes per sample when compressed) is kept on the network.
+ */
+class ConnectionRemote : public ILimeSDRStreaming
+{
+public:
+    ConnectionRemote(const std::string &host, const int port);
+    ~ConnectionRemote(void);
+
+    bool IsOpen(void) override;
+    int TransferPacket(GenericPacket &pkt) override;
+
+    //control goes through TransferPacket, raw access is not available
+    int Write(const unsigned char *buffer, int length, int timeout_ms = 100) override;
+    int Read(unsigned char *buffer, int length, int timeout_ms = 100) override;
+
+    int UpdateExternalDataRate(const size_t channel, const double txRate, const double rxRate) override;
+    int UpdateExternalDataRate(const size_t channel, const double txRate, const double rxRate, const double txPhase, const double rxPhase) override;
+    double GetReferenceClockRate(void) override;
+    int SetReferenceClockRate(const double rate) override;
+    double GetTxReferenceClockRate(void) override;
+    int SetTxReferenceClockRate(const double rate) override;
+
+protected:
+    void ReceivePacketsLoop(Streamer* args) override;
+    void TransmitPacketsLoop(Streamer* args) override;
+    int ResetStreamBuffers() override;
+
+private:
+    eConnectionType GetType(void) override
+    {
+        return TCP_PORT;
+    }
+
+    int Request(const uint32_t command, const void* data, const size_t length, std::vector<unsigned char>* reply = nullptr);
+    int OpenDataSocket(Streamer* stream, const bool tx);
+    int SetReferenceClock(const bool tx, const double rate);
+
+    std::string host;
+    int port;
+    int controlSocket;
+    std::mutex controlLock;
+    double refClockRate[2];     ///<cached server reference clocks, RX and TX
+};
+
+class ConnectionRemoteEntry : public ConnectionRegistryEntry
+{
+public:
+    ConnectionRemoteEntry(void);
+    ~ConnectionRemoteEntry(void);
+    std::vector<ConnectionHandle> enumerate(const ConnectionHandle &hint);
+    IConnection *make(const ConnectionHandle &handle);
+};
+
+}
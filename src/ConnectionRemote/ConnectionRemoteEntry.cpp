@@ -0,0 +1,89 @@
+/**
+    @file ConnectionRemoteEntry.cpp
+    @author Lime Microsystems
+    @brief Registry entry of remote device connection.
+*/
+
+#include "ConnectionRemote.h"
+#include "RemoteProtocol.h"
+#include <unistd.h>
+#include <ciso646>
+
+using namespace lime;
+
+//! make a static-initialized entry in the registry
+void __loadConnectionRemoteEntry(void) //TODO fixme replace with LoadLibrary/dlopen
+{
+    static ConnectionRemoteEntry remoteEntry;
+}
+
+ConnectionRemoteEntry::ConnectionRemoteEntry(void):
+    ConnectionRegistryEntry("Remote")
+{
+}
+
+ConnectionRemoteEntry::~ConnectionRemoteEntry(void)
+{
+}
+
+//! splits "host:port" address, port is optional, IPv6 hosts are given as [::1]:5540
+static void ParseAddress(const std::string &addr, std::string &host, int &port)
+{
+    host = addr;
+    port = remote::defaultPort;
+    size_t colon = std::string::npos;
+    if (not addr.empty() && addr[0] == '[')
+    {
+        const size_t bracket = addr.find(']');
+        host = addr.substr(1, bracket-1);
+        if (bracket != std::string::npos && bracket+1 < addr.size() && addr[bracket+1] == ':')
+            colon = bracket+1;
+    }
+    else if (addr.find(':') == addr.rfind(':'))
+    {
+        colon = addr.find(':');
+        host = addr.substr(0, colon);
+    }
+    if (colon != std::string::npos)
+        port = std::stoi(addr.substr(colon+1));
+}
+
+std::vector<ConnectionHandle> ConnectionRemoteEntry::enumerate(const ConnectionHandle &hint)
+{
+    std::vector<ConnectionHandle> handles;
+    //servers are not discovered, address has to be given
+    if (hint.addr.empty() || (not hint.module.empty() && hint.module != "Remote"))
+        return handles;
+    if (not hint.media.empty() && hint.media != "TCP")
+        return handles;
+
+    std::string host;
+    int port;
+    try
+    {
+        ParseAddress(hint.addr, host, port);
+    }
+    catch (const std::exception &)
+    {
+        return handles;
+    }
+    const int fd = remote::Connect(host, port);
+    if (fd < 0)
+        return handles;
+    close(fd);
+
+    ConnectionHandle handle;
+    handle.media = "TCP";
+    handle.name = "Remote";
+    handle.addr = hint.addr;
+    handles.push_back(handle);
+    return handles;
+}
+
+IConnection *ConnectionRemoteEntry::make(const ConnectionHandle &handle)
+{
+    std::string host;
+    int port;
+    ParseAddress(handle.addr, host, port);
+    return new ConnectionRemote(host, port);
+}
@@ -0,0 +1,250 @@
+/**
+    @file ConnectionRemoteing.cpp
+    @author Lime Microsystems
+    @brief Remote connection streaming, packets are exchanged in link format.
+*/
+
+#include "ConnectionRemote.h"
+#include "RemoteProtocol.h"
+#include "BufferPool.h"
+#include "FPGA_common.h"
+#include "ErrorReporting.h"
+#include "Logger.h"
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <thread>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <ciso646>
+
+using namespace std;
+using namespace lime;
+
+/** @brief Function dedicated for receiving packets forwarded by server
+    @param stream an active receive stream
+*/
+void ConnectionRemote::ReceivePacketsLoop(Streamer* stream)
+{
+    //at this point FPGA has to be already configured to output samples
+    const uint8_t chCount = stream->streamSize;
+    const bool packed = stream->mRxStreams[0]->config.linkFormat == StreamConfig::STREAM_12_BIT_COMPRESSED;
+    const uint32_t samplesInPacket = (packed ? samples12InPkt : samples16InPkt)/chCount;
+
+    const uint32_t packetsToBatch = stream->rxBatchSize;
+    const uint32_t bufferSize = packetsToBatch*sizeof(FPGA_DataPacket);
+    PooledBuffer<char> buffers;
+    vector<StreamChannel::Frame> chFrames;
+    try
+    {
+        buffers.Allocate(bufferSize, stream->mRxStreams[0]->config.bufferFlags, stream->GetNumaNode(false));
+        chFrames.resize(chCount);
+    }
+    catch (const std::bad_alloc &ex)
+    {
+        ReportError("Error allocating Rx buffers, not enough memory");
+        return;
+    }
+
+    const int fd = OpenDataSocket(stream, false);
+    if (fd < 0)
+        return;
+
+    std::mutex txFlagsLock;
+    condition_variable resetTxFlags;
+    //worker thread for reseting late Tx packet flags
+    std::thread txReset([](ILimeSDRStreaming* port,
+                        atomic<bool> *terminate,
+                        mutex *spiLock,
+                        condition_variable *doWork)
+    {
+        uint32_t reg9;
+        port->ReadRegister(0x0009, reg9);
+        const uint32_t addr[] = {0x0009, 0x0009};
+        const uint32_t data[] = {reg9 | (5 << 1), reg9 & ~(5 << 1)};
+        while (not terminate->load())
+        {
+            std::unique_lock<std::mutex> lck(*spiLock);
+            doWork->wait(lck);
+            port->WriteRegisters(addr, data, 2);
+        }
+    }, this, &stream->terminateRx, &txFlagsLock, &resetTxFlags);
+
+    unsigned long totalBytesReceived = 0; //for data rate calculation
+    auto t1 = chrono::high_resolution_clock::now();
+    auto t2 = t1;
+
+    int resetFlagsDelay = 128;
+    uint64_t prevTs = 0;
+    uint32_t bytesBuffered = 0;
+    while (stream->terminateRx.load() == false)
+    {
+        struct pollfd pfd = {fd, POLLIN, 0};
+        if (poll(&pfd, 1, 100) <= 0)
+            continue;
+        //TCP delivers arbitrary chunks, only complete packets are parsed
+        const ssize_t bytesReceived = recv(fd, &buffers[bytesBuffered], bufferSize-bytesBuffered, 0);
+        if (bytesReceived <= 0)
+        {
+            if (bytesReceived < 0 && (errno == EINTR || errno == EAGAIN))
+                continue;
+            lime::error("Remote: RX connection lost");
+            break;
+        }
+        bytesBuffered += bytesReceived;
+        totalBytesReceived += bytesReceived;
+        const uint32_t packetsCount = bytesBuffered / sizeof(FPGA_DataPacket);
+
+        //streams of channels are not replaced while packets are delivered
+        std::unique_lock<std::mutex> streamsLock(stream->rxStreamsLock);
+        bool txLate=false;
+        for (uint32_t pktIndex = 0; pktIndex < packetsCount; ++pktIndex)
+        {
+            const FPGA_DataPacket* pkt = (FPGA_DataPacket*)&buffers[0];
+            const uint8_t byte0 = pkt[pktIndex].reserved[0];
+            if ((byte0 & (1 << 3)) != 0 && !txLate) //report only once per batch
+            {
+                txLate = true;
+                if(resetFlagsDelay > 0)
+                    --resetFlagsDelay;
+                else
+                {
+                    lime::info("L");
+                    resetTxFlags.notify_one();
+                    resetFlagsDelay = packetsToBatch*2;
+                    stream->txLastLateTime.store(pkt[pktIndex].counter);
+                    for(auto value: stream->mTxStreams)
+                        if (value && value->mActive)
+                            value->pktLost++;
+                }
+            }
+            uint8_t* pktStart = (uint8_t*)pkt[pktIndex].data;
+            if(pkt[pktIndex].counter - prevTs != samplesInPacket && pkt[pktIndex].counter != prevTs)
+            {
+                int packetLoss = ((pkt[pktIndex].counter - prevTs)/samplesInPacket)-1;
+                for(auto value: stream->mRxStreams)
+                    if (value && value->mActive)
+                        value->pktLost += packetLoss;
+            }
+            prevTs = pkt[pktIndex].counter;
+            stream->rxLastTimestamp.store(pkt[pktIndex].counter);
+            //parse samples, directly to waiting reader's buffer if possible
+            complex16_t* dest[2];
+            StreamChannel* receiving[2] = {nullptr, nullptr};
+            for(uint8_t c=0; c<chCount; ++c)
+            {
+                if (stream->mRxStreams[c]==nullptr || stream->mRxStreams[c]->IsReceiving()==false)
+                    dest[c] = chFrames[c].samples;
+                else
+                {
+                    receiving[c] = stream->mRxStreams[c];
+                    dest[c] = receiving[c]->AcquirePacketBuffer(chFrames[c], samplesInPacket, pkt[pktIndex].counter);
+                }
+            }
+            int samplesCount = fpga::FPGAPacketPayload2Samples(pktStart, 4080, chCount==2, packed, dest);
+
+            for(int ch=0; ch<chCount; ++ch)
+            {
+                //committed to the same stream that acquired the buffer
+                if (receiving[ch]==nullptr)
+                    continue;
+                IStreamChannel::Metadata meta;
+                meta.timestamp = pkt[pktIndex].counter;
+                meta.flags = IStreamChannel::Metadata::OVERWRITE_OLD;
+                int samplesPushed = receiving[ch]->CommitPacketBuffer(samplesCount, &meta, 100);
+                if(samplesPushed != samplesCount)
+                    receiving[ch]->overflow++;
+            }
+        }
+        streamsLock.unlock();
+        //keep incomplete packet for the next read
+        const uint32_t bytesParsed = packetsCount*sizeof(FPGA_DataPacket);
+        memmove(&buffers[0], &buffers[bytesParsed], bytesBuffered-bytesParsed);
+        bytesBuffered -= bytesParsed;
+
+        t2 = chrono::high_resolution_clock::now();
+        auto timePeriod = std::chrono::duration_cast<std::chrono::milliseconds>(t2 - t1).count();
+        if (timePeriod >= 1000)
+        {
+            t1 = t2;
+            //total number of bytes received per second
+            double dataRate = 1000.0*totalBytesReceived / timePeriod;
+            totalBytesReceived = 0;
+            stream->rxDataRate_Bps.store((uint32_t)dataRate);
+        }
+    }
+    //server stops forwarding when connection is closed
+    close(fd);
+    resetTxFlags.notify_one();
+    txReset.join();
+    stream->rxDataRate_Bps.store(0);
+}
+
+/** @brief Functions dedicated for transmitting packets to server
+    @param stream an active transmit stream
+*/
+void ConnectionRemote::TransmitPacketsLoop(Streamer* stream)
+{
+    //at this point FPGA has to be already configured to output samples
+    const bool packed = stream->mTxStreams[0]->config.linkFormat == StreamConfig::STREAM_12_BIT_COMPRESSED;
+    const uint32_t packetsToBatch = stream->txBatchSize;
+    const uint32_t bufferSize = packetsToBatch*sizeof(FPGA_DataPacket);
+    const uint32_t popTimeout_ms = 500;
+    PooledBuffer<char> buffers;
+    try
+    {
+        buffers.Allocate(bufferSize, stream->mTxStreams[0]->config.bufferFlags, stream->GetNumaNode(true));
+        memset(buffers.Data(), 0, bufferSize);
+    }
+    catch (const std::bad_alloc& ex) //not enough memory for buffers
+    {
+        lime::error("Error allocating Tx buffers, not enough memory");
+        return;
+    }
+
+    const int fd = OpenDataSocket(stream, true);
+    if (fd < 0)
+        return;
+
+    long totalBytesSent = 0;
+    auto t1 = chrono::high_resolution_clock::now();
+    auto t2 = t1;
+
+    while (stream->terminateTx.load() != true)
+    {
+        //take samples for the whole transfer at once
+        FPGA_DataPacket* pkt = reinterpret_cast<FPGA_DataPacket*>(&buffers[0]);
+        const int packetsFilled = stream->FillTxPackets(pkt, packetsToBatch, packed, popTimeout_ms);
+        if (packetsFilled < 0)
+            stream->terminateTx.store(true);
+
+        if(stream->terminateTx.load() == true) //early termination
+            break;
+        //forwarder had nothing to send, no empty transfers
+        if (packetsFilled == 0)
+            continue;
+
+        const uint32_t bytesToSend = packetsFilled*sizeof(FPGA_DataPacket);
+        if (remote::SendAll(fd, &buffers[0], bytesToSend) != 0)
+        {
+            lime::error("Remote: TX connection lost");
+            break;
+        }
+        totalBytesSent += bytesToSend;
+
+        t2 = chrono::high_resolution_clock::now();
+        auto timePeriod = std::chrono::duration_cast<std::chrono::milliseconds>(t2 - t1).count();
+        if (timePeriod >= 1000)
+        {
+            //total number of bytes sent per second
+            float dataRate = 1000.0*totalBytesSent / timePeriod;
+            stream->txDataRate_Bps.store(dataRate);
+            totalBytesSent = 0;
+            t1 = t2;
+        }
+    }
+    close(fd);
+    stream->txDataRate_Bps.store(0);
+}
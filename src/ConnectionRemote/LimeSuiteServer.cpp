@@ -0,0 +1,107 @@
+/**
+    @file LimeSuiteServer.cpp
+    @author Lime Microsystems
+    @brief Shares local board with remote LimeSuite clients
+*/
+
+#include "RemoteServer.h"
+#include "RemoteProtocol.h"
+#include "ConnectionRegistry.h"
+#include "IConnection.h"
+#include "ErrorReporting.h"
+#include <iostream>
+#include <cstdlib>
+#include <csignal>
+#include <string>
+#include <chrono>
+#include <thread>
+#include <getopt.h>
+
+using namespace lime;
+
+static volatile sig_atomic_t stopServer = 0;
+
+static void sigIntHandler(const int)
+{
+    stopServer = 1;
+}
+
+static void printHelp(void)
+{
+    std::cout << "Usage LimeSuiteServer [options]" << std::endl;
+    std::cout << "    --help\t\t\t\t Print this help message" << std::endl;
+    std::cout << "    --args[=\"module=foo,serial=bar\"] \t Board to share, first found by default" << std::endl;
+    std::cout << "    --bind[=\"127.0.0.1\"] \t\t Local address to listen on, \"0.0.0.0\" for all" << std::endl;
+    std::cout << "    --port[=" << remote::defaultPort << "] \t\t\t TCP port to listen on" << std::endl;
+    std::cout << std::endl;
+    std::cout << "Clients open the board with args \"module=Remote,addr=host:port\"" << std::endl;
+    std::cout << "Clients are not authenticated, bind to other interfaces only on trusted networks" << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+    std::string argStr;
+    std::string bindStr;
+    int port = remote::defaultPort;
+
+    static struct option long_options[] = {
+        {"help", no_argument, 0, 'h'},
+        {"args", required_argument, 0, 'a'},
+        {"bind", required_argument, 0, 'b'},
+        {"port", required_argument, 0, 'p'},
+        {0, 0, 0,  0}
+    };
+
+    int long_index = 0;
+    int option = 0;
+    while ((option = getopt_long_only(argc, argv, "", long_options, &long_index)) != -1)
+    {
+        switch (option)
+        {
+        case 'h': printHelp(); return EXIT_SUCCESS;
+        case 'a': if (optarg != NULL) argStr = optarg; break;
+        case 'b': if (optarg != NULL) bindStr = optarg; break;
+        case 'p': if (optarg != NULL) port = std::stoi(optarg); break;
+        default: printHelp(); return EXIT_FAILURE;
+        }
+    }
+
+    auto handles = ConnectionRegistry::findConnections(ConnectionHandle(argStr));
+    //do not serve other servers
+    for (auto it = handles.begin(); it != handles.end();)
+        it = (it->module == "Remote") ? handles.erase(it) : it+1;
+    if (handles.empty())
+    {
+        std::cerr << "No board found" << std::endl;
+        return EXIT_FAILURE;
+    }
+    IConnection* conn = ConnectionRegistry::makeConnection(handles.front());
+    if (conn == nullptr)
+    {
+        std::cerr << "Failed to open " << handles.front().ToString() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    int status = EXIT_SUCCESS;
+    {
+        RemoteServer server(conn);
+        if (server.Start(bindStr, port) != 0)
+        {
+            std::cerr << "Failed to start server: " << GetLastErrorMessage() << std::endl;
+            status = EXIT_FAILURE;
+        }
+        else
+        {
+            std::cout << "Serving " << handles.front().ToString() << " on port " << server.GetPort()
+                      << ", press Ctrl+C to stop" << std::endl;
+            signal(SIGINT, sigIntHandler);
+            signal(SIGTERM, sigIntHandler);
+            while (!stopServer)
+                std::this_thread::sleep_for(std::chrono::milliseconds(200));
+            signal(SIGINT, SIG_DFL);
+            signal(SIGTERM, SIG_DFL);
+        }
+    }
+    ConnectionRegistry::freeConnection(conn);
+    return status;
+}
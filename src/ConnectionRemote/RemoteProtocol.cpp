@@ -0,0 +1,84 @@
+/**
+    @file RemoteProtocol.cpp
+    @author Lime Microsystems
+    @brief Messages and socket helpers of remote device connection.
+*/
+
+#include "RemoteProtocol.h"
+#include <cstring>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+using namespace lime;
+
+int remote::Connect(const std::string &host, const int port)
+{
+    struct addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    struct addrinfo* result = nullptr;
+    if (getaddrinfo(host.c_str(), std::to_string(port).c_str(), &hints, &result) != 0)
+        return -1;
+
+    int fd = -1;
+    for (struct addrinfo* ai = result; ai != nullptr; ai = ai->ai_next)
+    {
+        fd = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+        if (fd < 0)
+            continue;
+        if (connect(fd, ai->ai_addr, ai->ai_addrlen) == 0)
+            break;
+        close(fd);
+        fd = -1;
+    }
+    freeaddrinfo(result);
+    if (fd >= 0)
+    {
+        //control transfers are small request/response pairs
+        const int flag = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof(flag));
+    }
+    return fd;
+}
+
+int remote::SendAll(const int fd, const void* data, const size_t length)
+{
+    const char* ptr = static_cast<const char*>(data);
+    size_t sent = 0;
+    while (sent < length)
+    {
+        const ssize_t ret = send(fd, ptr + sent, length - sent, MSG_NOSIGNAL);
+        if (ret <= 0)
+            return -1;
+        sent += ret;
+    }
+    return 0;
+}
+
+int remote::RecvAll(const int fd, void* data, const size_t length, const int timeout_ms)
+{
+    if (timeout_ms >= 0)
+    {
+        struct pollfd pfd = {fd, POLLIN, 0};
+        const int ret = poll(&pfd, 1, timeout_ms);
+        if (ret == 0)
+            return 1;
+        if (ret < 0)
+            return -1;
+    }
+    char* ptr = static_cast<char*>(data);
+    size_t received = 0;
+    while (received < length)
+    {
+        const ssize_t ret = recv(fd, ptr + received, length - received, 0);
+        if (ret <= 0)
+            return -1;
+        received += ret;
+    }
+    return 0;
+}
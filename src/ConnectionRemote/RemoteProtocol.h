@@ -0,0 +1,101 @@
+/**
+    @file RemoteProtocol.h
+    @author Lime Microsystems
+    @brief Messages and socket helpers of remote device connection.
+*/
+
+#pragma once
+#include <stdint.h>
+#include <string>
+
+namespace lime{
+namespace remote{
+
+/*!
+ * Every TCP connection starts with Hello telling its purpose. Control
+ * connection carries Request/Response pairs, RX and TX connections carry
+ * raw FPGA_DataPacket stream in link format, samples are not converted.
+ * Values are sent in host byte order, both sides are expected to be
+ * little endian.
+ */
+static const uint16_t defaultPort = 5540;
+static const uint32_t magic = 0x52534D4C; //"LMSR"
+static const uint32_t version = 1;
+
+enum ChannelType
+{
+    CHANNEL_CONTROL = 0,
+    CHANNEL_RX = 1,
+    CHANNEL_TX = 2,
+};
+
+struct Hello
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t type;          ///<ChannelType
+    uint32_t channelsCount; ///<data channels: channels in link packets
+    uint32_t packed;        ///<data channels: 12 bit compressed link
+    float latency;          ///<data channels: latency versus throughput
+};
+
+enum Command
+{
+    CMD_TRANSFER_PACKET = 1,    ///<PacketHeader and outBuffer, returns inBuffer
+    CMD_RESET_STREAM_BUFFERS,
+    CMD_UPDATE_DATA_RATE,       ///<DataRate
+    CMD_GET_REFERENCE_CLOCK,    ///<uint32_t tx, returns double
+    CMD_SET_REFERENCE_CLOCK,    ///<ReferenceClock
+};
+
+struct RequestHeader
+{
+    uint32_t command;
+    uint32_t length;    ///<bytes following header
+};
+
+struct ResponseHeader
+{
+    int32_t status;
+    uint32_t length;    ///<bytes following header
+};
+
+struct PacketHeader
+{
+    uint32_t cmd;
+    uint32_t status;
+    uint32_t periphID;
+};
+
+struct DataRate
+{
+    uint32_t channel;
+    uint32_t withPhase;
+    double txRate;
+    double rxRate;
+    double txPhase;
+    double rxPhase;
+};
+
+struct ReferenceClock
+{
+    uint32_t tx;
+    double rate;
+};
+
+/** @brief Connects TCP socket
+    @return socket descriptor, -1 on failure
+*/
+int Connect(const std::string &host, const int port);
+
+//! @brief Sends whole buffer, returns 0 on success
+int SendAll(const int fd, const void* data, const size_t length);
+
+/** @brief Receives whole buffer
+    @param timeout_ms timeout for the first byte, -1 to wait forever
+    @return 0 on success, 1 on timeout without data, -1 on error or closed connection
+*/
+int RecvAll(const int fd, void* data, const size_t length, const int timeout_ms = -1);
+
+}
+}
@@ -0,0 +1,424 @@
+/**
+    @file RemoteServer.cpp
+    @author Lime Microsystems
+    @brief Serves local board to ConnectionRemote clients over TCP.
+*/
+
+#include "RemoteServer.h"
+#include "RemoteProtocol.h"
+#include "ILimeSDRStreaming.h"
+#include "ErrorReporting.h"
+#include "Logger.h"
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <vector>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <ciso646>
+
+using namespace lime;
+
+namespace{
+
+//! Bounded queue of link packets between socket and device threads
+class PacketQueue
+{
+public:
+    PacketQueue(const size_t capacity) :
+        packets(capacity), head(0), count(0), aborted(false)
+    {
+    }
+
+    //! @brief Adds packets that fit, waits up to timeout for space, returns number added
+    int Push(const FPGA_DataPacket* src, const int packetsCount, const int timeout_ms)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (count == packets.size() && timeout_ms > 0)
+            canPush.wait_for(lock, std::chrono::milliseconds(timeout_ms), [this]{return count < packets.size() || aborted;});
+        const int n = std::min<size_t>(packetsCount, packets.size()-count);
+        for (int i = 0; i < n; ++i)
+            packets[(head+count+i) % packets.size()] = src[i];
+        count += n;
+        lock.unlock();
+        if (n > 0)
+            canPop.notify_one();
+        return n;
+    }
+
+    //! @brief Takes available packets, waits up to timeout if empty, returns number taken
+    int Pop(FPGA_DataPacket* dest, const int packetsCount, const int timeout_ms)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (count == 0)
+            canPop.wait_for(lock, std::chrono::milliseconds(timeout_ms), [this]{return count > 0 || aborted;});
+        const int n = std::min<size_t>(packetsCount, count);
+        for (int i = 0; i < n; ++i)
+            dest[i] = packets[(head+i) % packets.size()];
+        head = (head+n) % packets.size();
+        count -= n;
+        lock.unlock();
+        if (n > 0)
+            canPush.notify_one();
+        return n;
+    }
+
+    //! @brief Releases waiting threads
+    void Abort()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        aborted = true;
+        canPush.notify_all();
+        canPop.notify_all();
+    }
+
+private:
+    std::vector<FPGA_DataPacket> packets;
+    size_t head;
+    size_t count;
+    bool aborted;
+    std::mutex mutex;
+    std::condition_variable canPush;
+    std::condition_variable canPop;
+};
+
+//! Moves device packets through the queue, receive side never blocks device thread
+class QueueForwarder : public ILimeSDRStreaming::PacketForwarder
+{
+public:
+    QueueForwarder(PacketQueue &queue) : queue(queue), dropped(0) {}
+
+    void PushRxPackets(const FPGA_DataPacket* packets, const int count) override
+    {
+        dropped += count - queue.Push(packets, count, 0);
+    }
+
+    int PopTxPackets(FPGA_DataPacket* packets, const int count, const int32_t timeout_ms) override
+    {
+        return queue.Pop(packets, count, timeout_ms);
+    }
+
+    PacketQueue &queue;
+    std::atomic<uint64_t> dropped;
+};
+
+static const int rxQueuePackets = 1024;
+static const int txQueuePackets = 256;
+static const size_t maxRequestLength = 1 << 20;
+
+}
+
+RemoteServer::RemoteServer(IConnection* device) :
+    device(dynamic_cast<ILimeSDRStreaming*>(device)),
+    listenSocket(-1),
+    port(0),
+    running(false)
+{
+}
+
+RemoteServer::~RemoteServer()
+{
+    Stop();
+}
+
+int RemoteServer::Start(const std::string &bindAddress, const int port)
+{
+    if (device == nullptr)
+        return ReportError(EINVAL, "RemoteServer: device does not support streaming");
+    Stop();
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    //clients are not authenticated, other interfaces must be asked for
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (not bindAddress.empty() && inet_pton(AF_INET, bindAddress.c_str(), &addr.sin_addr) != 1)
+        return ReportError(EINVAL, "RemoteServer: invalid address %s", bindAddress.c_str());
+
+    listenSocket = socket(AF_INET, SOCK_STREAM, 0);
+    if (listenSocket < 0)
+        return ReportError(errno, "RemoteServer: failed to create socket");
+    const int flag = 1;
+    setsockopt(listenSocket, SOL_SOCKET, SO_REUSEADDR, &flag, sizeof(flag));
+    socklen_t addrLength = sizeof(addr);
+    if (bind(listenSocket, (struct sockaddr*)&addr, sizeof(addr)) != 0
+        || listen(listenSocket, 8) != 0
+        || getsockname(listenSocket, (struct sockaddr*)&addr, &addrLength) != 0)
+    {
+        const int err = errno;
+        close(listenSocket);
+        listenSocket = -1;
+        return ReportError(err, "RemoteServer: failed to listen on port %i", port);
+    }
+    this->port = ntohs(addr.sin_port);
+    running.store(true);
+    acceptThread = std::thread(&RemoteServer::AcceptLoop, this);
+    return 0;
+}
+
+void RemoteServer::Stop()
+{
+    if (not running.exchange(false))
+        return;
+    acceptThread.join();
+    close(listenSocket);
+    listenSocket = -1;
+    std::lock_guard<std::mutex> lock(clientsLock);
+    for (auto &client : clients)
+    {
+        shutdown(client.socket, SHUT_RDWR);
+        client.thread.join();
+        close(client.socket);
+    }
+    clients.clear();
+}
+
+void RemoteServer::AcceptLoop()
+{
+    while (running.load())
+    {
+        struct pollfd pfd = {listenSocket, POLLIN, 0};
+        if (poll(&pfd, 1, 200) <= 0)
+            continue;
+        const int fd = accept(listenSocket, nullptr, nullptr);
+        if (fd < 0)
+            continue;
+        const int flag = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof(flag));
+
+        std::lock_guard<std::mutex> lock(clientsLock);
+        //release finished clients
+        for (auto it = clients.begin(); it != clients.end();)
+        {
+            if (not it->done.load())
+            {
+                ++it;
+                continue;
+            }
+            it->thread.join();
+            close(it->socket);
+            it = clients.erase(it);
+        }
+        clients.emplace_back();
+        Client &client = clients.back();
+        client.socket = fd;
+        client.done.store(false);
+        client.thread = std::thread(&RemoteServer::ServeClient, this, &client);
+    }
+}
+
+void RemoteServer::ServeClient(Client* client)
+{
+    remote::Hello hello;
+    const int fd = client->socket;
+    if (remote::RecvAll(fd, &hello, sizeof(hello), 1000) != 0
+        || hello.magic != remote::magic || hello.version != remote::version)
+    {
+        //port probing by enumeration, or incompatible client
+        client->done.store(true);
+        return;
+    }
+
+    const bool packed = hello.packed != 0;
+    const int channelsCount = hello.channelsCount;
+    switch (hello.type)
+    {
+    case remote::CHANNEL_CONTROL:
+    {
+        remote::ResponseHeader response = {0, 0};
+        if (remote::SendAll(fd, &response, sizeof(response)) == 0)
+            ServeControl(fd);
+        break;
+    }
+    case remote::CHANNEL_RX:
+        ServeRx(fd, channelsCount, packed, hello.latency);
+        break;
+    case remote::CHANNEL_TX:
+        ServeTx(fd, channelsCount, packed, hello.latency);
+        break;
+    default:
+        lime::warning("RemoteServer: unknown connection type %i", hello.type);
+    }
+    client->done.store(true);
+}
+
+void RemoteServer::ServeControl(const int fd)
+{
+    std::vector<unsigned char> data;
+    std::vector<unsigned char> reply;
+    while (running.load())
+    {
+        remote::RequestHeader request;
+        const int ret = remote::RecvAll(fd, &request, sizeof(request), 200);
+        if (ret == 1)
+            continue;
+        if (ret != 0 || request.length > maxRequestLength)
+            break;
+        data.resize(request.length);
+        if (request.length > 0 && remote::RecvAll(fd, data.data(), data.size()) != 0)
+            break;
+
+        reply.clear();
+        int status = 0;
+        std::unique_lock<std::mutex> lock(deviceLock);
+        switch (request.command)
+        {
+        case remote::CMD_TRANSFER_PACKET:
+        {
+            remote::PacketHeader header;
+            if (data.size() < sizeof(header))
+            {
+                status = -1;
+                break;
+            }
+            memcpy(&header, data.data(), sizeof(header));
+            LMS64CProtocol::GenericPacket pkt;
+            pkt.cmd = eCMD_LMS(header.cmd);
+            pkt.status = eCMD_STATUS(header.status);
+            pkt.periphID = header.periphID;
+            pkt.outBuffer.assign(data.begin()+sizeof(header), data.end());
+            status = device->TransferPacket(pkt);
+            header.status = pkt.status;
+            reply.resize(sizeof(header));
+            memcpy(reply.data(), &header, sizeof(header));
+            reply.insert(reply.end(), pkt.inBuffer.begin(), pkt.inBuffer.end());
+            break;
+        }
+        case remote::CMD_RESET_STREAM_BUFFERS:
+            status = device->ResetStreamBuffers();
+            break;
+        case remote::CMD_UPDATE_DATA_RATE:
+        {
+            remote::DataRate rate;
+            if (data.size() != sizeof(rate))
+            {
+                status = -1;
+                break;
+            }
+            memcpy(&rate, data.data(), sizeof(rate));
+            if (rate.withPhase)
+                status = static_cast<IConnection*>(device)->UpdateExternalDataRate(rate.channel, rate.txRate, rate.rxRate, rate.txPhase, rate.rxPhase);
+            else
+                status = device->UpdateExternalDataRate(rate.channel, rate.txRate, rate.rxRate);
+            break;
+        }
+        case remote::CMD_GET_REFERENCE_CLOCK:
+        {
+            uint32_t tx = 0;
+            memcpy(&tx, data.data(), std::min(data.size(), sizeof(tx)));
+            const double rate = tx ? device->GetTxReferenceClockRate() : device->GetReferenceClockRate();
+            reply.resize(sizeof(rate));
+            memcpy(reply.data(), &rate, sizeof(rate));
+            break;
+        }
+        case remote::CMD_SET_REFERENCE_CLOCK:
+        {
+            remote::ReferenceClock clock;
+            if (data.size() != sizeof(clock))
+            {
+                status = -1;
+                break;
+            }
+            memcpy(&clock, data.data(), sizeof(clock));
+            status = clock.tx ? device->SetTxReferenceClockRate(clock.rate) : device->SetReferenceClockRate(clock.rate);
+            break;
+        }
+        default:
+            status = ReportError(EPROTO, "RemoteServer: unknown command %i", request.command);
+        }
+        lock.unlock();
+
+        remote::ResponseHeader response = {status, uint32_t(reply.size())};
+        if (remote::SendAll(fd, &response, sizeof(response)) != 0
+            || remote::SendAll(fd, reply.data(), reply.size()) != 0)
+            break;
+    }
+}
+
+void RemoteServer::ServeRx(const int fd, const int channelsCount, const bool packed, const float latency)
+{
+    PacketQueue queue(rxQueuePackets);
+    QueueForwarder forwarder(queue);
+    std::unique_lock<std::mutex> lock(deviceLock);
+    remote::ResponseHeader response = {device->StartForwarding(&forwarder, false, channelsCount, packed, latency), 0};
+    lock.unlock();
+    if (remote::SendAll(fd, &response, sizeof(response)) != 0 || response.status != 0)
+    {
+        if (response.status == 0)
+        {
+            lock.lock();
+            device->StopForwarding(false);
+        }
+        return;
+    }
+
+    std::vector<FPGA_DataPacket> packets(64);
+    while (running.load())
+    {
+        const int count = queue.Pop(packets.data(), packets.size(), 100);
+        if (count > 0 && remote::SendAll(fd, packets.data(), count*sizeof(FPGA_DataPacket)) != 0)
+            break;
+        //client does not send on RX connection, readable socket means it was closed
+        struct pollfd pfd = {fd, POLLIN, 0};
+        if (poll(&pfd, 1, 0) != 0)
+            break;
+    }
+
+    queue.Abort();
+    lock.lock();
+    device->StopForwarding(false);
+    if (forwarder.dropped.load() > 0)
+        lime::warning("RemoteServer: %llu RX packets dropped, network too slow", (unsigned long long)forwarder.dropped.load());
+}
+
+void RemoteServer::ServeTx(const int fd, const int channelsCount, const bool packed, const float latency)
+{
+    PacketQueue queue(txQueuePackets);
+    QueueForwarder forwarder(queue);
+    std::unique_lock<std::mutex> lock(deviceLock);
+    remote::ResponseHeader response = {device->StartForwarding(&forwarder, true, channelsCount, packed, latency), 0};
+    lock.unlock();
+    if (remote::SendAll(fd, &response, sizeof(response)) != 0 || response.status != 0)
+    {
+        if (response.status == 0)
+        {
+            lock.lock();
+            device->StopForwarding(true);
+        }
+        return;
+    }
+
+    std::vector<FPGA_DataPacket> packets(64);
+    const size_t bufferSize = packets.size()*sizeof(FPGA_DataPacket);
+    char* buffer = reinterpret_cast<char*>(packets.data());
+    size_t bytesBuffered = 0;
+    while (running.load())
+    {
+        struct pollfd pfd = {fd, POLLIN, 0};
+        if (poll(&pfd, 1, 100) <= 0)
+            continue;
+        const ssize_t ret = recv(fd, buffer + bytesBuffered, bufferSize - bytesBuffered, 0);
+        if (ret <= 0)
+            break;
+        bytesBuffered += ret;
+        //queue is full while device is behind, that slows down the client
+        const int count = bytesBuffered / sizeof(FPGA_DataPacket);
+        int pushed = 0;
+        while (pushed < count && running.load())
+            pushed += queue.Push(&packets[pushed], count-pushed, 100);
+        const size_t bytesPushed = count*sizeof(FPGA_DataPacket);
+        memmove(buffer, buffer + bytesPushed, bytesBuffered - bytesPushed);
+        bytesBuffered -= bytesPushed;
+    }
+
+    queue.Abort();
+    lock.lock();
+    device->StopForwarding(true);
+}
@@ -0,0 +1,75 @@
+/**
+    @file RemoteServer.h
+    @author Lime Microsystems
+    @brief Serves local board to ConnectionRemote clients over TCP.
+*/
+
+#pragma once
+#include "LimeSuiteConfig.h"
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace lime{
+
+class IConnection;
+class ILimeSDRStreaming;
+
+/*!
+ * RemoteServer executes control packets received from clients on the
+ * local board and forwards stream packets between the board and client
+ * sockets as they are, without decoding the samples.
+ */
+class LIME_API RemoteServer
+{
+public:
+    /** @brief Creates server for given board
+        @param device board connection, must stay open while server runs
+    */
+    RemoteServer(IConnection* device);
+    ~RemoteServer();
+
+    /** @brief Starts listening for clients
+        @param bindAddress local address to listen on, empty for loopback only,
+            "0.0.0.0" for all interfaces
+        @param port TCP port, 0 to pick a free port
+        @return 0 on success
+    */
+    int Start(const std::string &bindAddress, const int port);
+
+    //! @brief Disconnects clients and stops listening
+    void Stop();
+
+    //! @brief Returns port the server listens on
+    int GetPort() const {return port;}
+
+private:
+    RemoteServer(const RemoteServer&) = delete;
+    RemoteServer& operator=(const RemoteServer&) = delete;
+
+    struct Client
+    {
+        int socket;
+        std::thread thread;
+        std::atomic<bool> done;
+    };
+
+    void AcceptLoop();
+    void ServeClient(Client* client);
+    void ServeControl(const int fd);
+    void ServeRx(const int fd, const int channelsCount, const bool packed, const float latency);
+    void ServeTx(const int fd, const int channelsCount, const bool packed, const float latency);
+
+    ILimeSDRStreaming* device;
+    std::mutex deviceLock;  ///<serializes control of the board between clients
+    int listenSocket;
+    int port;
+    std::atomic<bool> running;
+    std::thread acceptThread;
+    std::mutex clientsLock;
+    std::list<Client> clients;
+};
+
+}
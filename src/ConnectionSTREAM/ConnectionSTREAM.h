@@ -128,6 +128,7 @@ protected:
     virtual void AbortSending(int ep);
 
     int ResetStreamBuffers() override;
+    int GetNumaNode() override;
     eConnectionType GetType(void) {return USB_PORT;}
 
     double DetectRefClk(void);
@@ -16,6 +16,7 @@
 #include <FPGA_common.h>
 #include "ErrorReporting.h"
 #include "Logger.h"
+#include "Numa.h"
 
 using namespace lime;
 using namespace std;
@@ -187,6 +188,15 @@ int ConnectionSTREAM::ResetStreamBuffers()
     return TransferPacket(ctrPkt);
 }
 
+int ConnectionSTREAM::GetNumaNode()
+{
+#ifdef __unix__
+    if (dev_handle != nullptr)
+        return numa::GetUSBBusNode(libusb_get_bus_number(libusb_get_device(dev_handle)));
+#endif
+    return -1;
+}
+
 int ConnectionSTREAM::ReadRawStreamData(char* buffer, unsigned length, int epIndex, int timeout_ms)
 {
     const unsigned char ep = 0x81;
@@ -220,10 +230,11 @@ void ConnectionSTREAM::ReceivePacketsLoop(Streamer* stream)
     const uint32_t bufferSize = packetsToBatch*sizeof(FPGA_DataPacket);
     const uint8_t buffersCount = 16;
     vector<int> handles(buffersCount, 0);
-    vector<char>buffers(buffersCount*bufferSize, 0);
+    PooledBuffer<char> buffers;
     vector<StreamChannel::Frame> chFrames;
     try
     {
+        buffers.Allocate(buffersCount*bufferSize, stream->mRxStreams[0]->config.bufferFlags, stream->GetNumaNode(false));
         chFrames.resize(chCount);
     }
     catch (const std::bad_alloc &ex)
@@ -284,6 +295,11 @@ void ConnectionSTREAM::ReceivePacketsLoop(Streamer* stream)
                 continue;
             }
         }
+        //forwarded packets are passed on without decoding
+        if (stream->ForwardRxPackets((const FPGA_DataPacket*)&buffers[bi*bufferSize], bytesReceived / int(sizeof(FPGA_DataPacket))))
+            bytesReceived = 0;
+        //streams of channels are not replaced while packets are delivered
+        std::unique_lock<std::mutex> streamsLock(stream->rxStreamsLock);
         bool txLate=false;
         for (uint8_t pktIndex = 0; pktIndex < bytesReceived / sizeof(FPGA_DataPacket); ++pktIndex)
         {
@@ -318,24 +334,35 @@ void ConnectionSTREAM::ReceivePacketsLoop(Streamer* stream)
             }
             prevTs = pkt[pktIndex].counter;
             stream->rxLastTimestamp.store(prevTs);
-            //parse samples
-            vector<complex16_t*> dest(chCount);
+            //parse samples, directly to waiting reader's buffer if possible
+            complex16_t* dest[2];
+            StreamChannel* receiving[2] = {nullptr, nullptr};
             for(uint8_t c=0; c<chCount; ++c)
-                dest[c] = (chFrames[c].samples);
-            int samplesCount = fpga::FPGAPacketPayload2Samples(pktStart, 4080, chCount==2, packed, dest.data());
+            {
+                if (stream->mRxStreams[c]==nullptr || stream->mRxStreams[c]->IsReceiving()==false)
+                    dest[c] = chFrames[c].samples;
+                else
+                {
+                    receiving[c] = stream->mRxStreams[c];
+                    dest[c] = receiving[c]->AcquirePacketBuffer(chFrames[c], samplesInPacket, pkt[pktIndex].counter);
+                }
+            }
+            int samplesCount = fpga::FPGAPacketPayload2Samples(pktStart, 4080, chCount==2, packed, dest);
 
             for(int ch=0; ch<chCount; ++ch)
             {
-                if (stream->mRxStreams[ch]==nullptr || stream->mRxStreams[ch]->mActive==false)
+                //committed to the same stream that acquired the buffer
+                if (receiving[ch]==nullptr)
                     continue;
                 IStreamChannel::Metadata meta;
                 meta.timestamp = pkt[pktIndex].counter;
                 meta.flags = IStreamChannel::Metadata::OVERWRITE_OLD;
-                int samplesPushed = stream->mRxStreams[ch]->Write((const void*)chFrames[ch].samples, samplesCount, &meta, 100);
+                int samplesPushed = receiving[ch]->CommitPacketBuffer(samplesCount, &meta, 100);
                 if(samplesPushed != samplesCount)
-                    stream->mRxStreams[ch]->overflow++;
+                    receiving[ch]->overflow++;
             }
         }
+        streamsLock.unlock();
         // Re-submit this request to keep the queue full
         handles[bi] = this->BeginDataReading(&buffers[bi*bufferSize], bufferSize, ep);
         bi = (bi + 1) & (buffersCount-1);
@@ -375,8 +402,6 @@ void ConnectionSTREAM::ReceivePacketsLoop(Streamer* stream)
 void ConnectionSTREAM::TransmitPacketsLoop(Streamer* stream)
 {
     //at this point FPGA has to be already configured to output samples
-    const uint8_t maxChannelCount = 2;
-    const uint8_t chCount = stream->streamSize;
     const bool packed = stream->mTxStreams[0]->config.linkFormat == StreamConfig::STREAM_12_BIT_COMPRESSED;
     const unsigned char ep  = 0x01;
 
@@ -385,17 +410,14 @@ void ConnectionSTREAM::TransmitPacketsLoop(Streamer* stream)
     const uint32_t bufferSize = packetsToBatch*sizeof(FPGA_DataPacket);
     const uint32_t popTimeout_ms = 500;
 
-    const int maxSamplesBatch = (packed ? samples12InPkt:samples16InPkt)/chCount;
     vector<int> handles(buffersCount, 0);
     vector<bool> bufferUsed(buffersCount, 0);
     vector<uint32_t> bytesToSend(buffersCount, 0);
-    vector<complex16_t> samples[maxChannelCount];
-    vector<char> buffers;
+    PooledBuffer<char> buffers;
     try
     {
-        for(int i=0; i<chCount; ++i)
-            samples[i].resize(maxSamplesBatch);
-        buffers.resize(buffersCount*bufferSize, 0);
+        buffers.Allocate(buffersCount*bufferSize, stream->mTxStreams[0]->config.bufferFlags, stream->GetNumaNode(true));
+        memset(buffers.Data(), 0, buffersCount*bufferSize);
     }
     catch (const std::bad_alloc& ex) //not enough memory for buffers
     {
@@ -433,58 +455,19 @@ void ConnectionSTREAM::TransmitPacketsLoop(Streamer* stream)
                 continue;
             }
         }
-        int i=0;
-
-        while(i<packetsToBatch && stream->terminateTx.load() != true)
-        {
-            bool end_burst = false;
-            IStreamChannel::Metadata meta;
-            FPGA_DataPacket* pkt = reinterpret_cast<FPGA_DataPacket*>(&buffers[bi*bufferSize]);
-            for(int ch=0; ch<chCount; ++ch)
-            {
-                if (stream->mTxStreams[ch]==nullptr || stream->mTxStreams[ch]->mActive==false)
-                {
-                    memset(&samples[ch][0],0,maxSamplesBatch*sizeof(complex16_t));
-                    continue;
-                }
-                int samplesPopped = stream->mTxStreams[ch]->Read(samples[ch].data(), maxSamplesBatch, &meta, popTimeout_ms);
-                if (samplesPopped != maxSamplesBatch)
-                {
-                    if (meta.flags & IStreamChannel::Metadata::END_BURST)
-                    {
-                        memset(&samples[ch][samplesPopped],0,(maxSamplesBatch-samplesPopped)*sizeof(complex16_t));
-                        end_burst = true;
-                        continue;
-                    }
-                    stream->mTxStreams[ch]->underflow++;
-                    stream->terminateTx.store(true);
-#ifndef NDEBUG
-                    printf("popping from TX, samples popped %i/%i\n", samplesPopped, maxSamplesBatch);
-#endif
-                    break;
-                }
-            }
-
-            pkt[i].counter = meta.timestamp;
-            pkt[i].reserved[0] = 0;
-            //by default ignore timestamps
-            const int ignoreTimestamp = !(meta.flags & IStreamChannel::Metadata::SYNC_TIMESTAMP);
-            pkt[i].reserved[0] |= ((int)ignoreTimestamp << 4); //ignore timestamp
-
-            vector<complex16_t*> src(chCount);
-            for(uint8_t c=0; c<chCount; ++c)
-                src[c] = (samples[c].data());
-            uint8_t* const dataStart = (uint8_t*)pkt[i].data;
-            fpga::Samples2FPGAPacketPayload(src.data(), maxSamplesBatch, chCount==2, packed, dataStart);
-            ++i;
-            if (end_burst)
-                break;
-        }
+        //take samples for the whole transfer at once
+        FPGA_DataPacket* pkt = reinterpret_cast<FPGA_DataPacket*>(&buffers[bi*bufferSize]);
+        const int packetsFilled = stream->FillTxPackets(pkt, packetsToBatch, packed, popTimeout_ms);
+        if (packetsFilled < 0)
+            stream->terminateTx.store(true);
         
         if(stream->terminateTx.load() == true) //early termination
             break;
+        //forwarder had nothing to send, no empty transfers
+        if (packetsFilled == 0)
+            continue;
 
-        bytesToSend[bi] = i*sizeof(FPGA_DataPacket);
+        bytesToSend[bi] = packetsFilled*sizeof(FPGA_DataPacket);
         handles[bi] = this->BeginDataSending(&buffers[bi*bufferSize], bytesToSend[bi], ep);
         bufferUsed[bi] = true;
 
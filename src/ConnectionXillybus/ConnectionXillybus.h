@@ -54,6 +54,7 @@ protected:
     int SendData(const char* buffer, int length, int epIndex, int timeout = 100) override;
     void AbortReading(int epIndex);
     void AbortSending(int epIndex);
+    int GetNumaNode() override;
 
 private:
     static const int MAX_EP_CNT = 3;
@@ -12,10 +12,15 @@
 #include <chrono>
 #include <algorithm>
 #include <complex>
+#include <cstring>
 #include <ciso646>
 #include <FPGA_common.h>
 #include <ErrorReporting.h>
 #include "Logger.h"
+#include "Numa.h"
+#ifdef __unix__
+#include <dirent.h>
+#endif
 
 using namespace std;
 using namespace lime;
@@ -191,6 +196,30 @@ int ConnectionXillybus::ReadRawStreamData(char* buffer, unsigned length, int epI
     return totalBytesReceived;
 }
 
+int ConnectionXillybus::GetNumaNode()
+{
+#ifdef __unix__
+    int node = numa::GetCharDeviceNode(readStreamPort[0]);
+    if (node >= 0)
+        return node;
+    //xillybus class devices may have no parent, look for the PCIe card instead
+    DIR* dir = opendir("/sys/bus/pci/drivers/xillybus_pcie");
+    if (dir == nullptr)
+        return -1;
+    while (dirent* entry = readdir(dir))
+    {
+        if (strchr(entry->d_name, ':') == nullptr)
+            continue;
+        node = numa::GetSysfsDeviceNode(std::string("/sys/bus/pci/drivers/xillybus_pcie/") + entry->d_name);
+        break;
+    }
+    closedir(dir);
+    return node;
+#else
+    return -1;
+#endif
+}
+
 /** @brief Function dedicated for receiving data samples from board
     @param rxFIFO FIFO to store received data
     @param terminate periodically pooled flag to terminate thread
@@ -206,10 +235,11 @@ void ConnectionXillybus::ReceivePacketsLoop(Streamer* stream)
 
     const uint8_t packetsToBatch = stream->rxBatchSize*2;
     const uint32_t bufferSize = packetsToBatch*sizeof(FPGA_DataPacket);
-    vector<char>buffers(bufferSize, 0);
+    PooledBuffer<char> buffers;
     vector<StreamChannel::Frame> chFrames;
     try
     {
+        buffers.Allocate(bufferSize, stream->mRxStreams[0]->config.bufferFlags, stream->GetNumaNode(false));
         chFrames.resize(chCount);
     }
     catch (const std::bad_alloc &ex)
@@ -258,6 +288,11 @@ void ConnectionXillybus::ReceivePacketsLoop(Streamer* stream)
                 if (value && value->mActive)
                     value->underflow++;
 
+        //forwarded packets are passed on without decoding
+        if (stream->ForwardRxPackets((const FPGA_DataPacket*)&buffers[0], bytesReceived / int(sizeof(FPGA_DataPacket))))
+            bytesReceived = 0;
+        //streams of channels are not replaced while packets are delivered
+        std::unique_lock<std::mutex> streamsLock(stream->rxStreamsLock);
         bool txLate=false;
         for (uint8_t pktIndex = 0; pktIndex < bytesReceived / sizeof(FPGA_DataPacket); ++pktIndex)
         {
@@ -292,24 +327,35 @@ void ConnectionXillybus::ReceivePacketsLoop(Streamer* stream)
             }
             prevTs = pkt[pktIndex].counter;
             stream->rxLastTimestamp.store(pkt[pktIndex].counter);
-            //parse samples
-            vector<complex16_t*> dest(chCount);
+            //parse samples, directly to waiting reader's buffer if possible
+            complex16_t* dest[2];
+            StreamChannel* receiving[2] = {nullptr, nullptr};
             for(uint8_t c=0; c<chCount; ++c)
-                dest[c] = (chFrames[c].samples);
-            int samplesCount = fpga::FPGAPacketPayload2Samples(pktStart, 4080, chCount==2, packed, dest.data());
+            {
+                if (stream->mRxStreams[c]==nullptr || stream->mRxStreams[c]->IsReceiving()==false)
+                    dest[c] = chFrames[c].samples;
+                else
+                {
+                    receiving[c] = stream->mRxStreams[c];
+                    dest[c] = receiving[c]->AcquirePacketBuffer(chFrames[c], samplesInPacket, pkt[pktIndex].counter);
+                }
+            }
+            int samplesCount = fpga::FPGAPacketPayload2Samples(pktStart, 4080, chCount==2, packed, dest);
 
             for(int ch=0; ch<chCount; ++ch)
             {
-                if (stream->mRxStreams[ch]==nullptr || stream->mRxStreams[ch]->mActive==false)
+                //committed to the same stream that acquired the buffer
+                if (receiving[ch]==nullptr)
                     continue;
                 IStreamChannel::Metadata meta;
                 meta.timestamp = pkt[pktIndex].counter;
                 meta.flags = IStreamChannel::Metadata::OVERWRITE_OLD;
-                int samplesPushed = stream->mRxStreams[ch]->Write((const void*)chFrames[ch].samples, samplesCount, &meta, 100);
+                int samplesPushed = receiving[ch]->CommitPacketBuffer(samplesCount, &meta, 100);
                 if(samplesPushed != samplesCount)
-                    stream->mRxStreams[ch]->overflow++;;
+                    receiving[ch]->overflow++;
             }
         }
+        streamsLock.unlock();
 
         t2 = chrono::high_resolution_clock::now();
         auto timePeriod = std::chrono::duration_cast<std::chrono::milliseconds>(t2 - t1).count();
@@ -339,22 +385,17 @@ void ConnectionXillybus::ReceivePacketsLoop(Streamer* stream)
 void ConnectionXillybus::TransmitPacketsLoop(Streamer* stream)
 {
     //at this point FPGA has to be already configured to output samples
-    const uint8_t maxChannelCount = 2;
-    const uint8_t chCount = stream->streamSize;
     const bool packed = stream->mTxStreams[0]->config.linkFormat==StreamConfig::STREAM_12_BIT_COMPRESSED;
     const int epIndex = stream->mChipID;
 
     const uint8_t packetsToBatch = stream->txBatchSize*2;; //packets in single USB transfer
     const uint32_t bufferSize = packetsToBatch*sizeof(FPGA_DataPacket);
     const uint32_t popTimeout_ms = 500;
-    const int maxSamplesBatch = (packed ? samples12InPkt:samples16InPkt)/chCount;
-    vector<complex16_t> samples[maxChannelCount];
-    vector<char> buffers;
+    PooledBuffer<char> buffers;
     try
     {
-        for(int i=0; i<chCount; ++i)
-            samples[i].resize(maxSamplesBatch);
-        buffers.resize(bufferSize, 0);
+        buffers.Allocate(bufferSize, stream->mTxStreams[0]->config.bufferFlags, stream->GetNumaNode(true));
+        memset(buffers.Data(), 0, bufferSize);
     }
     catch (const std::bad_alloc& ex) //not enough memory for buffers
     {
@@ -368,59 +409,21 @@ void ConnectionXillybus::TransmitPacketsLoop(Streamer* stream)
 
     while (stream->terminateTx.load() != true)
     {
-        int i=0;
-
-        while(i<packetsToBatch)
-        {
-            bool end_burst = false;
-            IStreamChannel::Metadata meta;
-            FPGA_DataPacket* pkt = reinterpret_cast<FPGA_DataPacket*>(&buffers[0]);
-            for(int ch=0; ch<chCount; ++ch)
-            {
-                if (stream->mTxStreams[ch]==nullptr || stream->mTxStreams[ch]->mActive==false)
-                {
-                    memset(&samples[ch][0],0,maxSamplesBatch*sizeof(complex16_t));
-                    continue;
-                }
-                int samplesPopped = stream->mTxStreams[ch]->Read(samples[ch].data(), maxSamplesBatch, &meta, popTimeout_ms);
-                if (samplesPopped != maxSamplesBatch)
-                {
-                    if (meta.flags & IStreamChannel::Metadata::END_BURST)
-                    {
-                        memset(&samples[ch][samplesPopped],0,(maxSamplesBatch-samplesPopped)*sizeof(complex16_t));
-                        end_burst = true;
-                        continue;
-                    }
-                    stream->mTxStreams[ch]->underflow++;
-                    stream->terminateTx.store(true);
-#ifndef NDEBUG
-                    printf("popping from TX, samples popped %i/%i\n", samplesPopped, maxSamplesBatch);
-#endif
-                    break;
-                }
-            }
-
-            pkt[i].counter = meta.timestamp;
-            pkt[i].reserved[0] = 0;
-            //by default ignore timestamps
-            const int ignoreTimestamp = !(meta.flags & IStreamChannel::Metadata::SYNC_TIMESTAMP);
-            pkt[i].reserved[0] |= ((int)ignoreTimestamp << 4); //ignore timestamp
-
-            vector<complex16_t*> src(chCount);
-            for(uint8_t c=0; c<chCount; ++c)
-                src[c] = (samples[c].data());
-            uint8_t* const dataStart = (uint8_t*)pkt[i].data;
-            fpga::Samples2FPGAPacketPayload(src.data(), maxSamplesBatch, chCount==2, packed, dataStart);
-            ++i;
-            if (end_burst)
-                break;
-        }
+        //take samples for the whole transfer at once
+        FPGA_DataPacket* pkt = reinterpret_cast<FPGA_DataPacket*>(&buffers[0]);
+        const int packetsFilled = stream->FillTxPackets(pkt, packetsToBatch, packed, popTimeout_ms);
+        if (packetsFilled < 0)
+            stream->terminateTx.store(true);
         
         if(stream->terminateTx.load() == true) //early termination
             break;
+        //forwarder had nothing to send, no empty transfers
+        if (packetsFilled == 0)
+            continue;
 
-        uint32_t bytesSent = this->SendData(&buffers[0], bufferSize, epIndex, 1000);
-        if (bytesSent != bufferSize){
+        const uint32_t bytesToSend = packetsFilled*sizeof(FPGA_DataPacket);
+        uint32_t bytesSent = this->SendData(&buffers[0], bytesToSend, epIndex, 1000);
+        if (bytesSent != bytesToSend){
             for (auto value : stream->mTxStreams)
                 if (value && value->mActive)
                     value->overflow++;
@@ -110,6 +110,7 @@ protected:
     double DetectRefClk(void);
     
     int ResetStreamBuffers() override;
+    int GetNumaNode() override;
 
     eConnectionType GetType(void) {return USB_PORT;}
 
@@ -77,9 +77,10 @@ int ResetTimestamp(IConnection* serPort)
     if (status != 0)
         return 0;
     uint32_t value = (TXPCT_LOSS_CLR | SMPL_NR_CLR);
-    serPort->WriteRegister(0x0009, interface_ctrl_0009 & ~(value));
-    serPort->WriteRegister(0x0009, interface_ctrl_0009 | value);
-    serPort->WriteRegister(0x0009, interface_ctrl_0009 & ~value);
+    //pulse is written in order in one transfer
+    const uint32_t addrs[] = {0x0009, 0x0009, 0x0009};
+    const uint32_t values[] = {interface_ctrl_0009 & ~value, interface_ctrl_0009 | value, interface_ctrl_0009 & ~value};
+    serPort->WriteRegisters(addrs, values, 3);
     return status;
 }
 
@@ -158,14 +159,17 @@ int SetPllFrequency(IConnection* serPort, const uint8_t pllIndex, const double i
         if(clocks[i].outFrequency < PLLlowerLimit && not clocks[i].bypass)
             return ReportError(ERANGE, "SetPllFrequency: clock(%i) must be >=%g MHz", i, PLLlowerLimit/1e6);
 
+    //independent registers are read in one transfer
+    const uint32_t readAddrs[] = {0x0005, 0x0003};
+    uint32_t readValues[] = {0, 0};
+    if(serPort->ReadRegisters(readAddrs, readValues, 2) != 0)
+        return ReportError(ENODEV, "SetPllFrequency: failed to read register");
+
     //disable direct clock source
-    uint16_t drct_clk_ctrl_0005 = 0;
-    serPort->ReadRegister(0x0005, drct_clk_ctrl_0005);
+    const uint16_t drct_clk_ctrl_0005 = readValues[0];
     serPort->WriteRegister(0x0005, drct_clk_ctrl_0005 & ~(1 << pllIndex));
 
-    uint16_t reg23val = 0;
-    if(serPort->ReadRegister(0x0003, reg23val) != 0)
-        return ReportError(ENODEV, "SetPllFrequency: failed to read register");
+    uint16_t reg23val = readValues[1];
 
     reg23val &= ~(0x1F << 3); //clear PLL index
     reg23val &= ~PLLCFG_START; //clear PLLCFG_START
@@ -415,8 +419,6 @@ int SetDirectClocking(IConnection* serPort, uint8_t clockIndex, const double inp
 
     uint16_t drct_clk_ctrl_0005 = 0;
     serPort->ReadRegister(0x0005, drct_clk_ctrl_0005);
-    uint16_t drct_clk_ctrl_0006;
-    serPort->ReadRegister(0x0006, drct_clk_ctrl_0006);
 
     vector<uint32_t> addres;
     vector<uint32_t> values;
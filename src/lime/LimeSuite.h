@@ -1060,7 +1060,9 @@ typedef struct
     {
         LMS_FMT_F32=0,    ///<32-bit floating point
         LMS_FMT_I16,      ///<16-bit integers
-        LMS_FMT_I12       ///<12-bit integers stored in 16-bit variables
+        LMS_FMT_I12,      ///<12-bit integers stored in 16-bit variables
+        LMS_FMT_I8,       ///<8 most significant bits of 12-bit samples
+        LMS_FMT_F16       ///<16-bit IEEE half precision floating point
     }dataFmt;
 }lms_stream_t;
 
@@ -1092,6 +1094,10 @@ typedef struct
  * Create new stream based on parameters passed in configuration structure.
  * The structure is initialized with stream handle.
  *
+ * Several RX streams can be set up on the same channel, each of them gets
+ * all received samples and has its own FIFO position and overflow count.
+ * Samples are shared between the streams without copying.
+ *
  * @param device    Device handle previously obtained by LMS_Open().
  * @param stream    Stream configuration .See the ::lms_stream_t description.
  *
@@ -1099,6 +1105,69 @@ typedef struct
  */
 API_EXPORT int CALL_CONV LMS_SetupStream(lms_device_t *device, lms_stream_t *stream);
 
+/**Host side rational resampler configuration*/
+typedef struct
+{
+    uint32_t interpolation; ///<upsampling factor
+    uint32_t decimation;    ///<downsampling factor
+    /**Filter taps per unit of the larger factor, filter length is limited
+     * to 512 taps. 0 selects default (16)*/
+    uint32_t taps;
+    ///Passband edge, fraction of the lower Nyquist frequency, 0 selects 0.8
+    float passband;
+    ///Stopband edge, fraction of the lower Nyquist frequency, 0 selects 1.0
+    float stopband;
+}lms_resampler_t;
+
+/**
+ * Create new RX stream whose samples are resampled on the host to
+ * device sample rate * interpolation / decimation. Use it for rates that
+ * the RF chip decimation chain cannot produce exactly.
+ * Timestamps returned by LMS_RecvStream() remain in device sample units.
+ *
+ * @param device    Device handle previously obtained by LMS_Open().
+ * @param stream    RX stream configuration. See the ::lms_stream_t description.
+ * @param resampler Resampling factor and filter specification.
+ *
+ * @return      0 on success, (-1) on failure
+ */
+API_EXPORT int CALL_CONV LMS_SetupResampledStream(lms_device_t *device, lms_stream_t *stream, const lms_resampler_t *resampler);
+
+/**
+ * Create new TX stream that accepts timestamped bursts from several threads.
+ * LMS_SendStream() can be called concurrently, each call is one burst and
+ * must have waitForTimestamp set. Bursts are merged by timestamp on the host.
+ * Bursts overlapping an earlier one, or arriving after later samples were
+ * already sent, are dropped and reported as dropped packets.
+ *
+ * @param device    Device handle previously obtained by LMS_Open().
+ * @param stream    TX stream configuration. See the ::lms_stream_t description.
+ *
+ * @return      0 on success, (-1) on failure
+ */
+API_EXPORT int CALL_CONV LMS_SetupBurstStream(lms_device_t *device, lms_stream_t *stream);
+
+/**
+ * Create narrowband RX stream extracted from wideband RX stream on the host.
+ * The channel is shifted to baseband and resampled, several sub-streams of
+ * the same wideband stream are processed in parallel by worker threads.
+ *
+ * Sub-streams must be set up before the wideband stream is started. Once
+ * set up, wideband samples go only to sub-streams, LMS_RecvStream() fails on
+ * the wideband stream. Start, stop and read sub-streams as ordinary streams.
+ * They are destroyed together with the wideband stream.
+ *
+ * @param device    Device handle previously obtained by LMS_Open().
+ * @param wideband  RX stream previously initialized with LMS_SetupStream(),
+ *                  without resampling.
+ * @param stream    Sub-stream configuration, dataFmt and fifoSize are used.
+ * @param frequencyOffset Channel center relative to wideband center, Hz.
+ * @param resampler Resampling of the shifted channel, NULL keeps wideband rate.
+ *
+ * @return      0 on success, (-1) on failure
+ */
+API_EXPORT int CALL_CONV LMS_SetupSubStream(lms_device_t *device, lms_stream_t *wideband, lms_stream_t *stream, float_type frequencyOffset, const lms_resampler_t *resampler);
+
 /**
  * Deallocate memory used by stream.
  *
@@ -1188,6 +1257,242 @@ API_EXPORT int CALL_CONV LMS_UploadWFM(lms_device_t *device, const void **sample
  */
 API_EXPORT int CALL_CONV LMS_EnableTxWFM(lms_device_t *device, unsigned chan, bool active);
 
+/**Recording status structure*/
+typedef struct
+{
+    ///Indicates whether recording is running
+    bool active;
+    ///Indicates that writing to disk failed and recording was stopped
+    bool error;
+    ///Number of samples recorded per channel
+    uint64_t samples;
+    ///Number of bytes written to data file
+    uint64_t bytesWritten;
+    ///Number of timestamp discontinuities in recording
+    uint32_t gaps;
+    ///Number of samples missing in discontinuities
+    uint64_t droppedSamples;
+    ///Number of times disk writing could not keep up with stream
+    uint32_t writerStalls;
+} lms_recording_status_t;
+
+/**
+ * Starts recording RX streams to disk in SigMF format. Samples of all streams
+ * are interleaved to \<filename\>.sigmf-data, metadata is written to
+ * \<filename\>.sigmf-meta when recording is stopped.
+ * Streams must be set up with the same data format and started by the caller,
+ * LMS_RecvStream() must not be used on them while recording.
+ *
+ * @param device        Device handle previously obtained by LMS_Open().
+ * @param streams       array of RX streams previously initialized with LMS_SetupStream().
+ * @param streamCount   number of streams in array
+ * @param filename      data file name without extension
+ * @param packed        store LMS_FMT_I12 samples packed, 3 bytes per complex sample
+ *
+ * @return 0 on success, (-1) on failure
+ */
+API_EXPORT int CALL_CONV LMS_StartRecording(lms_device_t *device, lms_stream_t *streams,
+                            size_t streamCount, const char *filename, bool packed);
+
+/**
+ * Stops recording, flushes data file and writes metadata file.
+ *
+ * @param device    Device handle previously obtained by LMS_Open().
+ *
+ * @return 0 on success, (-1) on failure
+ */
+API_EXPORT int CALL_CONV LMS_StopRecording(lms_device_t *device);
+
+/**
+ * Get recording status
+ *
+ * @param device    Device handle previously obtained by LMS_Open().
+ * @param status    Recording status. See the ::lms_recording_status_t for description
+ *
+ * @return 0 on success, (-1) on failure
+ */
+API_EXPORT int CALL_CONV LMS_GetRecordingStatus(lms_device_t *device, lms_recording_status_t *status);
+
+/**File playback configuration*/
+typedef struct
+{
+    ///Path of the file to transmit
+    const char *filename;
+
+    ///File sample format
+    enum
+    {
+        LMS_PLAYBACK_CS16=0,        ///<16-bit integers
+        LMS_PLAYBACK_CS12_PACKED,   ///<packed 12-bit integers, 3 bytes per complex sample
+        LMS_PLAYBACK_CF32           ///<32-bit floating point
+    }fileFmt;
+
+    ///Number of interleaved channels in file, must match TX channels in use
+    uint8_t channels;
+
+    ///Restart from the beginning of file when end is reached
+    bool loop;
+
+    ///Transmit first sample at given timestamp, otherwise immediately
+    bool waitForTimestamp;
+    uint64_t timestamp;
+
+    ///Sample rate of the file, checked against TX rate, 0 to skip the check
+    float_type sampleRate;
+} lms_playback_t;
+
+/**
+ * Transmits samples memory mapped from a file instead of stream FIFO.
+ * Packed 12-bit files are sent without conversion on streams using
+ * LMS_FMT_I12 and 16-bit files on other integer streams.
+ * When playback ends without looping, stream continues with LMS_SendStream() data.
+ *
+ * @param device    Device handle previously obtained by LMS_Open().
+ * @param stream    TX stream previously initialized with LMS_SetupStream() and started.
+ * @param playback  Playback configuration. See the ::lms_playback_t description.
+ *
+ * @return 0 on success, (-1) on failure
+ */
+API_EXPORT int CALL_CONV LMS_StartPlayback(lms_device_t *device, lms_stream_t *stream,
+                            const lms_playback_t *playback);
+
+/**
+ * Stops file playback, stream continues with LMS_SendStream() data.
+ *
+ * @param device    Device handle previously obtained by LMS_Open().
+ * @param stream    TX stream passed to LMS_StartPlayback().
+ *
+ * @return 0 on success, (-1) on failure
+ */
+API_EXPORT int CALL_CONV LMS_StopPlayback(lms_device_t *device, lms_stream_t *stream);
+
+/**
+ * Publishes samples of RX stream to a named shared memory ring, so other local
+ * processes can read the same stream with LMS_AttachSharedStream().
+ *
+ * @param device    Device handle previously obtained by LMS_Open().
+ * @param stream    RX stream previously initialized with LMS_SetupStream().
+ * @param name      Shared memory object name, e.g. "/lime-rx0", must not exist.
+ * @param exclusive Samples only go to the ring, LMS_RecvStream() gets no data.
+ *
+ * @return 0 on success, (-1) on failure
+ */
+API_EXPORT int CALL_CONV LMS_ShareStream(lms_device_t *device, lms_stream_t *stream,
+                            const char *name, bool exclusive);
+
+/**
+ * Stops publishing and removes shared memory ring.
+ * Attached consumers can read remaining samples until they detach.
+ *
+ * @param device    Device handle previously obtained by LMS_Open().
+ * @param stream    RX stream passed to LMS_ShareStream().
+ *
+ * @return 0 on success, (-1) on failure
+ */
+API_EXPORT int CALL_CONV LMS_UnshareStream(lms_device_t *device, lms_stream_t *stream);
+
+/**Host side DC offset and IQ imbalance correction coefficients*/
+typedef struct
+{
+    float dc_i;         ///<DC offset of I in sample units, subtracted first
+    float dc_q;         ///<DC offset of Q in sample units, subtracted first
+    /**Row major 2x2 matrix applied to DC corrected [I Q], identity is
+     * {1, 0, 0, 1}*/
+    float matrix[4];
+}lms_iq_correction_t;
+
+/**
+ * Sets DC offset and IQ imbalance correction applied on the host to received
+ * samples. Resolution is not limited by the RF chip corrector registers.
+ * Correction can be changed while stream is running.
+ *
+ * @param device     Device handle previously obtained by LMS_Open().
+ * @param stream     RX stream previously initialized with LMS_SetupStream().
+ * @param correction Correction coefficients, NULL disables correction.
+ *
+ * @return 0 on success, (-1) on failure
+ */
+API_EXPORT int CALL_CONV LMS_SetStreamCorrection(lms_device_t *device, lms_stream_t *stream,
+                            const lms_iq_correction_t *correction);
+
+/**Power trigger of received samples*/
+typedef struct
+{
+    float level;            ///<RMS amplitude over window that starts capture, sample units
+    uint32_t window;        ///<Samples in sliding power window, 0 selects 64
+    uint32_t preTrigger;    ///<Packets before trigger that are delivered too
+    uint32_t postTrigger;   ///<Packets delivered after power falls below level, at least 1
+}lms_trigger_t;
+
+/**
+ * Enables triggered capture of RX stream. Received packets are kept in a
+ * ring on the host and only segments around bursts reach LMS_RecvStream(),
+ * idle samples are discarded without being copied. Each LMS_RecvStream()
+ * call returns samples of a single segment, timestamp of the first sample
+ * is exact, gaps in timestamps separate segments.
+ *
+ * @param device    Device handle previously obtained by LMS_Open().
+ * @param stream    RX stream previously initialized with LMS_SetupStream().
+ * @param trigger   Trigger settings, NULL passes all samples again.
+ *
+ * @return 0 on success, (-1) on failure
+ */
+API_EXPORT int CALL_CONV LMS_SetStreamTrigger(lms_device_t *device, lms_stream_t *stream,
+                            const lms_trigger_t *trigger);
+
+/**Shared stream consumer handle*/
+typedef void lms_shared_stream_t;
+
+/**
+ * Attaches to shared memory ring published by another process.
+ *
+ * @param[out] stream   Consumer handle.
+ * @param name          Name given to LMS_ShareStream().
+ *
+ * @return 0 on success, (-1) on failure
+ */
+API_EXPORT int CALL_CONV LMS_AttachSharedStream(lms_shared_stream_t **stream, const char *name);
+
+/**
+ * Waits for next block of samples and returns pointer to it in shared memory.
+ * Samples are interleaved 16-bit I/Q. Block must be released with
+ * LMS_ReleaseSharedSamples() before acquiring next one.
+ *
+ * @param stream        Consumer handle.
+ * @param[out] samples  Pointer to samples.
+ * @param meta          Returns timestamp of the first sample.
+ * @param timeout_ms    Timeout in milliseconds.
+ *
+ * @return number of samples, 0 on timeout, (-1) on failure
+ */
+API_EXPORT int CALL_CONV LMS_AcquireSharedSamples(lms_shared_stream_t *stream,
+                            const int16_t **samples, lms_stream_meta_t *meta, unsigned timeout_ms);
+
+/**
+ * Releases samples returned by LMS_AcquireSharedSamples().
+ *
+ * @param stream    Consumer handle.
+ *
+ * @return 0 if samples were valid, (-1) if publisher overwrote them while in use
+ */
+API_EXPORT int CALL_CONV LMS_ReleaseSharedSamples(lms_shared_stream_t *stream);
+
+/**
+ * Returns number of sample blocks this consumer lost by falling behind.
+ *
+ * @param stream    Consumer handle.
+ *
+ * @return lost blocks count
+ */
+API_EXPORT uint64_t CALL_CONV LMS_GetSharedStreamOverflows(lms_shared_stream_t *stream);
+
+/**
+ * Detaches from shared memory ring and frees consumer handle.
+ *
+ * @param stream    Consumer handle.
+ */
+API_EXPORT void CALL_CONV LMS_DetachSharedStream(lms_shared_stream_t *stream);
+
 /** @} (End FN_STREAM) */
 
 /**
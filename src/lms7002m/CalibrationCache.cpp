@@ -206,6 +206,81 @@ auto lambda_callback = [](void *vco_csw_pair, int argc, char **argv, char **azCo
     return 0;
 }
 
+/** @brief Estimates VCO and CSW from closest cached frequencies
+    CSW is interpolated when frequencies on both sides use the same VCO,
+    otherwise values of the closest one are given. Result needs verification.
+*/
+int CalibrationCache::GetVCO_CSW_Interp(uint32_t boardId, double frequency, uint8_t channel, bool transmitter, int *vco, int *csw)
+{
+    const double window = 10e6;
+    std::vector<double> closeFreqs;
+
+    auto lambda_callback = [](void *data, int argc, char **argv, char **azColName)
+    {
+        std::vector<double> *data_freqs = (std::vector<double>*)data;
+        if(data != nullptr)
+        {
+            for (size_t i = 0; i < (size_t)argc; i++)
+            {
+                if (argv[i] == nullptr) continue;
+                data_freqs->push_back(double(std::stoll(argv[i])));
+            }
+            return 0;
+        }
+        return 1;
+    };
+
+    char* zErrMsg = 0;
+    stringstream query;
+    query << "SELECT max(frequency) as freq FROM LMS7002M_VCO where "<<
+"boardID="<<boardId<<
+" AND frequency <= "<<std::llrint(frequency)<<
+" AND frequency > "<<std::llrint(frequency - window)<<
+" AND channel="<<(int)channel<<
+" AND transmitter="<<(transmitter?1:0)<<
+" UNION SELECT min(frequency) as freq FROM LMS7002M_VCO where "<<
+"boardID="<<boardId<<
+" AND frequency >= "<<std::llrint(frequency)<<
+" AND frequency < "<<std::llrint(frequency + window)<<
+" AND channel="<<(int)channel<<
+" AND transmitter="<<(transmitter?1:0)<<
+";";
+
+    int rc = sqlite3_exec(db, query.str().c_str(), lambda_callback, &closeFreqs, &zErrMsg);
+    if( rc != SQLITE_OK )
+    {
+        lime::error("SQL error: %s", zErrMsg);
+        sqlite3_free(zErrMsg);
+        return -1;
+    }
+    if (closeFreqs.empty())
+        return -1;
+    if (closeFreqs.size() == 1)
+        return GetVCO_CSW(boardId, closeFreqs.front(), channel, transmitter, vco, csw);
+
+    double f0 = closeFreqs[0];
+    double f1 = closeFreqs[1];
+    int vco0, csw0;
+    int vco1, csw1;
+    rc = GetVCO_CSW(boardId, f0, channel, transmitter, &vco0, &csw0);
+    if (rc != 0) return rc;
+    rc = GetVCO_CSW(boardId, f1, channel, transmitter, &vco1, &csw1);
+    if (rc != 0) return rc;
+
+    if (vco0 == vco1)
+    {
+        *vco = vco0;
+        *csw = std::rint(linearInterp(frequency, f0, csw0, f1, csw1));
+    }
+    else
+    {
+        const bool lower = std::abs(frequency-f0) <= std::abs(f1-frequency);
+        *vco = lower ? vco0 : vco1;
+        *csw = lower ? csw0 : csw1;
+    }
+    return 0;
+}
+
 int CalibrationCache::InsertDC_IQ(uint32_t boardId, double frequency, uint8_t channel, bool transmitter, int band_lna, int dcI, int dcQ, int gainI, int gainQ, int phaseOffset)
 {
     char* zErrMsg = 0;
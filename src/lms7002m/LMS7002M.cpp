@@ -24,6 +24,8 @@
 #include <assert.h>
 #include <chrono>
 #include <thread>
+#include <mutex>
+#include <map>
 #include "Logger.h"
 #include "mcu_programs.h"
 
@@ -48,6 +50,27 @@ extern std::vector<const LMS7Parameter*> LMS7parameterList;
 const uint16_t LMS7002M::readOnlyRegisters[] =      { 0x002F, 0x008C, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x0123, 0x0209, 0x020A, 0x020B, 0x040E, 0x040F };
 const uint16_t LMS7002M::readOnlyRegistersMasks[] = { 0x0000, 0x0FFF, 0x007F, 0x0000, 0x0000, 0x0000, 0x0000, 0x003F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 };
 
+//register intervals changed by chip itself or by MCU, always read from chip
+const uint16_t LMS7002M::volatileRegisters[][2] = {
+    { 0x0000, 0x0006 }, //MCU control and status
+    { 0x002F, 0x002F }, //chip version
+    { 0x008C, 0x008C }, //CGEN VCO comparators
+    { 0x00A8, 0x00AC }, //BIST
+    { 0x0123, 0x0123 }, //SX VCO comparators
+    { 0x0209, 0x020B }, //RSSI, ADC readback
+    { 0x040E, 0x040F }, //RSSI, ADC readback
+    { 0x05C0, 0x05CC }, //DC calibration readback
+    { 0x0640, 0x0641 }  //MCU internal
+};
+
+//LNA, TIA and PGA gains with PGA compensation, changed by MCU AGC
+const uint16_t LMS7002M::agcRegisters[] = { 0x0113, 0x0119, 0x011A };
+
+//counts register writes by all LMS7002M objects per chip,
+//cache is no longer trusted when another object wrote to the same chip
+static std::mutex writeEpochsLock;
+static std::map<std::pair<const IConnection*, unsigned>, uint32_t> writeEpochs;
+
 /** @brief Simple logging function to print status messages
     @param text message to print
     @param type message type for filtering specific information
@@ -106,6 +129,8 @@ void LMS7002M::SetConnection(IConnection* port, const size_t devIndex)
 {
     controlPort = port;
     mdevIndex = devIndex;
+    UpdateWriteEpoch(false);
+    InvalidateRegisterCache();
 
     if (controlPort != nullptr)
     {
@@ -131,7 +156,11 @@ LMS7002M::LMS7002M() :
     mRegistersMap(new LMS7002M_RegistersMap()),
     controlPort(nullptr),
     mdevIndex(0),
-    mSelfCalDepth(0)
+    mSelfCalDepth(0),
+    mSPIBatchDepth(0),
+    mRegistersSynced(0x0800, 0),
+    mWriteEpoch(0),
+    mAGCRunning(false)
 {
     mCalibrationByMCU = true;
 
@@ -377,7 +406,9 @@ int LMS7002M::ResetChip()
 {
     checkConnection();
 
+    FlushSPIBatch();
     int status = controlPort->DeviceReset(mdevIndex);
+    InvalidateRegisterCache();
     if (status == 0) Modify_SPI_Reg_bits(LMS7param(MIMO_SISO), 0); //enable B channel after reset
     return status;
 }
@@ -389,6 +420,7 @@ int LMS7002M::SoftReset()
     this->SPI_write(0x0020, 0x0);
     this->SPI_write(0x0020, reg_0x0020);
     this->SPI_write(0x002E, reg_0x002E);//must write
+    InvalidateRegisterCache();
     return 0;
 }
 
@@ -595,7 +627,6 @@ int LMS7002M::LoadConfig(const char* filename)
 
     uint16_t addr = 0;
     uint16_t value = 0;
-    Channel ch = this->GetActiveChannel(); //remember used channel
 
     int status;
     typedef INI<string, string, string> ini_t;
@@ -619,58 +650,28 @@ int LMS7002M::LoadConfig(const char* filename)
     int fileVersion = 0;
     fileVersion = parser.get("version", 0);
 
-    vector<uint16_t> addrToWrite;
-    vector<uint16_t> dataToWrite;
-
     if (fileVersion == 1)
     {
-        if(parser.select("lms7002_registers_a") == true)
+        //registers missing in file are not touched
+        LMS7002M_RegistersMap target;
+        const char* sections[] = {"lms7002_registers_a", "lms7002_registers_b"};
+        for (int space = 0; space < 2; ++space)
         {
-            ini_t::sectionsit_t section = parser.sections.find("lms7002_registers_a");
-
-            uint16_t x0020_value = 0;
-            this->SetActiveChannel(ChA); //select A channel
+            if (parser.select(sections[space]) == false)
+                continue;
+            ini_t::sectionsit_t section = parser.sections.find(sections[space]);
             for (ini_t::keysit_t pairs = section->second->begin(); pairs != section->second->end(); pairs++)
             {
                 sscanf(pairs->first.c_str(), "%hx", &addr);
                 sscanf(pairs->second.c_str(), "%hx", &value);
-                if (addr == LMS7param(MAC).address) //skip register containing channel selection
-                {
-                    x0020_value = value;
-                    continue;
-                }
-                addrToWrite.push_back(addr);
-                dataToWrite.push_back(value);
+                //registers below 0x0100 are common to both channels
+                target.SetValue(addr < 0x0100 ? 0 : space, addr, value);
             }
-            status = SPI_write_batch(&addrToWrite[0], &dataToWrite[0], addrToWrite.size());
-            if (status != 0 && controlPort != nullptr)
-                return status;
-            status = SPI_write(0x0020, x0020_value);
-            if (status != 0 && controlPort != nullptr)
-                return status;
-            this->SetActiveChannel(ChB);
-            if (status != 0 && controlPort != nullptr)
-                return status;
         }
-
-        if (parser.select("lms7002_registers_b") == true)
-        {
-            addrToWrite.clear();
-            dataToWrite.clear();
-            ini_t::sectionsit_t section = parser.sections.find("lms7002_registers_b");
-            for (ini_t::keysit_t pairs = section->second->begin(); pairs != section->second->end(); pairs++)
-            {
-                sscanf(pairs->first.c_str(), "%hx", &addr);
-                sscanf(pairs->second.c_str(), "%hx", &value);
-                addrToWrite.push_back(addr);
-                dataToWrite.push_back(value);
-            }
-            this->SetActiveChannel(ChB); //select B channel
-            status = SPI_write_batch(&addrToWrite[0], &dataToWrite[0], addrToWrite.size());
-            if (status != 0 && controlPort != nullptr)
-                return status;
-        }
-        this->SetActiveChannel(ch);
+        //only registers differing from chip are written
+        status = ApplyRegisterMap(target);
+        if (status != 0 && controlPort != nullptr)
+            return status;
 
         parser.select("reference_clocks");
         this->SetReferenceClk_SX(Rx, parser.get("sxr_ref_clk_mhz", 30.72) * 1e6);
@@ -1368,6 +1369,72 @@ int LMS7002M::TuneVCO(VCO_Module module) // 0-cgen, 1-SXR, 2-SXT
     return ReportError(EINVAL, "TuneVCO(%s) - failed to lock (cmphl != 2)\n%s", moduleName, ss.str().c_str());
 }
 
+/** @brief Tunes VCO starting from previously found CSW value
+    Seed is accepted when comparators show lock at it. When lock is found
+    only after moving toward it, CSW is at the edge of lock range, so a few
+    more values are probed and CSW is set to the middle of locking ones.
+    No search is done, use TuneVCO() on failure.
+    @param module VCO to tune
+    @param csw starting CSW value, cached or interpolated
+    @return 0-locked and CSW is set, other-seed does not lock
+*/
+int LMS7002M::TuneVCOFromSeed(VCO_Module module, int csw)
+{
+    auto settlingTime = chrono::microseconds(50);
+    const int step = 2; //second try when seed is just outside lock range
+    const int centeringProbes = 4;
+    const char* moduleName = (module == VCO_CGEN) ? "CGEN" : ((module == VCO_SXR) ? "SXR" : "SXT");
+    checkConnection();
+    const bool cgen = (module == VCO_CGEN);
+    const LMS7Parameter &paramCSW = cgen ? LMS7param(CSW_VCO_CGEN) : LMS7param(CSW_VCO);
+    const uint16_t addrVCOpd = cgen ? LMS7param(PD_VCO_CGEN).address : LMS7param(PD_VCO).address;
+    const uint16_t addrCMP = cgen ? LMS7param(VCO_CMPHO_CGEN).address : LMS7param(VCO_CMPHO).address;
+
+    Channel ch = this->GetActiveChannel(); //remember used channel
+    if(not cgen)
+        this->SetActiveChannel(Channel(module));
+    int status = Modify_SPI_Reg_bits(addrVCOpd, 2, 1, 0);
+    uint8_t cmphl = 0;
+    int direction = 0;
+    for (int attempt = 0; attempt < 2 && status == 0; ++attempt)
+    {
+        csw = std::max(0, std::min(csw, 255));
+        status = Modify_SPI_Reg_bits(paramCSW, csw);
+        this_thread::sleep_for(settlingTime);
+        cmphl = (uint8_t)Get_SPI_Reg_bits(addrCMP, 13, 12, true);
+        if(cmphl == 2)
+            break;
+        direction = (cmphl & 0x01) ? -1 : 1;
+        csw += direction*step;
+    }
+    //lock found after a step, move away from the edge
+    if(status == 0 && cmphl == 2 && direction != 0)
+    {
+        int lockEnd = csw;
+        for (int i = 0; i < centeringProbes; ++i)
+        {
+            const int probe = lockEnd + direction*step;
+            if (probe < 0 || probe > 255)
+                break;
+            Modify_SPI_Reg_bits(paramCSW, probe);
+            this_thread::sleep_for(settlingTime);
+            if (Get_SPI_Reg_bits(addrCMP, 13, 12, true) != 2)
+                break;
+            lockEnd = probe;
+        }
+        //values between two locking ones are locking too
+        csw = (csw + lockEnd)/2;
+        status = Modify_SPI_Reg_bits(paramCSW, csw);
+        this_thread::sleep_for(settlingTime);
+    }
+    this->SetActiveChannel(ch); //restore previously used channel
+    if(status != 0)
+        return status;
+    if(cmphl == 2)
+        return 0;
+    return ReportError(EINVAL, "TuneVCO(%s) - seed CSW does not lock (cmphl=%d)", moduleName, int(cmphl));
+}
+
 /** @brief Returns given parameter value from chip register
     @param param LMS7002M control parameter
     @param fromChip read directly from chip
@@ -1511,20 +1578,29 @@ int LMS7002M::SetFrequencySX(bool tx, float_type freq_Hz, SX_details* output)
     Modify_SPI_Reg_bits(LMS7param(PD_VCO), 0); //
     Modify_SPI_Reg_bits(LMS7param(PD_VCO_COMP), 0); //
 
-    bool foundInCache = false;
+    //start from cached or interpolated CSW, full search only when it does not lock
+    bool seeded = false;
     int vco_query;
     int csw_query;
     if(useCache)
     {
-        foundInCache = (mValueCache->GetVCO_CSW(boardId, freq_Hz, mdevIndex, tx, &vco_query, &csw_query) == 0);
+        seeded = (mValueCache->GetVCO_CSW(boardId, freq_Hz, mdevIndex, tx, &vco_query, &csw_query) == 0)
+            || (mValueCache->GetVCO_CSW_Interp(boardId, freq_Hz, mdevIndex, tx, &vco_query, &csw_query) == 0);
     }
-    if(foundInCache)
+    if(seeded && vco_query >= 0 && vco_query < 3)
     {
-        lime::info("SetFrequency using cache values vco:%i, csw:%i", vco_query, csw_query);
-        sel_vco = vco_query;
-        csw_value = csw_query;
+        Modify_SPI_Reg_bits(LMS7param(SEL_VCO), vco_query);
+        seeded = (TuneVCOFromSeed(tx ? VCO_SXT : VCO_SXR, csw_query) == 0);
+        if(seeded)
+        {
+            sel_vco = vco_query;
+            csw_value = Get_SPI_Reg_bits(LMS7param(CSW_VCO));
+            lime::info("SetFrequency using cache values vco:%i, csw:%i", sel_vco, csw_value);
+        }
     }
     else
+        seeded = false;
+    if(not seeded)
     {
         canDeliverFrequency = false;
         int tuneScore[] = { -128, -128, -128 }; //best is closest to 0
@@ -1557,7 +1633,8 @@ int LMS7002M::SetFrequencySX(bool tx, float_type freq_Hz, SX_details* output)
         csw_value = tuneScore[sel_vco] + 128;
         ss << "\tSelected : " << vcoNames[sel_vco] << endl;
     }
-    if(useCache && !foundInCache)
+    //only full search results are cached, seeded values may be off center
+    if(useCache && canDeliverFrequency && not seeded)
     {
         mValueCache->InsertVCO_CSW(boardId, freq_Hz, mdevIndex, tx, sel_vco, csw_value);
     }
@@ -1649,6 +1726,112 @@ int LMS7002M::SetFrequencySXWithSpurCancelation(bool tx, float_type freq_Hz, flo
     return 0;
 }
 
+//register fields written by SetFrequencySX, in order of hop table entry fields
+static const uint16_t sxHopRegisters[LMS7002M::SX_HopTable::registersCount][2] = {
+    {LMS7Fields<LMS7_EN_DIV2_DIVPROG, LMS7_EN_INTONLY_SDM, LMS7_PD_VCO_COMP, LMS7_PD_VCO>::address,
+        LMS7Fields<LMS7_EN_DIV2_DIVPROG, LMS7_EN_INTONLY_SDM, LMS7_PD_VCO_COMP, LMS7_PD_VCO>::mask},
+    {LMS7Field<LMS7_FRAC_SDM_LSB>::address, LMS7Field<LMS7_FRAC_SDM_LSB>::mask},
+    {LMS7Fields<LMS7_INT_SDM, LMS7_FRAC_SDM_MSB>::address, LMS7Fields<LMS7_INT_SDM, LMS7_FRAC_SDM_MSB>::mask},
+    {LMS7Field<LMS7_DIV_LOCH>::address, LMS7Field<LMS7_DIV_LOCH>::mask},
+    {LMS7Fields<LMS7_CSW_VCO, LMS7_SEL_VCO>::address, LMS7Fields<LMS7_CSW_VCO, LMS7_SEL_VCO>::mask},
+};
+
+/** @brief Tunes SX to each frequency and stores resulting setup for HopSX()
+    SX setup before building is restored afterwards.
+    @param tx Rx/Tx module selection
+    @param frequencies frequencies in Hz
+    @param table returns tuned entries, in order of frequencies
+    @return 0-success, other-some frequency cannot be delivered
+*/
+int LMS7002M::BuildHopTableSX(bool tx, const std::vector<float_type> &frequencies, SX_HopTable &table)
+{
+    checkConnection();
+    table.tx = tx;
+    table.referenceClock = GetReferenceClk_SX(tx);
+    table.entries.clear();
+
+    uint16_t original[SX_HopTable::registersCount];
+    int status = ReadHopFieldsSX(tx, original);
+    if (status != 0)
+        return status;
+    for (const float_type freq : frequencies)
+    {
+        status = SetFrequencySX(tx, freq);
+        if (status != 0)
+            break;
+        SX_HopTable::Entry entry;
+        entry.frequency = freq;
+        status = ReadHopFieldsSX(tx, entry.fields);
+        if (status != 0)
+            break;
+        table.entries.push_back(entry);
+    }
+    const int restoreStatus = WriteHopFieldsSX(tx, original);
+    if (status != 0)
+    {
+        table.entries.clear();
+        return status;
+    }
+    return restoreStatus;
+}
+
+/** @brief Sets SX frequency from hop table without VCO tuning
+    Only registers differing from current setup are written, in one transaction
+    when the cache matches chip.
+    @param table entries built by BuildHopTableSX()
+    @param index entry to use
+    @return 0-success, other-failure
+*/
+int LMS7002M::HopSX(const SX_HopTable &table, size_t index)
+{
+    if (index >= table.entries.size())
+        return ReportError(ERANGE, "HopSX(index = %d) - index out of range [0, %d)", int(index), int(table.entries.size()));
+    if (table.referenceClock != GetReferenceClk_SX(table.tx))
+        return ReportError(EINVAL, "HopSX - table was built for %g MHz reference clock, now %g MHz",
+                            table.referenceClock/1e6, GetReferenceClk_SX(table.tx)/1e6);
+    return WriteHopFieldsSX(table.tx, table.entries[index].fields);
+}
+
+/** @brief Reads SX register fields stored in hop table entry
+    @param tx Rx/Tx module selection
+    @param fields returns masked register values
+*/
+int LMS7002M::ReadHopFieldsSX(bool tx, uint16_t* fields)
+{
+    Channel ch = this->GetActiveChannel();
+    this->SetActiveChannel(tx?ChSXT:ChSXR);
+    int status = 0;
+    for (int i = 0; i < SX_HopTable::registersCount && status == 0; ++i)
+        fields[i] = SPI_read(sxHopRegisters[i][0], true, &status) & sxHopRegisters[i][1];
+    this->SetActiveChannel(ch); //restore used channel
+    return status;
+}
+
+/** @brief Writes SX register fields of hop table entry, other fields are kept
+    @param tx Rx/Tx module selection
+    @param fields masked register values
+*/
+int LMS7002M::WriteHopFieldsSX(bool tx, const uint16_t* fields)
+{
+    LMS7002M_SPIBatch batch(this);
+    Channel ch = this->GetActiveChannel();
+    this->SetActiveChannel(tx?ChSXT:ChSXR);
+    int status = 0;
+    for (int i = 0; i < SX_HopTable::registersCount && status == 0; ++i)
+    {
+        const uint16_t addr = sxHopRegisters[i][0];
+        const uint16_t mask = sxHopRegisters[i][1];
+        const uint16_t current = SPI_read(addr, true, &status);
+        const uint16_t value = (current & ~mask) | (fields[i] & mask);
+        if (status == 0 && value != current)
+            SPI_write(addr, value);
+    }
+    this->SetActiveChannel(ch); //restore used channel
+    if (status != 0)
+        return status;
+    return FlushSPIBatch();
+}
+
 /**	@brief Returns currently set SXR/SXT frequency
 	@return SX frequency Hz
 */
@@ -1849,8 +2032,10 @@ int LMS7002M::SPI_write(uint16_t address, uint16_t data)
         MCU_BD* mcu = GetMCUControls();
         SPI_write(0x002D, address);
         SPI_write(0x020C, data);
+        FlushSPIBatch();
         mcu->RunProcedure(7);
         mcu->WaitForMCU(50);
+        InvalidateRegisterCache();
         return SPI_read(0x040B);
     }
     else
@@ -1865,10 +2050,10 @@ int LMS7002M::SPI_write(uint16_t address, uint16_t data)
 */
 uint16_t LMS7002M::SPI_read(uint16_t address, bool fromChip, int *status)
 {
-    if (!controlPort || fromChip == false)
+    if (!controlPort || fromChip == false || IsRegisterSynced(address))
     {
-        if (status && !controlPort)
-            *status = ReportError(ENOTCONN, "chip not connected");
+        if (status)
+            *status = controlPort ? 0 : ReportError(ENOTCONN, "chip not connected");
         int mac = mRegistersMap->GetValue(0, LMS7param(MAC).address) & 0x0003;
         int regNo = (mac == 2)? 1 : 0; //only when MAC is B -> use register space B
         if (address < 0x0100) regNo = 0; //force A when below MAC mapped register space
@@ -1882,8 +2067,10 @@ uint16_t LMS7002M::SPI_read(uint16_t address, bool fromChip, int *status)
         {
             MCU_BD* mcu = GetMCUControls();
             SPI_write(0x002D, address);
+            FlushSPIBatch();
             mcu->RunProcedure(8);
             mcu->WaitForMCU(50);
+            InvalidateRegisterCache();
             uint16_t rdVal = SPI_read(0x040B, true, status);
             return rdVal;
         }
@@ -1903,6 +2090,8 @@ uint16_t LMS7002M::SPI_read(uint16_t address, bool fromChip, int *status)
 */
 int LMS7002M::SPI_write_batch(const uint16_t* spiAddr, const uint16_t* spiData, uint16_t cnt)
 {
+    if (mSPIBatchDepth == 0)
+        UpdateWriteEpoch(true);
     int mac = mRegistersMap->GetValue(0, LMS7param(MAC).address) & 0x0003;
     std::vector<uint32_t> data(cnt);
     for (size_t i = 0; i < cnt; ++i)
@@ -1916,12 +2105,38 @@ int LMS7002M::SPI_write_batch(const uint16_t* spiAddr, const uint16_t* spiData,
 
         if (wr0) mRegistersMap->SetValue(0, spiAddr[i], spiData[i]);
         if (wr1) mRegistersMap->SetValue(1, spiAddr[i], spiData[i]);
+        SetRegisterSynced(spiAddr[i], mac);
+
+        if (mSPIBatchDepth > 0)
+        {
+            SetBatchKnown(spiAddr[i], mac);
+            //later write replaces pending one to the same register,
+            //unless active channel was changed in between
+            if (spiAddr[i] != LMS7param(MAC).address)
+            {
+                for (size_t j = mBatchAddr.size(); j-- > 0;)
+                {
+                    if (mBatchAddr[j] == LMS7param(MAC).address)
+                        break;
+                    if (mBatchAddr[j] == spiAddr[i])
+                    {
+                        mBatchAddr.erase(mBatchAddr.begin()+j);
+                        mBatchData.erase(mBatchData.begin()+j);
+                        break;
+                    }
+                }
+            }
+            mBatchAddr.push_back(spiAddr[i]);
+            mBatchData.push_back(spiData[i]);
+        }
 
         //refresh mac, because batch might also change active channel
         if(spiAddr[i] == LMS7param(MAC).address)
             mac = mRegistersMap->GetValue(0, LMS7param(MAC).address) & 0x0003;
     }
 
+    if (mSPIBatchDepth > 0)
+        return 0;
     checkConnection();
     return controlPort->WriteLMS7002MSPI(data.data(), cnt,mdevIndex);
 }
@@ -1934,6 +2149,21 @@ int LMS7002M::SPI_write_batch(const uint16_t* spiAddr, const uint16_t* spiData,
 */
 int LMS7002M::SPI_read_batch(const uint16_t* spiAddr, uint16_t* spiData, uint16_t cnt)
 {
+    if (mSPIBatchDepth > 0)
+    {
+        //registers written or read during batch are up to date in cache
+        bool known = true;
+        for (size_t i = 0; i < cnt && known; ++i)
+            known = IsBatchKnown(spiAddr[i]);
+        if (known)
+        {
+            for (size_t i = 0; i < cnt; ++i)
+                spiData[i] = SPI_read(spiAddr[i], false);
+            return 0;
+        }
+        int status = FlushSPIBatch();
+        if (status != 0) return status;
+    }
     checkConnection();
 
     std::vector<uint32_t> dataWr(cnt);
@@ -1946,6 +2176,7 @@ int LMS7002M::SPI_read_batch(const uint16_t* spiAddr, uint16_t* spiData, uint16_
 
     int status = controlPort->ReadLMS7002MSPI(dataWr.data(), dataRd.data(), cnt,mdevIndex);
     if (status != 0) return status;
+    UpdateWriteEpoch(false);
 
     int mac = mRegistersMap->GetValue(0, LMS7param(MAC).address) & 0x0003;
 
@@ -1960,10 +2191,166 @@ int LMS7002M::SPI_read_batch(const uint16_t* spiAddr, uint16_t* spiData, uint16_
 
         if (wr0) mRegistersMap->SetValue(0, spiAddr[i], spiData[i]);
         if (wr1) mRegistersMap->SetValue(1, spiAddr[i], spiData[i]);
+        SetRegisterSynced(spiAddr[i], mac);
+        if (mSPIBatchDepth > 0) SetBatchKnown(spiAddr[i], mac);
     }
     return 0;
 }
 
+/** @brief Checks if register changes only by SPI writes
+    @param address SPI address
+    @return true if register is changed by chip or MCU
+*/
+bool LMS7002M::IsVolatileRegister(uint16_t address)
+{
+    for (const auto &interval : volatileRegisters)
+        if (address >= interval[0] && address <= interval[1])
+            return true;
+    return false;
+}
+
+/** @brief Checks if register has no bits writable by SPI
+    @param address SPI address
+    @return true if writes to register have no effect
+*/
+bool LMS7002M::IsReadOnlyRegister(uint16_t address)
+{
+    for (size_t i = 0; i < sizeof(readOnlyRegisters)/sizeof(uint16_t); ++i)
+        if (readOnlyRegisters[i] == address)
+            return readOnlyRegistersMasks[i] == 0;
+    return false;
+}
+
+/** @brief Checks if register is currently changed by MCU AGC
+    @param address SPI address
+    @return true if AGC is running and controls the register
+*/
+bool LMS7002M::IsAGCRegister(uint16_t address) const
+{
+    if (not mAGCRunning)
+        return false;
+    for (const uint16_t agcAddr : agcRegisters)
+        if (address == agcAddr)
+            return true;
+    return false;
+}
+
+/** @brief Checks if cached register value can be used instead of reading chip
+    @param address SPI address, read from currently active channel
+    @return true if cached value was written to or read from chip
+*/
+bool LMS7002M::IsRegisterSynced(uint16_t address)
+{
+    if (address >= mRegistersSynced.size() || IsVolatileRegister(address) || IsAGCRegister(address))
+        return false;
+    UpdateWriteEpoch(false);
+    //channel selection itself must be known to pick register space
+    const uint16_t macAddr = LMS7param(MAC).address;
+    if (address < 0x0100)
+        return (mRegistersSynced[address] & 0x1) != 0;
+    if ((mRegistersSynced[macAddr] & 0x1) == 0)
+        return false;
+    const int mac = mRegistersMap->GetValue(0, macAddr) & 0x0003;
+    return (mRegistersSynced[address] & (mac == 2 ? 0x2 : 0x1)) != 0;
+}
+
+/** @brief Marks cached register value as matching chip
+    @param address SPI address
+    @param mac channels register was accessed with
+*/
+void LMS7002M::SetRegisterSynced(uint16_t address, int mac)
+{
+    if (address >= mRegistersSynced.size())
+        return;
+    if (((mac & 0x1) != 0) or (address < 0x0100))
+        mRegistersSynced[address] |= 0x1;
+    if (((mac & 0x2) != 0) and (address >= 0x0100))
+        mRegistersSynced[address] |= 0x2;
+}
+
+void LMS7002M::InvalidateRegisterCache(void)
+{
+    std::fill(mRegistersSynced.begin(), mRegistersSynced.end(), 0);
+}
+
+void LMS7002M::InvalidateRegisterCache(uint16_t address)
+{
+    if (address < mRegistersSynced.size())
+        mRegistersSynced[address] = 0;
+}
+
+void LMS7002M::SetAGCRunning(const bool running)
+{
+    mAGCRunning = running;
+    //gains left by AGC are not known either
+    for (const uint16_t address : agcRegisters)
+        InvalidateRegisterCache(address);
+}
+
+/** @brief Follows chip writes done by all objects using the same connection
+    Cache is invalidated when another object wrote to the chip since
+    this object last accessed it.
+    @param writing this object is about to write to the chip
+*/
+void LMS7002M::UpdateWriteEpoch(bool writing)
+{
+    std::lock_guard<std::mutex> lock(writeEpochsLock);
+    uint32_t &epoch = writeEpochs[std::make_pair(controlPort, mdevIndex)];
+    if (epoch != mWriteEpoch)
+        InvalidateRegisterCache();
+    if (writing)
+        ++epoch;
+    mWriteEpoch = epoch;
+}
+
+/** @brief Sends writes pending in batch as one transaction
+    @return 0-success, other-failure
+*/
+int LMS7002M::FlushSPIBatch()
+{
+    if (mBatchAddr.empty())
+        return 0;
+    std::vector<uint32_t> data(mBatchAddr.size());
+    for (size_t i = 0; i < data.size(); ++i)
+        data[i] = (1 << 31) | (uint32_t(mBatchAddr[i]) << 16) | mBatchData[i]; //msbit 1=SPI write
+    mBatchAddr.clear();
+    mBatchData.clear();
+
+    checkConnection();
+    UpdateWriteEpoch(true);
+    return controlPort->WriteLMS7002MSPI(data.data(), data.size(), mdevIndex);
+}
+
+/** @brief Checks if register value in cache is valid for batch reads
+    @param address SPI address, read from currently active channel
+    @return true if register was written or read during batch
+*/
+bool LMS7002M::IsBatchKnown(uint16_t address) const
+{
+    const int mac = mRegistersMap->GetValue(0, LMS7param(MAC).address) & 0x0003;
+    const uint32_t regNo = (mac == 2 && address >= 0x0100) ? 1 : 0;
+    return std::find(mBatchKnown.begin(), mBatchKnown.end(), (regNo << 16) | address) != mBatchKnown.end();
+}
+
+/** @brief Marks register cache value as valid until batch ends
+    @param address SPI address
+    @param mac channels register was accessed with
+*/
+void LMS7002M::SetBatchKnown(uint16_t address, int mac)
+{
+    if (IsVolatileRegister(address) || IsAGCRegister(address))
+        return;
+    uint32_t keys[2];
+    int count = 0;
+    if (((mac & 0x1) != 0) or (address < 0x0100))
+        keys[count++] = address;
+    if (((mac & 0x2) != 0) and (address >= 0x0100))
+        keys[count++] = (1 << 16) | address;
+    for (int i = 0; i < count; ++i)
+        if (std::find(mBatchKnown.begin(), mBatchKnown.end(), keys[i]) == mBatchKnown.end())
+            mBatchKnown.push_back(keys[i]);
+}
+
 /** @brief Performs registers test by writing known data and confirming readback data
     @return 0-registers test passed, other-failure
 */
@@ -2177,6 +2564,7 @@ bool LMS7002M::IsSynced()
     bool isSynced = true;
     int status;
 
+    FlushSPIBatch();
     Channel ch = this->GetActiveChannel();
 
     vector<uint16_t> addrToRead = mRegistersMap->GetUsedAddresses(0);
@@ -2316,6 +2704,102 @@ int LMS7002M::UploadAll()
     return 0;
 }
 
+/** @brief Writes only registers which differ from given register values
+    Registers are compared with cached values known to match chip, or with
+    explicit chip snapshot. Registers with unknown chip value and registers
+    changed by chip itself are written, read-only registers are skipped.
+    Writes of both channels are sent as one batch, active channel is kept.
+    @param target register values of channels A and B, unused addresses are skipped
+    @param snapshot chip register values, nullptr to compare with cache
+    @return 0-success, other-failure
+*/
+int LMS7002M::ApplyRegisterMap(const LMS7002M_RegistersMap &target, const LMS7002M_RegistersMap *snapshot)
+{
+    const uint16_t macAddr = LMS7param(MAC).address;
+    LMS7002M_SPIBatch batch(this);
+    Channel ch = this->GetActiveChannel(); //remember used channel
+
+    vector<uint16_t> addrToWrite;
+    vector<uint16_t> dataToWrite;
+    bool hasMac = false;
+    for (int space = 0; space < 2; ++space)
+    {
+        this->SetActiveChannel(space == 0 ? ChA : ChB);
+        addrToWrite.clear();
+        dataToWrite.clear();
+        for (const uint16_t addr : target.GetUsedAddresses(space))
+        {
+            //channel selection is written separately, B has only MAC mapped registers
+            if (addr == macAddr)
+                hasMac = true;
+            if (addr == macAddr || (space == 1 && addr < 0x0100) || IsReadOnlyRegister(addr))
+                continue;
+            const uint16_t value = target.GetValue(space, addr);
+            //registers changed by chip itself may differ from any earlier value
+            const bool known = not IsVolatileRegister(addr) && (snapshot != nullptr || IsRegisterSynced(addr));
+            const uint16_t current = snapshot ? snapshot->GetValue(space, addr) : mRegistersMap->GetValue(space, addr);
+            if (known && value == current)
+            {
+                mRegistersMap->SetValue(space, addr, value);
+                continue;
+            }
+            addrToWrite.push_back(addr);
+            dataToWrite.push_back(value);
+        }
+        if (not addrToWrite.empty())
+            SPI_write_batch(addrToWrite.data(), dataToWrite.data(), addrToWrite.size());
+        if (space == 0 && hasMac)
+        {
+            //other 0x0020 fields, while channel A is still selected
+            const uint16_t value = (target.GetValue(0, macAddr) & ~0x0003) | ChA;
+            const uint16_t current = snapshot ? (snapshot->GetValue(0, macAddr) & ~0x0003) | ChA : mRegistersMap->GetValue(0, macAddr);
+            if (value != current)
+                SPI_write(macAddr, value);
+        }
+    }
+    this->SetActiveChannel(ch); //restore last used channel
+    int status = FlushSPIBatch();
+    if (status != 0)
+        return status;
+
+    //update external band-selection to match
+    this->UpdateExternalBandSelect();
+    return 0;
+}
+
+/** @brief Copies register values of both channels into given map
+    Only registers not known to match chip are read, one batch per channel.
+    @param image receives register values of channels A and B
+    @return 0-success, other-failure
+*/
+int LMS7002M::CaptureRegisterMap(LMS7002M_RegistersMap &image)
+{
+    checkConnection();
+    const uint16_t macAddr = LMS7param(MAC).address;
+    Channel ch = this->GetActiveChannel();
+    for (int space = 0; space < 2; ++space)
+    {
+        this->SetActiveChannel(space == 0 ? ChA : ChB);
+        vector<uint16_t> addrToRead;
+        for (const uint16_t addr : mRegistersMap->GetUsedAddresses(space))
+            if (addr != macAddr && not (space == 1 && addr < 0x0100) && not IsRegisterSynced(addr))
+                addrToRead.push_back(addr);
+        if (addrToRead.empty())
+            continue;
+        //values are stored in cache by reading
+        vector<uint16_t> dataReceived(addrToRead.size(), 0);
+        int status = SPI_read_batch(addrToRead.data(), dataReceived.data(), addrToRead.size());
+        if (status != 0)
+        {
+            this->SetActiveChannel(ch);
+            return status;
+        }
+    }
+    this->SetActiveChannel(ch);
+    image = *mRegistersMap;
+    return 0;
+}
+
 /** @brief Reads all registers from the chip to host
 
 */
@@ -2548,9 +3032,11 @@ void LMS7002M::GetIQBalance(const bool tx, float_type &phase, float_type &gainI,
 
 void LMS7002M::EnterSelfCalibration(void)
 {
+    FlushSPIBatch();
     if (controlPort && mSelfCalDepth == 0)
     {
         controlPort->EnterSelfCalibration(this->GetActiveChannelIndex());
+        InvalidateRegisterCache();
     }
     mSelfCalDepth++;
 }
@@ -2559,7 +3045,10 @@ void LMS7002M::ExitSelfCalibration(void)
 {
     mSelfCalDepth--;
     if (controlPort && mSelfCalDepth == 0)
+    {
         controlPort->ExitSelfCalibration(this->GetActiveChannelIndex());
+        InvalidateRegisterCache();
+    }
 }
 
 LMS7002M_SelfCalState::LMS7002M_SelfCalState(LMS7002M *rfic):
@@ -2573,6 +3062,31 @@ LMS7002M_SelfCalState::~LMS7002M_SelfCalState(void)
     rfic->ExitSelfCalibration();
 }
 
+void LMS7002M::BeginSPIBatch(void)
+{
+    mSPIBatchDepth++;
+}
+
+int LMS7002M::EndSPIBatch(void)
+{
+    mSPIBatchDepth--;
+    if (mSPIBatchDepth != 0)
+        return 0;
+    mBatchKnown.clear();
+    return FlushSPIBatch();
+}
+
+LMS7002M_SPIBatch::LMS7002M_SPIBatch(LMS7002M *rfic):
+    rfic(rfic)
+{
+    rfic->BeginSPIBatch();
+}
+
+LMS7002M_SPIBatch::~LMS7002M_SPIBatch(void)
+{
+    rfic->EndSPIBatch();
+}
+
 void LMS7002M::EnableValuesCache(bool enabled)
 {
     if (mValueCache && (!enabled))
@@ -39,6 +39,42 @@ struct RSSI_measurements
 
 typedef double float_type;
 
+/*!
+ * Register field with position known at compile time,
+ * mask and shift of a parameter fold into constants.
+ */
+template<const LMS7Parameter &P>
+struct LMS7Field
+{
+    static_assert(P.msb >= P.lsb && P.msb < 16, "invalid field bits");
+    static constexpr uint16_t address = P.address;
+    static constexpr uint16_t mask = uint16_t(((1u << (P.msb - P.lsb + 1)) - 1) << P.lsb);
+    static constexpr uint16_t Encode(uint16_t value) {return uint16_t(value << P.lsb) & mask;}
+    static constexpr uint16_t Decode(uint16_t reg) {return (reg & mask) >> P.lsb;}
+};
+
+/*!
+ * Several fields of the same register, modified by single read-modify-write.
+ */
+template<const LMS7Parameter &... P>
+struct LMS7Fields;
+
+template<const LMS7Parameter &P>
+struct LMS7Fields<P> : LMS7Field<P>
+{
+    static uint16_t Encode(const uint16_t *values) {return LMS7Field<P>::Encode(values[0]);}
+};
+
+template<const LMS7Parameter &P, const LMS7Parameter &... Rest>
+struct LMS7Fields<P, Rest...>
+{
+    static_assert(LMS7Fields<Rest...>::address == P.address, "fields must be in the same register");
+    static_assert((LMS7Field<P>::mask & LMS7Fields<Rest...>::mask) == 0, "fields must not overlap");
+    static constexpr uint16_t address = P.address;
+    static constexpr uint16_t mask = LMS7Field<P>::mask | LMS7Fields<Rest...>::mask;
+    static uint16_t Encode(const uint16_t *values) {return LMS7Field<P>::Encode(values[0]) | LMS7Fields<Rest...>::Encode(values+1);}
+};
+
 class LIME_API LMS7002M
 {
 public:
@@ -72,6 +108,23 @@ public:
         bool success;
     };
 
+    /*!
+     * SX setups for a list of frequencies, tuned in advance by BuildHopTableSX().
+     * Entries keep register fields set by SetFrequencySX.
+     */
+    struct SX_HopTable
+    {
+        static const int registersCount = 5;
+        struct Entry
+        {
+            float_type frequency;
+            uint16_t fields[registersCount];
+        };
+        bool tx;
+        float_type referenceClock;
+        std::vector<Entry> entries;
+    };
+
 	LMS7002M();
 
     /*!
@@ -133,6 +186,8 @@ public:
     ///@name Registers writing and reading
     int UploadAll();
     int DownloadAll();
+    int ApplyRegisterMap(const LMS7002M_RegistersMap &target, const LMS7002M_RegistersMap *snapshot = nullptr);
+    int CaptureRegisterMap(LMS7002M_RegistersMap &image);
     bool IsSynced();
     int CopyChannelRegisters(const Channel src, const Channel dest, bool copySX);
 
@@ -154,7 +209,37 @@ public:
     int Modify_SPI_Reg_bits(uint16_t address, uint8_t msb, uint8_t lsb, uint16_t value, bool fromChip = false);
     int SPI_write(uint16_t address, uint16_t data);
     uint16_t SPI_read(uint16_t address, bool fromChip = false, int *status = 0);
+
+    ///Compile time parameters, e.g. Get_SPI_Reg_bits<LMS7param(MAC)>()
+    template<const LMS7Parameter &P>
+    uint16_t Get_SPI_Reg_bits(bool fromChip = false)
+    {
+        return LMS7Field<P>::Decode(SPI_read(P.address, fromChip));
+    }
+    template<const LMS7Parameter &P>
+    int Modify_SPI_Reg_bits(const uint16_t value, bool fromChip = false)
+    {
+        const uint16_t reg = SPI_read(P.address, fromChip);
+        return SPI_write(P.address, (reg & ~LMS7Field<P>::mask) | LMS7Field<P>::Encode(value));
+    }
+    ///Modifies several fields of the same register with one read and one write
+    template<const LMS7Parameter &... P>
+    int Modify_SPI_Reg_bits(const uint16_t (&values)[sizeof...(P)], bool fromChip = false)
+    {
+        typedef LMS7Fields<P...> Fields;
+        const uint16_t reg = SPI_read(Fields::address, fromChip);
+        return SPI_write(Fields::address, (reg & ~Fields::mask) | Fields::Encode(values));
+    }
     int RegistersTest(const char* fileName = "registersTest.txt");
+
+    ///Reads from chip are skipped for registers whose cached value
+    ///was written to or read from chip, unless the register is volatile.
+    ///Call when chip registers might have been changed by other means.
+    void InvalidateRegisterCache(void);
+    ///Next read of the register, in both channels, goes to chip
+    void InvalidateRegisterCache(uint16_t address);
+    ///Gain registers are read from chip while MCU AGC is changing them
+    void SetAGCRunning(const bool running);
     ///@}
 
     ///@name Calibration protection:
@@ -166,6 +251,16 @@ public:
     void ExitSelfCalibration(void);
     ///@}
 
+    ///@name Register writes batching:
+    ///Writes between begin and end are merged per register
+    ///and sent in one transaction when the outermost batch ends.
+    ///Reads that need the chip send pending writes first.
+    ///Safe to nest calls, always match begin+end.
+    void BeginSPIBatch(void);
+    int EndSPIBatch(void);
+    int FlushSPIBatch(void);
+    ///@}
+
     ///@name Transmitter, Receiver calibrations
     int CalibrateRx(float_type bandwidth, const bool useExtLoopback = false);
     int CalibrateTx(float_type bandwidth, const bool useExtLoopback = false);
@@ -306,6 +401,8 @@ public:
 	float_type GetFrequencySX(bool tx);
     int SetFrequencySX(bool tx, float_type freq_Hz, SX_details* output = nullptr);
     int SetFrequencySXWithSpurCancelation(bool tx, float_type freq_Hz, float_type BW);
+    int BuildHopTableSX(bool tx, const std::vector<float_type> &frequencies, SX_HopTable &table);
+    int HopSX(const SX_HopTable &table, size_t index);
 	bool GetSXLocked(bool tx);
     ///VCO modules available for tuning
     enum VCO_Module
@@ -313,6 +410,7 @@ public:
         VCO_CGEN, VCO_SXR, VCO_SXT
     };
     int TuneVCO(VCO_Module module);
+    int TuneVCOFromSeed(VCO_Module module, int csw);
     ///@}
 
     ///@name TSP
@@ -446,6 +544,8 @@ protected:
 
     static const uint16_t readOnlyRegisters[];
     static const uint16_t readOnlyRegistersMasks[];
+    static const uint16_t volatileRegisters[][2];
+    static const uint16_t agcRegisters[];
 
 
     uint16_t MemorySectionAddresses[MEMORY_SECTIONS_COUNT][2];
@@ -505,6 +605,30 @@ protected:
     unsigned mdevIndex;
     size_t mSelfCalDepth;
 
+    int ReadHopFieldsSX(bool tx, uint16_t* fields);
+    int WriteHopFieldsSX(bool tx, const uint16_t* fields);
+
+    ///@name Pending batch writes
+    size_t mSPIBatchDepth;
+    std::vector<uint16_t> mBatchAddr;
+    std::vector<uint16_t> mBatchData;
+    std::vector<uint32_t> mBatchKnown; ///<register space<<16|address with value in cache
+    bool IsBatchKnown(uint16_t address) const;
+    void SetBatchKnown(uint16_t address, int mac);
+    ///@}
+
+    ///@name Registers with cache matching chip
+    std::vector<uint8_t> mRegistersSynced; ///<bit 0 register space A, bit 1 space B
+    uint32_t mWriteEpoch; ///<connection write count after last access by this object
+    bool mAGCRunning; ///<MCU AGC changes gain registers
+    static bool IsVolatileRegister(uint16_t address);
+    bool IsAGCRegister(uint16_t address) const;
+    static bool IsReadOnlyRegister(uint16_t address);
+    bool IsRegisterSynced(uint16_t address);
+    void SetRegisterSynced(uint16_t address, int mac);
+    void UpdateWriteEpoch(bool writing);
+    ///@}
+
     int LoadConfigLegacyFile(const char* filename);
 };
 
@@ -523,6 +647,20 @@ private:
     LMS7002M *rfic;
 };
 
+/*!
+ * Helper class to begin register writes batch upon construction,
+ * and to send merged writes upon exit.
+ */
+class LIME_API LMS7002M_SPIBatch
+{
+public:
+    LMS7002M_SPIBatch(LMS7002M *rfic);
+    ~LMS7002M_SPIBatch(void);
+
+private:
+    LMS7002M *rfic;
+};
+
 
 }
 #endif
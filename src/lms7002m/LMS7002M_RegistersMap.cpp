@@ -2,7 +2,9 @@
 #include "LMS7002M_parameters.h"
 using namespace lime;
 
-LMS7002M_RegistersMap::LMS7002M_RegistersMap()
+LMS7002M_RegistersMap::LMS7002M_RegistersMap() :
+    mChannelA(),
+    mChannelB()
 {
 
 }
@@ -14,9 +16,8 @@ LMS7002M_RegistersMap::~LMS7002M_RegistersMap()
 
 uint16_t LMS7002M_RegistersMap::GetDefaultValue(uint16_t address) const
 {
-    auto iter = mChannelA.find(address);
-    if( iter != mChannelA.end())
-        return iter->second.defaultValue;
+    if (address < addressCount)
+        return mChannelA[address].defaultValue;
     else
         return 0;
 }
@@ -25,48 +26,58 @@ void LMS7002M_RegistersMap::InitializeDefaultValues(const std::vector<const LMS7
 {
     for(auto parameter : parameterList)
     {
-        uint16_t regValue = mChannelA[parameter->address].defaultValue;
-        mChannelA[parameter->address].defaultValue = regValue | (parameter->defaultValue << parameter->lsb);
-        mChannelA[parameter->address].value = mChannelA[parameter->address].defaultValue;
+        if (parameter->address >= addressCount)
+            continue;
+        Register &reg = mChannelA[parameter->address];
+        reg.defaultValue |= parameter->defaultValue << parameter->lsb;
+        reg.value = reg.defaultValue;
+        mUsedA.set(parameter->address);
         if(parameter->address >= 0x0100)
-            mChannelB[parameter->address].value = mChannelA[parameter->address].value;
+        {
+            mChannelB[parameter->address].value = reg.value;
+            mUsedB.set(parameter->address);
+        }
     }
     //add NCO/PHO registers
     const uint16_t addr = 0x0242;
     for (int i = 0; i < 32; ++i)
-    {   
-        mChannelA[addr + i].defaultValue = 0;
-        mChannelA[addr + i].value = 0;
-        mChannelB[addr + i].defaultValue = 0;
-        mChannelB[addr + i].value = 0;
-        mChannelA[addr + i + 0x0200].defaultValue = 0;
-        mChannelA[addr + i + 0x0200].value = 0;
-        mChannelB[addr + i + 0x0200].defaultValue = 0;
-        mChannelB[addr + i + 0x0200].value = 0;
+    {
+        for (const uint16_t address : {uint16_t(addr + i), uint16_t(addr + i + 0x0200)})
+        {
+            mChannelA[address].defaultValue = 0;
+            mChannelA[address].value = 0;
+            mChannelB[address].defaultValue = 0;
+            mChannelB[address].value = 0;
+            mUsedA.set(address);
+            mUsedB.set(address);
+        }
     }
 }
 
 void LMS7002M_RegistersMap::SetValue(uint8_t channel, const uint16_t address, const uint16_t value)
 {
+    if (address >= addressCount)
+        return;
     if(channel == 0)
+    {
         mChannelA[address].value = value;
+        mUsedA.set(address);
+    }
     else if(channel == 1)
+    {
         mChannelB[address].value = value;
+        mUsedB.set(address);
+    }
 }
 
 uint16_t LMS7002M_RegistersMap::GetValue(uint8_t channel, uint16_t address) const
 {
-    const std::map<const uint16_t, Register> *regMap(nullptr);
+    if (address >= addressCount)
+        return 0;
     if(channel == 0)
-        regMap = &mChannelA;
+        return mChannelA[address].value;
     else if(channel == 1)
-        regMap = &mChannelB;
-    else
-        return 0;
-    std::map<const uint16_t, Register>::const_iterator iter;
-    iter = regMap->find(address);
-    if (iter != regMap->end())
-        return iter->second.value;
+        return mChannelB[address].value;
     else
         return 0;
 }
@@ -74,11 +85,15 @@ uint16_t LMS7002M_RegistersMap::GetValue(uint8_t channel, uint16_t address) cons
 std::vector<uint16_t> LMS7002M_RegistersMap::GetUsedAddresses(const uint8_t channel) const
 {
     std::vector<uint16_t> addresses;
+    const std::bitset<addressCount> *used(nullptr);
     if(channel == 0)
-        for(auto iter : mChannelA)
-            addresses.push_back(iter.first);
+        used = &mUsedA;
     else if(channel == 1)
-        for(auto iter : mChannelB)
-            addresses.push_back(iter.first);
+        used = &mUsedB;
+    else
+        return addresses;
+    for (uint16_t address = 0; address < addressCount; ++address)
+        if (used->test(address))
+            addresses.push_back(address);
     return addresses;
 }
@@ -1,15 +1,16 @@
 #ifndef LMS7002M_REGISTERS_MAP_H
 #define LMS7002M_REGISTERS_MAP_H
 
+#include "LimeSuiteConfig.h"
 #include <vector>
-#include <map>
+#include <bitset>
 #include <cstdint>
 struct LMS7Parameter;
 namespace lime{
 
 
 
-class LMS7002M_RegistersMap
+class LIME_API LMS7002M_RegistersMap
 {
 public:
     struct Register
@@ -19,6 +20,9 @@ public:
         uint16_t mask;
     };
 
+    ///Size of chip address space, registers are stored in arrays indexed by address
+    static const uint16_t addressCount = 0x0800;
+
     LMS7002M_RegistersMap();
     ~LMS7002M_RegistersMap();
 
@@ -29,16 +33,11 @@ public:
     uint16_t GetDefaultValue(uint16_t address) const;
     std::vector<uint16_t> GetUsedAddresses(const uint8_t channel) const;
 
-    LMS7002M_RegistersMap &operator=(const LMS7002M_RegistersMap &other)
-    {
-        mChannelA.insert(other.mChannelA.begin(), other.mChannelA.end());
-        mChannelB.insert(other.mChannelB.begin(), other.mChannelB.end());
-        return *this;
-    }
-
 protected:
-    std::map<const uint16_t, Register> mChannelA;
-    std::map<const uint16_t, Register> mChannelB;
+    Register mChannelA[addressCount];
+    Register mChannelB[addressCount];
+    std::bitset<addressCount> mUsedA; ///<addresses present in register space A
+    std::bitset<addressCount> mUsedB; ///<addresses present in register space B
 };
 
 }
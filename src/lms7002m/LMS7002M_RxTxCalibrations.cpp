@@ -975,6 +975,7 @@ int LMS7002M::CalibrateTx(float_type bandwidth_Hz, bool useExtLoopback)
         mcuControl->SetParameter(MCU_BD::MCU_BW, bandwidth_Hz);
         mcuControl->RunProcedure(MCU_FUNCTION_CALIBRATE_TX);
         status = mcuControl->WaitForMCU(1000);
+        InvalidateRegisterCache();
         if(status != 0)
         {
             ReportError("MCU working too long %i", status);
@@ -1852,6 +1853,7 @@ int LMS7002M::CalibrateRx(float_type bandwidth_Hz, bool useExtLoopback)
         mcuControl->SetParameter(MCU_BD::MCU_BW, bandwidth_Hz);
         mcuControl->RunProcedure(MCU_FUNCTION_CALIBRATE_RX);
         status = mcuControl->WaitForMCU(1000);
+        InvalidateRegisterCache();
         if(status != 0)
         {
             ReportError("MCU working too long %i", status);
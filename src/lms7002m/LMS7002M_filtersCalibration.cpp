@@ -55,17 +55,14 @@ static int clamp(int value, int minBound, int maxBound)
 LMS7002M_RegistersMap *LMS7002M::BackupRegisterMap(void)
 {
     //BackupAllRegisters(); return NULL;
-    auto backup = new LMS7002M_RegistersMap();
-    Channel chBck = this->GetActiveChannel();
-    this->SetActiveChannel(ChA);
-    *backup = *mRegistersMap;
-    this->SetActiveChannel(chBck);
-    return backup;
+    //register arrays are copied as is, no chip access is needed
+    return new LMS7002M_RegistersMap(*mRegistersMap);
 }
 
 void LMS7002M::RestoreRegisterMap(LMS7002M_RegistersMap *backup)
 {
     //RestoreAllRegisters(); return;
+    const uint16_t macAddr = LMS7param(MAC).address;
     Channel chBck = this->GetActiveChannel();
 
     for (int ch = 0; ch < 2; ch++)
@@ -75,6 +72,8 @@ void LMS7002M::RestoreRegisterMap(LMS7002M_RegistersMap *backup)
         std::vector<uint16_t> restoreAddrs, restoreData;
         for (const uint16_t addr : mRegistersMap->GetUsedAddresses(ch))
         {
+            //channel selection of backup could redirect the batch, written separately
+            if (addr == macAddr) continue;
             uint16_t original = backup->GetValue(ch, addr);
             uint16_t current = mRegistersMap->GetValue(ch, addr);
             mRegistersMap->SetValue(ch, addr, original);
@@ -88,6 +87,13 @@ void LMS7002M::RestoreRegisterMap(LMS7002M_RegistersMap *backup)
         //bulk write the original register values from backup
         this->SetActiveChannel((ch==0)?ChA:ChB);
         SPI_write_batch(restoreAddrs.data(), restoreData.data(), restoreData.size());
+        if (ch == 0)
+        {
+            //other 0x0020 fields, while channel A is still selected
+            const uint16_t original = (backup->GetValue(0, macAddr) & ~0x0003) | ChA;
+            if (original != mRegistersMap->GetValue(0, macAddr))
+                SPI_write(macAddr, original);
+        }
     }
 
     //cleanup
@@ -130,6 +136,7 @@ int LMS7002M::TuneRxFilter(float_type rx_lpf_freq_RF)
         mcuControl->SetParameter(MCU_BD::MCU_BW, rx_lpf_freq_RF);
         mcuControl->RunProcedure(5);
         status = mcuControl->WaitForMCU(1000);
+        InvalidateRegisterCache();
         if(status != 0)
         {
             lime::error("MCU working too long %i", status);
@@ -937,6 +944,7 @@ int LMS7002M::TuneTxFilter(const float_type tx_lpf_freq_RF)
         mcuControl->SetParameter(MCU_BD::MCU_BW, tx_lpf_freq_RF);
         mcuControl->RunProcedure(6);
         status = mcuControl->WaitForMCU(1000);
+        InvalidateRegisterCache();
         if(status != 0)
         {
             lime::error("MCU working too long %i", status);
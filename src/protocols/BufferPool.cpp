@@ -0,0 +1,220 @@
+/**
+    @file BufferPool.cpp
+    @author Lime Microsystems
+    @brief Reusable page aligned memory blocks for streaming buffers.
+*/
+
+#include "BufferPool.h"
+#include "Logger.h"
+#include "Numa.h"
+#include <cstring>
+#include <ciso646>
+
+#ifndef __unix__
+#include "windows.h"
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+using namespace lime;
+
+static const size_t hugePageSize = 2*1024*1024;
+static const size_t defaultCacheLimit = 512*1024*1024;
+
+static size_t GetPageSize()
+{
+#ifndef __unix__
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwPageSize;
+#else
+    long size = sysconf(_SC_PAGESIZE);
+    return size > 0 ? size : 4096;
+#endif
+}
+
+BufferPool& BufferPool::Instance()
+{
+    //never destroyed, buffers may be released from other static destructors
+    static BufferPool* pool = new BufferPool();
+    return *pool;
+}
+
+BufferPool::BufferPool() :
+    cachedSize(0),
+    cacheLimit(defaultCacheLimit)
+{
+}
+
+void* BufferPool::Allocate(size_t size, unsigned flags, int numaNode)
+{
+    const size_t align = (flags & HUGE_PAGES) ? hugePageSize : GetPageSize();
+    size = (size + align - 1) / align * align;
+    const unsigned mapFlags = flags & (HUGE_PAGES | LOCK_MEMORY);
+
+    std::unique_lock<std::mutex> lck(lock);
+    //reuse block of the same kind, allow up to twice the requested size
+    for (auto it = freeBlocks.lower_bound(size); it != freeBlocks.end() && it->first < 2*size; ++it)
+    {
+        Block block = it->second;
+        if ((block.flags & (HUGE_PAGES | LOCK_MEMORY)) != mapFlags || block.node != numaNode)
+            continue;
+        freeBlocks.erase(it);
+        cachedSize -= block.size;
+        if ((flags & PREFAULT) and not (block.flags & PREFAULT))
+        {
+            Prefault(block);
+            block.flags |= PREFAULT;
+        }
+        usedBlocks[block.ptr] = block;
+        return block.ptr;
+    }
+    lck.unlock();
+
+    Block block;
+    block.size = size;
+    block.flags = flags;
+    block.node = numaNode;
+    block.locked = false;
+    block.hugePages = false;
+    if (not MapBlock(block))
+        return nullptr;
+    if (flags & PREFAULT)
+        Prefault(block);
+
+    lck.lock();
+    usedBlocks[block.ptr] = block;
+    return block.ptr;
+}
+
+void BufferPool::Free(void* ptr)
+{
+    if (ptr == nullptr)
+        return;
+    std::unique_lock<std::mutex> lck(lock);
+    auto it = usedBlocks.find(ptr);
+    if (it == usedBlocks.end())
+    {
+        lime::error("BufferPool: freeing unknown memory block");
+        return;
+    }
+    Block block = it->second;
+    usedBlocks.erase(it);
+    if (cachedSize + block.size <= cacheLimit)
+    {
+        freeBlocks.insert(std::make_pair(block.size, block));
+        cachedSize += block.size;
+        return;
+    }
+    lck.unlock();
+    UnmapBlock(block);
+}
+
+void BufferPool::Trim()
+{
+    std::unique_lock<std::mutex> lck(lock);
+    std::multimap<size_t, Block> blocks;
+    blocks.swap(freeBlocks);
+    cachedSize = 0;
+    lck.unlock();
+    for (auto& i : blocks)
+        UnmapBlock(i.second);
+}
+
+void BufferPool::SetCacheLimit(size_t bytes)
+{
+    std::unique_lock<std::mutex> lck(lock);
+    cacheLimit = bytes;
+    if (cachedSize <= cacheLimit)
+        return;
+    lck.unlock();
+    Trim();
+}
+
+size_t BufferPool::GetCachedSize()
+{
+    std::unique_lock<std::mutex> lck(lock);
+    return cachedSize;
+}
+
+bool BufferPool::MapBlock(Block& block)
+{
+#ifndef __unix__
+    block.ptr = nullptr;
+    if (block.flags & HUGE_PAGES) //requires SeLockMemoryPrivilege
+        block.ptr = VirtualAlloc(nullptr, block.size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+    block.hugePages = block.ptr != nullptr;
+    if (block.ptr == nullptr)
+        block.ptr = VirtualAlloc(nullptr, block.size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+    if (block.ptr == nullptr)
+    {
+        lime::error("BufferPool: failed to allocate %lu bytes", (unsigned long)block.size);
+        return false;
+    }
+    if (block.flags & LOCK_MEMORY)
+    {
+        block.locked = VirtualLock(block.ptr, block.size) != 0;
+        if (not block.locked)
+            lime::warning("BufferPool: failed to lock %lu bytes in memory", (unsigned long)block.size);
+    }
+#else
+    int mapFlags = MAP_PRIVATE | MAP_ANONYMOUS;
+#ifdef MAP_POPULATE
+    //pages of NUMA bound blocks are touched after setting memory policy
+    if ((block.flags & PREFAULT) && block.node < 0)
+        mapFlags |= MAP_POPULATE;
+#endif
+    block.ptr = MAP_FAILED;
+#ifdef MAP_HUGETLB
+    if (block.flags & HUGE_PAGES)
+        block.ptr = mmap(nullptr, block.size, PROT_READ | PROT_WRITE, mapFlags | MAP_HUGETLB, -1, 0);
+#endif
+    block.hugePages = block.ptr != MAP_FAILED;
+    if (block.ptr == MAP_FAILED)
+        block.ptr = mmap(nullptr, block.size, PROT_READ | PROT_WRITE, mapFlags, -1, 0);
+    if (block.ptr == MAP_FAILED)
+    {
+        block.ptr = nullptr;
+        lime::error("BufferPool: failed to allocate %lu bytes", (unsigned long)block.size);
+        return false;
+    }
+#ifdef MADV_HUGEPAGE
+    //no reserved huge pages, ask for transparent huge pages instead
+    if ((block.flags & HUGE_PAGES) and not block.hugePages)
+        madvise(block.ptr, block.size, MADV_HUGEPAGE);
+#endif
+    if (block.node >= 0)
+        numa::BindMemory(block.ptr, block.size, block.node);
+    if (block.flags & LOCK_MEMORY)
+    {
+        block.locked = mlock(block.ptr, block.size) == 0;
+        if (not block.locked)
+            lime::warning("BufferPool: failed to lock %lu bytes in memory, check RLIMIT_MEMLOCK", (unsigned long)block.size);
+    }
+#endif
+    return true;
+}
+
+void BufferPool::UnmapBlock(Block& block)
+{
+#ifndef __unix__
+    if (block.locked)
+        VirtualUnlock(block.ptr, block.size);
+    VirtualFree(block.ptr, 0, MEM_RELEASE);
+#else
+    if (block.locked)
+        munlock(block.ptr, block.size);
+    munmap(block.ptr, block.size);
+#endif
+    block.ptr = nullptr;
+}
+
+void BufferPool::Prefault(Block& block)
+{
+    //write to every page, so later accesses do not fault
+    const size_t step = GetPageSize();
+    volatile char* mem = static_cast<char*>(block.ptr);
+    for (size_t i = 0; i < block.size; i += step)
+        mem[i] = 0;
+}
@@ -0,0 +1,144 @@
+/**
+    @file BufferPool.h
+    @author Lime Microsystems
+    @brief Reusable page aligned memory blocks for streaming buffers.
+*/
+
+#pragma once
+#include "LimeSuiteConfig.h"
+#include <cstddef>
+#include <mutex>
+#include <map>
+#include <new>
+
+namespace lime{
+
+/*!
+ * BufferPool hands out page aligned memory blocks for the stream FIFOs
+ * and the data transfer buffers. Released blocks are kept mapped (and
+ * locked, if requested) so that setting up and starting streams again
+ * does not allocate or page fault.
+ */
+class LIME_API BufferPool
+{
+public:
+    //! Allocation options, can be combined
+    enum Flags
+    {
+        PREFAULT = 1,       ///<touch all pages when memory is allocated
+        HUGE_PAGES = 2,     ///<try to back memory with 2 MB huge pages
+        LOCK_MEMORY = 4,    ///<lock memory in RAM (mlock)
+    };
+
+    //! @brief Returns process wide buffer pool
+    static BufferPool& Instance();
+
+    /** @brief Returns memory block of at least given size
+        @param size block size in bytes
+        @param flags combination of Flags
+        @param numaNode preferred NUMA node for the memory, -1 for any
+        @return pointer to memory block, nullptr on failure
+    */
+    void* Allocate(size_t size, unsigned flags = PREFAULT, int numaNode = -1);
+
+    /** @brief Returns memory block to the pool for later reuse
+        @param ptr pointer previously returned by Allocate()
+    */
+    void Free(void* ptr);
+
+    //! @brief Releases all unused blocks back to the system
+    void Trim();
+
+    /** @brief Sets the amount of unused memory kept for reuse
+        @param bytes maximum size of unused blocks, 0 disables caching
+    */
+    void SetCacheLimit(size_t bytes);
+
+    //! @brief Returns size of unused blocks kept for reuse
+    size_t GetCachedSize();
+
+private:
+    struct Block
+    {
+        void* ptr;
+        size_t size;        ///<size of mapped region
+        unsigned flags;     ///<requested flags
+        int node;           ///<NUMA node, -1 for any
+        bool locked;
+        bool hugePages;
+    };
+    BufferPool();
+    BufferPool(const BufferPool&) = delete;
+    BufferPool& operator=(const BufferPool&) = delete;
+
+    bool MapBlock(Block& block);
+    void UnmapBlock(Block& block);
+    void Prefault(Block& block);
+
+    std::multimap<size_t, Block> freeBlocks; ///<unused blocks by size
+    std::map<void*, Block> usedBlocks;
+    size_t cachedSize;
+    size_t cacheLimit;
+    std::mutex lock;
+};
+
+/*!
+ * Owns array of trivially copyable items allocated from the BufferPool,
+ * memory is returned to the pool when object goes out of scope.
+ */
+template<typename T>
+class PooledBuffer
+{
+public:
+    PooledBuffer() : mData(nullptr), mCount(0) {};
+
+    PooledBuffer(size_t count, unsigned flags = BufferPool::PREFAULT, int numaNode = -1) : mData(nullptr), mCount(0)
+    {
+        Allocate(count, flags, numaNode);
+    }
+
+    ~PooledBuffer()
+    {
+        Release();
+    }
+
+    /** @brief Allocates storage for given number of items, previous contents are lost
+        @param count number of items
+        @param flags BufferPool allocation flags
+        @param numaNode preferred NUMA node, -1 for any
+        @throws std::bad_alloc when memory can not be allocated
+    */
+    void Allocate(size_t count, unsigned flags = BufferPool::PREFAULT, int numaNode = -1)
+    {
+        Release();
+        if (count == 0)
+            return;
+        mData = static_cast<T*>(BufferPool::Instance().Allocate(count*sizeof(T), flags, numaNode));
+        if (mData == nullptr)
+            throw std::bad_alloc();
+        mCount = count;
+    }
+
+    //! @brief Returns storage to the pool
+    void Release()
+    {
+        if (mData)
+            BufferPool::Instance().Free(mData);
+        mData = nullptr;
+        mCount = 0;
+    }
+
+    T* Data() {return mData;}
+    const T* Data() const {return mData;}
+    size_t Size() const {return mCount;}
+    T& operator[](size_t i) {return mData[i];}
+    const T& operator[](size_t i) const {return mData[i];}
+
+private:
+    PooledBuffer(const PooledBuffer&) = delete;
+    PooledBuffer& operator=(const PooledBuffer&) = delete;
+    T* mData;
+    size_t mCount;
+};
+
+}
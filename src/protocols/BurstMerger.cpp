@@ -0,0 +1,209 @@
+/**
+    @file BurstMerger.cpp
+    @author Lime Microsystems
+    @brief Merges timestamped TX bursts from several threads.
+*/
+
+#include "BurstMerger.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+using namespace lime;
+
+BurstMerger::BurstMerger(const uint32_t capacity) :
+    capacity(capacity),
+    queued(0),
+    submitted(nullptr),
+    overlaps(0),
+    clearScheduled(false),
+    freeBursts(nullptr),
+    current(nullptr),
+    offset(0),
+    sentUntil(0),
+    sentAny(false)
+{
+}
+
+BurstMerger::~BurstMerger()
+{
+    Clear();
+    DropScheduled();
+    while (freeBursts)
+    {
+        Burst* next = freeBursts->next;
+        delete freeBursts;
+        freeBursts = next;
+    }
+}
+
+BurstMerger::Burst* BurstMerger::Allocate(const uint32_t count, const int32_t timeout_ms)
+{
+    if (count == 0 || count > capacity)
+        return nullptr;
+    //reserve space without a lock, sleep only when the queue is full
+    uint32_t used = queued.load();
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+    while (true)
+    {
+        if (used + count <= capacity)
+        {
+            if (queued.compare_exchange_weak(used, used + count))
+                break;
+            continue;
+        }
+        std::unique_lock<std::mutex> lck(waitLock);
+        if (not spaceFreed.wait_until(lck, deadline, [&]{return queued.load() + count <= capacity;}))
+            return nullptr;
+        used = queued.load();
+    }
+    Burst* burst = nullptr;
+    {
+        std::lock_guard<std::mutex> lck(freeLock);
+        burst = freeBursts;
+        if (burst)
+            freeBursts = burst->next;
+    }
+    if (burst == nullptr)
+        burst = new Burst;
+    burst->next = nullptr;
+    burst->timestamp = 0;
+    burst->count = count;
+    burst->samples.resize(count);
+    return burst;
+}
+
+void BurstMerger::Submit(Burst* burst, const uint64_t timestamp)
+{
+    burst->timestamp = timestamp;
+    burst->next = submitted.load();
+    while (not submitted.compare_exchange_weak(burst->next, burst))
+        ;
+    //transmit thread checks the list under waitLock before sleeping
+    {
+        std::lock_guard<std::mutex> lck(waitLock);
+    }
+    burstSubmitted.notify_one();
+}
+
+void BurstMerger::Discard(Burst* burst)
+{
+    Release(burst);
+}
+
+void BurstMerger::Release(Burst* burst)
+{
+    const uint32_t count = burst->count;
+    {
+        std::lock_guard<std::mutex> lck(freeLock);
+        burst->next = freeBursts;
+        freeBursts = burst;
+    }
+    //producers check free space under waitLock before sleeping
+    {
+        std::lock_guard<std::mutex> lck(waitLock);
+        queued -= count;
+    }
+    spaceFreed.notify_all();
+}
+
+/** @brief Moves submitted bursts to timestamp ordered schedule
+*/
+void BurstMerger::Collect()
+{
+    Burst* burst = submitted.exchange(nullptr);
+    while (burst)
+    {
+        Burst* next = burst->next;
+        scheduled.insert(std::make_pair(burst->timestamp, burst));
+        burst = next;
+    }
+}
+
+uint32_t BurstMerger::ReadPackets(complex16_t* samples, const uint32_t packetSize, const uint32_t packetsCount, IStreamChannel::Metadata* meta, uint32_t* counts, const int32_t timeout_ms)
+{
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+    uint32_t packets = 0;
+    if (clearScheduled.exchange(false))
+        DropScheduled();
+    while (packets < packetsCount)
+    {
+        if (current == nullptr)
+        {
+            Collect();
+            //earliest burst that does not overlap already sent samples
+            while (not scheduled.empty() && current == nullptr)
+            {
+                Burst* burst = scheduled.begin()->second;
+                scheduled.erase(scheduled.begin());
+                if (sentAny && burst->timestamp < sentUntil)
+                {
+                    ++overlaps;
+                    Release(burst);
+                    continue;
+                }
+                current = burst;
+                offset = 0;
+            }
+            if (current == nullptr)
+            {
+                if (packets > 0 || std::chrono::steady_clock::now() >= deadline)
+                    break;
+                std::unique_lock<std::mutex> lck(waitLock);
+                burstSubmitted.wait_until(lck, deadline, [this]{return submitted.load() != nullptr;});
+                continue;
+            }
+        }
+
+        const uint32_t cnt = std::min(packetSize, current->count - offset);
+        memcpy(&samples[packets*packetSize], &current->samples[offset], cnt*sizeof(complex16_t));
+        meta[packets].timestamp = current->timestamp + offset;
+        meta[packets].flags = IStreamChannel::Metadata::SYNC_TIMESTAMP;
+        counts[packets] = cnt;
+        offset += cnt;
+        ++packets;
+        if (offset == current->count)
+        {
+            meta[packets-1].flags |= IStreamChannel::Metadata::END_BURST;
+            sentUntil = current->timestamp + current->count;
+            sentAny = true;
+            Release(current);
+            current = nullptr;
+            //caller pads partial packet, it must be the last one
+            if (cnt < packetSize)
+                break;
+        }
+    }
+    return packets;
+}
+
+void BurstMerger::Clear()
+{
+    //submitted list is shared, schedule is left to transmit thread
+    Burst* burst = submitted.exchange(nullptr);
+    while (burst)
+    {
+        Burst* next = burst->next;
+        Release(burst);
+        burst = next;
+    }
+    clearScheduled = true;
+}
+
+/** @brief Drops bursts taken by transmit thread
+*/
+void BurstMerger::DropScheduled()
+{
+    for (auto &entry : scheduled)
+        Release(entry.second);
+    scheduled.clear();
+    if (current)
+        Release(current);
+    current = nullptr;
+    sentAny = false;
+}
+
+uint32_t BurstMerger::TakeOverlaps()
+{
+    return overlaps.exchange(0);
+}
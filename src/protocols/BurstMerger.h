@@ -0,0 +1,105 @@
+/**
+    @file BurstMerger.h
+    @author Lime Microsystems
+    @brief Merges timestamped TX bursts from several threads.
+*/
+
+#pragma once
+#include "IConnection.h"
+#include "dataTypes.h"
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace lime{
+
+/*!
+ * BurstMerger accepts timestamped bursts for one TX channel from any number
+ * of threads. Producers push finished bursts to a lock-free list, only the
+ * transmit thread takes them from it, orders them by timestamp and splits
+ * them into packets. Bursts overlapping an earlier burst, or arriving after
+ * later samples were already sent, are dropped and counted. Sent bursts are
+ * kept for reuse, so steady streaming does not allocate memory.
+ */
+class LIME_API BurstMerger
+{
+public:
+    struct Burst
+    {
+        Burst* next;
+        uint64_t timestamp;
+        uint32_t count;
+        std::vector<complex16_t> samples;
+    };
+
+    /** @brief Creates merger
+        @param capacity maximum number of samples queued by producers
+    */
+    BurstMerger(const uint32_t capacity);
+    ~BurstMerger();
+
+    /** @brief Reserves space for burst, called by producer
+        @param count number of samples in burst, at most GetCapacity()
+        @param timeout_ms time to wait for queued bursts to be sent
+        @return burst to fill and Submit(), nullptr on timeout
+    */
+    Burst* Allocate(const uint32_t count, const int32_t timeout_ms);
+
+    /** @brief Queues filled burst for transmission, called by producer
+        @param burst burst returned by Allocate()
+        @param timestamp timestamp of the first sample
+    */
+    void Submit(Burst* burst, const uint64_t timestamp);
+
+    //! @brief Returns unused burst and its reserved space
+    void Discard(Burst* burst);
+
+    /** @brief Takes packets of merged bursts, same semantics as RingFIFO::pop_packets()
+        Every packet has SYNC_TIMESTAMP, last packet of burst has END_BURST.
+    */
+    uint32_t ReadPackets(complex16_t* samples, const uint32_t packetSize, const uint32_t packetsCount, IStreamChannel::Metadata* meta, uint32_t* counts, const int32_t timeout_ms);
+
+    /** @brief Drops all queued bursts
+        Can be called while transmit thread runs, bursts already taken by it
+        are dropped on its next ReadPackets() call.
+    */
+    void Clear();
+
+    //! @brief Returns number of bursts dropped since last call
+    uint32_t TakeOverlaps();
+
+    //! @brief Returns number of samples waiting for transmission
+    uint32_t GetQueuedSamples() const {return queued.load();}
+
+    //! @brief Returns maximum number of samples in one burst
+    uint32_t GetCapacity() const {return capacity;}
+
+private:
+    BurstMerger(const BurstMerger&) = delete;
+    BurstMerger& operator=(const BurstMerger&) = delete;
+    void Collect();
+    void DropScheduled();
+    void Release(Burst* burst);
+
+    const uint32_t capacity;
+    std::atomic<uint32_t> queued;       ///<samples reserved by producers
+    std::atomic<Burst*> submitted;      ///<lock-free list pushed by producers
+    std::atomic<uint32_t> overlaps;
+    std::atomic<bool> clearScheduled;   ///<transmit thread drops its bursts
+    std::mutex waitLock;                ///<only for sleeping on full or empty queue
+    std::condition_variable spaceFreed;
+    std::condition_variable burstSubmitted;
+    std::mutex freeLock;
+    Burst* freeBursts;                  ///<released bursts kept for Allocate()
+
+    //owned by transmit thread
+    std::multimap<uint64_t, Burst*> scheduled;
+    Burst* current;                     ///<burst being split into packets
+    uint32_t offset;                    ///<samples of current burst already sent
+    uint64_t sentUntil;                 ///<timestamp after last sent sample
+    bool sentAny;
+};
+
+}
@@ -0,0 +1,237 @@
+/**
+    @file Channelizer.cpp
+    @author Lime Microsystems
+    @brief Extracts narrowband channels from wideband receive stream.
+*/
+
+#include "Channelizer.h"
+#include "SampleConversion.h"
+#include "ErrorReporting.h"
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+
+using namespace lime;
+
+Channelizer::Output::Output(ILimeSDRStreaming::Streamer* streamer, const StreamConfig &config, const double frequency) :
+    StreamChannel(streamer, config),
+    frequency(frequency),
+    rate(1.0)
+{
+}
+
+int Channelizer::Output::Configure()
+{
+    if (not (frequency >= -0.5 && frequency <= 0.5))
+        return ReportError(EINVAL, "Channelizer: channel frequency %g is outside of stream band", frequency);
+    const StreamConfig::Resampling &spec = config.resampling;
+    if (spec.interpolation != spec.decimation)
+    {
+        std::unique_ptr<Resampler> stage(new Resampler);
+        if (stage->Configure(spec.interpolation, spec.decimation, spec.taps, spec.passband, spec.stopband) != 0)
+            return -1;
+        filter = std::move(stage);
+        rate = double(filter->GetInterpolation())/filter->GetDecimation();
+    }
+
+    //e^(-j*2*pi*f*k), rotated by block start phase when mixing
+    phasors.resize(2*blockSize);
+    for (uint32_t k = 0; k < blockSize; ++k)
+    {
+        const double angle = -2*M_PI*frequency*k;
+        phasors[2*k] = cos(angle);
+        phasors[2*k+1] = sin(angle);
+    }
+    mixed.resize(blockSize);
+    filtered.resize(blockSize);
+    return 0;
+}
+
+int Channelizer::Output::Start()
+{
+    fifo->Clear();
+    if (filter)
+        filter->Reset();
+    mActive = true;
+    return 0;
+}
+
+int Channelizer::Output::Stop()
+{
+    mActive = false;
+    return 0;
+}
+
+/** @brief Reads output samples
+    FIFO counts timestamps in output samples, they are converted back to
+    wideband device time here.
+*/
+int Channelizer::Output::Read(void* samples, const uint32_t count, Metadata* meta, const int32_t timeout_ms)
+{
+    const int ret = StreamChannel::Read(samples, count, meta, timeout_ms);
+    if (ret > 0 && meta && filter)
+        meta->timestamp = llround(meta->timestamp/rate);
+    return ret;
+}
+
+void Channelizer::Output::Process(const complex16_t* samples, const uint32_t count, const uint64_t timestamp)
+{
+    if (not mActive)
+        return;
+
+    //oscillator phase follows timestamp, so it stays continuous over gaps
+    const double angle = -2*M_PI*(frequency*double(timestamp) - floor(frequency*double(timestamp)));
+    const float startI = cos(angle);
+    const float startQ = sin(angle);
+    for (uint32_t k = 0; k < count; ++k)
+    {
+        const float pI = startI*phasors[2*k] - startQ*phasors[2*k+1];
+        const float pQ = startI*phasors[2*k+1] + startQ*phasors[2*k];
+        const float i = samples[k].i*pI - samples[k].q*pQ;
+        const float q = samples[k].i*pQ + samples[k].q*pI;
+        mixed[k].i = RoundI16(i);
+        mixed[k].q = RoundI16(q);
+    }
+
+    Metadata meta;
+    meta.flags = Metadata::OVERWRITE_OLD;
+    if (not filter)
+    {
+        meta.timestamp = timestamp;
+        Write(mixed.data(), count, &meta, 100);
+        return;
+    }
+    //resampler keeps outputs that do not fit for the next call
+    uint32_t inputCount = count;
+    for (;;)
+    {
+        uint64_t outTimestamp = 0;
+        const size_t produced = filter->Process(mixed.data(), inputCount, timestamp, filtered.data(), filtered.size(), &outTimestamp);
+        if (produced == 0)
+            break;
+        meta.timestamp = llround(outTimestamp*rate);
+        Write(filtered.data(), produced, &meta, 100);
+        inputCount = 0;
+    }
+}
+
+Channelizer::Channelizer(Source source, const int threadsCount) :
+    source(source),
+    threadsCount(threadsCount),
+    current(0),
+    generation(0),
+    pending(0),
+    terminate(true)
+{
+    for (auto &block : blocks)
+    {
+        block.samples.resize(blockSize);
+        block.count = 0;
+        block.timestamp = 0;
+    }
+}
+
+Channelizer::~Channelizer()
+{
+    Stop();
+}
+
+int Channelizer::AddOutput(Output* output)
+{
+    std::unique_ptr<Output> owned(output);
+    if (dispatcher.joinable())
+        return ReportError(EBUSY, "Channelizer: cannot add output while running");
+    if (output->Configure() != 0)
+        return -1;
+    outputs.push_back(std::move(owned));
+    return 0;
+}
+
+void Channelizer::SetLinkFormat(const StreamConfig::StreamDataFormat format)
+{
+    for (auto &output : outputs)
+        output->config.linkFormat = format;
+}
+
+int Channelizer::Start()
+{
+    if (dispatcher.joinable())
+        return 0;
+    int count = threadsCount;
+    if (count <= 0)
+        count = std::max<int>(std::thread::hardware_concurrency(), 1);
+    count = std::min<int>(count, std::max<size_t>(outputs.size(), 1));
+
+    terminate = false;
+    pending = 0;
+    generation = 0;
+    for (int i = 0; i < count; ++i)
+        workers.push_back(std::thread(&Channelizer::WorkerLoop, this, i, count));
+    dispatcher = std::thread(&Channelizer::DispatchLoop, this);
+    return 0;
+}
+
+void Channelizer::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lck(lock);
+        terminate = true;
+    }
+    blockReady.notify_all();
+    blockDone.notify_all();
+    if (dispatcher.joinable())
+        dispatcher.join();
+    for (auto &worker : workers)
+        worker.join();
+    workers.clear();
+}
+
+void Channelizer::DispatchLoop()
+{
+    int next = 0;
+    while (true)
+    {
+        //read next block while workers process the current one
+        Block &block = blocks[next];
+        block.count = source(block.samples.data(), block.samples.size(), &block.timestamp, 100);
+
+        std::unique_lock<std::mutex> lck(lock);
+        blockDone.wait(lck, [this]{return pending == 0 || terminate;});
+        if (terminate)
+            return;
+        if (block.count == 0)
+            continue;
+        current = next;
+        pending = workers.size();
+        ++generation;
+        lck.unlock();
+        blockReady.notify_all();
+        next ^= 1;
+    }
+}
+
+/** @brief Processes every stride-th output for each block
+    @param index first output of this worker
+    @param stride number of workers
+*/
+void Channelizer::WorkerLoop(const int index, const int stride)
+{
+    uint64_t processed = 0;
+    while (true)
+    {
+        std::unique_lock<std::mutex> lck(lock);
+        blockReady.wait(lck, [&]{return generation != processed || terminate;});
+        if (terminate)
+            return;
+        processed = generation;
+        const Block &block = blocks[current];
+        lck.unlock();
+
+        for (size_t i = index; i < outputs.size(); i += stride)
+            outputs[i]->Process(block.samples.data(), block.count, block.timestamp);
+
+        lck.lock();
+        if (--pending == 0)
+            blockDone.notify_one();
+    }
+}
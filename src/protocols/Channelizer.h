@@ -0,0 +1,113 @@
+/**
+    @file Channelizer.h
+    @author Lime Microsystems
+    @brief Extracts narrowband channels from wideband receive stream.
+*/
+
+#pragma once
+#include "ILimeSDRStreaming.h"
+#include "Resampler.h"
+#include <functional>
+
+namespace lime{
+
+/*!
+ * Channelizer splits wideband receive samples into several outputs. Each
+ * output shifts its channel to baseband with a numerically controlled
+ * oscillator and changes rate with a polyphase Resampler. Wideband samples
+ * are taken in blocks, outputs are processed by a pool of worker threads
+ * while the next block is read, so throughput scales with core count.
+ */
+class LIME_API Channelizer
+{
+public:
+    //! Receive stream fed by the channelizer, read like an ordinary stream
+    class LIME_API Output : public ILimeSDRStreaming::StreamChannel
+    {
+    public:
+        /** @brief Creates output stream
+            @param streamer streamer of the wideband stream
+            @param config output format, FIFO size and resampling
+            @param frequency channel center, fraction of wideband rate [-0.5, 0.5]
+        */
+        Output(ILimeSDRStreaming::Streamer* streamer, const StreamConfig &config, const double frequency);
+
+        //! @brief Designs filter, returns 0 on success
+        int Configure();
+        int Start() override;
+        int Stop() override;
+        int Read(void* samples, const uint32_t count, Metadata* meta, const int32_t timeout_ms = 100) override;
+
+        //! @brief Shifts and filters block of wideband samples into FIFO
+        void Process(const complex16_t* samples, const uint32_t count, const uint64_t timestamp);
+
+    private:
+        double frequency;
+        double rate;                        ///<output samples per wideband sample
+        std::unique_ptr<Resampler> filter;
+        std::vector<float> phasors;         ///<oscillator for one block, relative to block start
+        std::vector<complex16_t> mixed;
+        std::vector<complex16_t> filtered;
+    };
+
+    /*!
+     * Function giving wideband samples, same as FIFO pop:
+     * (destination, count, timestamp of first sample, timeout) -> samples given
+     */
+    typedef std::function<uint32_t(complex16_t*, uint32_t, uint64_t*, int32_t)> Source;
+
+    //! Number of wideband samples processed at once
+    static const uint32_t blockSize = 16*SamplesPacket::maxSamplesInPacket;
+
+    /** @brief Creates channelizer without outputs
+        @param source wideband samples source
+        @param threadsCount number of worker threads, 0 for one per core
+    */
+    Channelizer(Source source, const int threadsCount = 0);
+    ~Channelizer();
+
+    /** @brief Adds output, channelizer must be stopped
+        @param output output stream, ownership is taken
+        @return 0 on success
+    */
+    int AddOutput(Output* output);
+
+    /** @brief Sets link format of samples given to outputs, channelizer must be stopped
+        @param format format resolved by wideband stream
+    */
+    void SetLinkFormat(const StreamConfig::StreamDataFormat format);
+
+    //! @brief Starts reading wideband samples
+    int Start();
+    //! @brief Stops threads, outputs keep samples already produced
+    void Stop();
+
+private:
+    Channelizer(const Channelizer&) = delete;
+    Channelizer& operator=(const Channelizer&) = delete;
+    void DispatchLoop();
+    void WorkerLoop(const int index, const int stride);
+
+    struct Block
+    {
+        std::vector<complex16_t> samples;
+        uint32_t count;
+        uint64_t timestamp;
+    };
+
+    Source source;
+    int threadsCount;
+    std::vector<std::unique_ptr<Output>> outputs;
+    Block blocks[2];
+    int current;                ///<block given to workers
+    uint64_t generation;        ///<incremented for every block given to workers
+    int pending;                ///<workers still processing current block
+    bool terminate;
+    std::mutex lock;
+    std::condition_variable blockReady;
+    std::condition_variable blockDone;
+    std::thread dispatcher;
+    std::vector<std::thread> workers;
+};
+
+}
@@ -0,0 +1,238 @@
+/**
+    @file FilePlayback.cpp
+    @author Lime Microsystems
+    @brief Memory mapped file source for transmit packets.
+*/
+
+#include "FilePlayback.h"
+#include "ErrorReporting.h"
+#include "FPGA_common.h"
+#include "SampleConversion.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <ciso646>
+
+#ifdef __unix__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include "windows.h"
+#endif
+
+using namespace lime;
+
+FilePlayback::FilePlayback() :
+    data(nullptr),
+    frameSize(0),
+    framesCount(0),
+    position(0),
+    finished(false),
+    samplesSent(0),
+#ifdef __unix__
+    mappedSize(0)
+#else
+    fileHandle(nullptr),
+    mappingHandle(nullptr)
+#endif
+{
+}
+
+FilePlayback::~FilePlayback()
+{
+    Close();
+}
+
+size_t FilePlayback::GetFrameSize(PlaybackConfig::FileFormat format, int channelsCount)
+{
+    switch (format)
+    {
+    case PlaybackConfig::FILE_CS12_PACKED: return 3*channelsCount;
+    case PlaybackConfig::FILE_CF32: return 2*sizeof(float)*channelsCount;
+    default: return sizeof(complex16_t)*channelsCount;
+    }
+}
+
+int FilePlayback::Open(const PlaybackConfig &config)
+{
+    Close();
+    if (config.channelsCount < 1 || config.channelsCount > 2)
+        return ReportError(EINVAL, "Playback: file must have 1 or 2 channels");
+    this->config = config;
+    frameSize = GetFrameSize(config.format, config.channelsCount);
+
+#ifdef __unix__
+    const int fd = open(config.path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return ReportError(errno, "Playback: failed to open %s", config.path.c_str());
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0)
+    {
+        close(fd);
+        return ReportError(EINVAL, "Playback: %s is empty", config.path.c_str());
+    }
+    mappedSize = st.st_size;
+    void* ptr = mmap(nullptr, mappedSize, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (ptr == MAP_FAILED)
+    {
+        mappedSize = 0;
+        return ReportError(errno, "Playback: failed to map %s", config.path.c_str());
+    }
+    madvise(ptr, mappedSize, MADV_SEQUENTIAL);
+    data = static_cast<const uint8_t*>(ptr);
+    const uint64_t fileSize = mappedSize;
+#else
+    fileHandle = CreateFileA(config.path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE)
+    {
+        fileHandle = nullptr;
+        return ReportError(ENOENT, "Playback: failed to open %s", config.path.c_str());
+    }
+    LARGE_INTEGER size;
+    GetFileSizeEx(fileHandle, &size);
+    mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mappingHandle)
+        data = static_cast<const uint8_t*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+    if (data == nullptr)
+    {
+        Close();
+        return ReportError(EINVAL, "Playback: failed to map %s", config.path.c_str());
+    }
+    const uint64_t fileSize = size.QuadPart;
+#endif
+    //incomplete frame at the end is ignored
+    framesCount = fileSize / frameSize;
+    position = 0;
+    finished = framesCount == 0;
+    samplesSent.store(0);
+    return 0;
+}
+
+void FilePlayback::Close()
+{
+#ifdef __unix__
+    if (data)
+        munmap((void*)data, mappedSize);
+    mappedSize = 0;
+#else
+    if (data)
+        UnmapViewOfFile(data);
+    if (mappingHandle)
+        CloseHandle(mappingHandle);
+    if (fileHandle)
+        CloseHandle(fileHandle);
+    mappingHandle = nullptr;
+    fileHandle = nullptr;
+#endif
+    data = nullptr;
+    framesCount = 0;
+}
+
+int FilePlayback::FillPackets(FPGA_DataPacket* packets, const int packetsCount, const bool packed, const int channelsCount)
+{
+    if (not finished && not config.loop && position >= framesCount)
+        finished = true;
+    if (finished)
+        return 0;
+    if (channelsCount != config.channelsCount)
+    {
+        //stream layout changed after start, file cannot be sent
+        finished = true;
+        ReportError(EINVAL, "Playback: file has %i channels, stream uses %i", config.channelsCount, channelsCount);
+        return -1;
+    }
+
+    const int samplesInPkt = (packed ? samples12InPkt : samples16InPkt)/channelsCount;
+    for (int i = 0; i < packetsCount; ++i)
+    {
+        packets[i].counter = config.timestamp + samplesSent.load();
+        packets[i].reserved[0] = (!config.useTimestamp) << 4; //ignore timestamp
+        ReadFrames(packets[i].data, samplesInPkt, packed);
+        samplesSent += samplesInPkt;
+        if (finished)
+            return i+1;
+    }
+    return packetsCount;
+}
+
+/** @brief Writes packet payload from file frames, wraps around or pads with zeros at the end
+    @param dest packet payload
+    @param frames number of frames (samples of all channels) in payload
+    @param packed link uses compressed 12 bit samples
+    @return number of frames taken from file
+*/
+int FilePlayback::ReadFrames(uint8_t* dest, int frames, bool packed)
+{
+    const bool mimo = config.channelsCount == 2;
+    const bool direct = (config.format == PlaybackConfig::FILE_CS12_PACKED && packed)
+        || (config.format == PlaybackConfig::FILE_CS16 && not packed);
+    if (not direct)
+        for (int ch = 0; ch < config.channelsCount; ++ch)
+            scratch[ch].resize(frames);
+
+    int done = 0;
+    while (done < frames)
+    {
+        if (position >= framesCount)
+        {
+            if (not config.loop)
+            {
+                finished = true;
+                break;
+            }
+            position = 0;
+        }
+        const int count = std::min<uint64_t>(frames-done, framesCount-position);
+        const uint8_t* src = data + position*frameSize;
+        if (direct) //file has link payload layout
+            memcpy(dest + done*frameSize, src, count*frameSize);
+        else if (config.format == PlaybackConfig::FILE_CS12_PACKED)
+        {
+            complex16_t* samples[2] = {&scratch[0][done], mimo ? &scratch[1][done] : nullptr};
+            fpga::FPGAPacketPayload2Samples(src, count*frameSize, mimo, true, samples);
+            //12 bit values to full 16 bit range
+            for (int ch = 0; ch < config.channelsCount; ++ch)
+                for (int j = done; j < done+count; ++j)
+                {
+                    scratch[ch][j].i *= 16;
+                    scratch[ch][j].q *= 16;
+                }
+        }
+        else
+        {
+            const complex16_t* values = (const complex16_t*)src;
+            if (config.format == PlaybackConfig::FILE_CF32)
+            {
+                interleaved.resize(count*config.channelsCount);
+                ConvertF32ToI16((const float*)src, interleaved.data(), interleaved.size(), packed ? 2047.0f : 32767.0f);
+                values = interleaved.data();
+            }
+            const int shift = (config.format == PlaybackConfig::FILE_CS16 && packed) ? 4 : 0;
+            for (int j = 0; j < count; ++j)
+                for (int ch = 0; ch < config.channelsCount; ++ch)
+                {
+                    scratch[ch][done+j].i = values[j*config.channelsCount+ch].i >> shift;
+                    scratch[ch][done+j].q = values[j*config.channelsCount+ch].q >> shift;
+                }
+        }
+        done += count;
+        position += count;
+    }
+
+    if (direct)
+    {
+        if (done < frames)
+            memset(dest + done*frameSize, 0, (frames-done)*frameSize);
+    }
+    else
+    {
+        for (int ch = 0; ch < config.channelsCount; ++ch)
+            std::fill(scratch[ch].begin()+done, scratch[ch].end(), complex16_t());
+        const complex16_t* samples[2] = {scratch[0].data(), mimo ? scratch[1].data() : nullptr};
+        fpga::Samples2FPGAPacketPayload(samples, frames, mimo, packed, dest);
+    }
+    return done;
+}
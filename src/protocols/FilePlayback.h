@@ -0,0 +1,72 @@
+/**
+    @file FilePlayback.h
+    @author Lime Microsystems
+    @brief Memory mapped file source for transmit packets.
+*/
+
+#pragma once
+#include "IConnection.h"
+#include "dataTypes.h"
+#include <atomic>
+#include <vector>
+
+namespace lime{
+
+/*!
+ * FilePlayback fills transmit packets straight from a memory mapped file.
+ * When the file layout equals the link payload (CS16 file on 16 bit link,
+ * packed CS12 file on compressed link) samples are copied to the packets
+ * without conversion.
+ */
+class LIME_API FilePlayback
+{
+public:
+    FilePlayback();
+    ~FilePlayback();
+
+    /** @brief Maps file for reading
+        @param config playback options
+        @return 0 on success
+    */
+    int Open(const PlaybackConfig &config);
+
+    /** @brief Fills transmit packets with samples from file
+        @param packets destination packets
+        @param packetsCount number of packets to fill
+        @param packed link uses compressed 12 bit samples
+        @param channelsCount number of channels in packets
+        @return number of packets filled, 0 when end of file was reached,
+            -1 when packets have different number of channels than file
+    */
+    int FillPackets(FPGA_DataPacket* packets, const int packetsCount, const bool packed, const int channelsCount);
+
+    //! @brief Returns number of samples per channel transmitted
+    uint64_t GetSamplesSent() const {return samplesSent.load();}
+
+    //! @brief Returns size of single sample of all channels in file
+    static size_t GetFrameSize(PlaybackConfig::FileFormat format, int channelsCount);
+
+private:
+    FilePlayback(const FilePlayback&) = delete;
+    FilePlayback& operator=(const FilePlayback&) = delete;
+    int ReadFrames(uint8_t* dest, int frames, bool packed);
+    void Close();
+
+    PlaybackConfig config;
+    const uint8_t* data;
+    size_t frameSize;
+    uint64_t framesCount;
+    uint64_t position;      ///<next frame to transmit
+    bool finished;
+    std::atomic<uint64_t> samplesSent;
+    std::vector<complex16_t> scratch[2];
+    std::vector<complex16_t> interleaved;
+#ifdef __unix__
+    size_t mappedSize;
+#else
+    void* fileHandle;
+    void* mappingHandle;
+#endif
+};
+
+}
@@ -1,15 +1,28 @@
 #include "ILimeSDRStreaming.h"
+#include "Channelizer.h"
+#include "IQCorrector.h"
+#include "TriggeredCapture.h"
 #include "ErrorReporting.h"
 #include <assert.h>
 #include "FPGA_common.h"
 #include "LMS7002M.h"
 #include <ciso646>
 #include "Logger.h"
+#include "Numa.h"
+#include "SampleConversion.h"
+#include <algorithm>
+#include <cmath>
 
 using namespace lime;
 
 static const int MAX_CHANNEL_COUNT = 6;
 
+//! @brief Returns true if stream format can be carried by 12 bit compressed link
+static bool UsesCompressedLink(const StreamConfig::StreamDataFormat format)
+{
+    return format == StreamConfig::STREAM_12_BIT_COMPRESSED || format == StreamConfig::STREAM_COMPLEX_INT8;
+}
+
 ILimeSDRStreaming::ILimeSDRStreaming()
 {
     for (int i = 0; i < MAX_CHANNEL_COUNT/2; i++)
@@ -246,9 +259,159 @@ int ILimeSDRStreaming::UploadWFM(const void* const* samples, uint8_t chCount, si
 }
 
 
+int ILimeSDRStreaming::StartPlayback(const size_t streamID, const PlaybackConfig &config)
+{
+    StreamChannel* stream = (StreamChannel*)streamID;
+    if (stream == nullptr || !stream->config.isTx)
+        return ReportError(EINVAL, "Playback: invalid TX stream");
+    return stream->mStreamer->StartPlayback(config);
+}
+
+int ILimeSDRStreaming::StopPlayback(const size_t streamID)
+{
+    StreamChannel* stream = (StreamChannel*)streamID;
+    if (stream == nullptr || !stream->config.isTx)
+        return ReportError(EINVAL, "Playback: invalid TX stream");
+    return stream->mStreamer->StopPlayback();
+}
+
+/** @brief Starts device streaming threads that pass raw link packets to forwarder
+    FPGA and chip are not configured, that is left to the side sending
+    control commands, the data is only moved between device and forwarder.
+    @param forwarder receives RX packets or provides TX packets
+    @param tx transmit direction
+    @param channelsCount number of channels in link packets
+    @param packed link uses 12 bit compressed samples
+    @param latency stream latency versus throughput, used for batch size
+    @return 0 on success
+*/
+int ILimeSDRStreaming::StartForwarding(PacketForwarder* forwarder, const bool tx, const int channelsCount, const bool packed, const float latency)
+{
+    if (forwarder == nullptr || channelsCount < 1 || channelsCount > 2)
+        return ReportError(EINVAL, "Forwarding: invalid parameters");
+    if (mStreamers.empty())
+        mStreamers.push_back(new Streamer(this));
+    Streamer* streamer = mStreamers[0];
+    if ((tx ? streamer->txForwarder : streamer->rxForwarder) != nullptr)
+        return ReportError(EBUSY, "Forwarding: already active");
+
+    StreamConfig config;
+    config.isTx = tx;
+    config.format = packed ? StreamConfig::STREAM_12_BIT_COMPRESSED : StreamConfig::STREAM_12_BIT_IN_16;
+    config.linkFormat = config.format;
+    config.performanceLatency = latency;
+    config.bufferLength = 1; //FIFO is not used, allocate the minimum
+    //other direction may already be running, forwarder allows adding streams
+    if (tx)
+        streamer->txForwarder = forwarder;
+    else
+        streamer->rxForwarder = forwarder;
+    std::vector<size_t> streams;
+    for (int ch = 0; ch < channelsCount; ++ch)
+    {
+        size_t streamID;
+        config.channelID = ch;
+        if (SetupStream(streamID, config) != 0)
+        {
+            for (auto id : streams)
+                CloseStream(id);
+            if (tx)
+                streamer->txForwarder = nullptr;
+            else
+                streamer->rxForwarder = nullptr;
+            return -1;
+        }
+        streams.push_back(streamID);
+    }
+    for (auto id : streams)
+        ((StreamChannel*)id)->Start();
+    return 0;
+}
+
+int ILimeSDRStreaming::StopForwarding(const bool tx)
+{
+    if (mStreamers.empty())
+        return 0;
+    Streamer* streamer = mStreamers[0];
+    StreamChannel** streams = tx ? streamer->mTxStreams : streamer->mRxStreams;
+    for (int ch = 0; ch < 2; ++ch)
+        if (streams[ch])
+            streams[ch]->Stop();
+    if (tx)
+        streamer->txForwarder = nullptr;
+    else
+        streamer->rxForwarder = nullptr;
+    for (int ch = 0; ch < 2; ++ch)
+        if (streams[ch])
+            CloseStream((size_t)streams[ch]);
+    return 0;
+}
+
+int ILimeSDRStreaming::ShareStream(const size_t streamID, const std::string &name, const bool exclusive)
+{
+    StreamChannel* stream = (StreamChannel*)streamID;
+    if (stream == nullptr || stream->config.isTx)
+        return ReportError(EINVAL, "SharedStream: invalid RX stream");
+    if (stream->IsTap())
+        return ReportError(EINVAL, "SharedStream: stream shares channel, use stream that was set up first");
+    LMS7002M lms;
+    lms.SetConnection(this, stream->mStreamer->mChipID);
+    return stream->Share(name, exclusive, lms.GetSampleRate(false, LMS7002M::ChA));
+}
+
+int ILimeSDRStreaming::SetupSubStream(size_t &subStreamID, const size_t streamID, const double frequencyOffset, const StreamConfig &config)
+{
+    StreamChannel* stream = (StreamChannel*)streamID;
+    if (stream == nullptr || stream->config.isTx)
+        return ReportError(EINVAL, "Channelizer: invalid RX stream");
+    LMS7002M lms;
+    lms.SetConnection(this, stream->mStreamer->mChipID);
+    //channelizer follows device timestamps, they advance by one per wideband sample
+    const StreamConfig::Resampling &resampling = stream->config.resampling;
+    if (resampling.interpolation != resampling.decimation)
+        return ReportError(EINVAL, "Channelizer: wideband stream must not be resampled");
+    const double rate = lms.GetSampleRate(false, LMS7002M::ChA);
+    if (rate <= 0)
+        return ReportError(EINVAL, "Channelizer: stream sampling rate is unknown");
+    return stream->AddSubStream(subStreamID, config, frequencyOffset/rate);
+}
+
+int ILimeSDRStreaming::SetStreamCorrection(const size_t streamID, const IQCorrection* correction)
+{
+    StreamChannel* stream = (StreamChannel*)streamID;
+    if (stream == nullptr || stream->config.isTx)
+        return ReportError(EINVAL, "IQ correction: invalid RX stream");
+    if (stream->IsTap())
+        return ReportError(EINVAL, "IQ correction: stream shares channel, use stream that was set up first");
+    stream->SetCorrection(correction);
+    return 0;
+}
+
+int ILimeSDRStreaming::SetStreamTrigger(const size_t streamID, const TriggerConfig* config)
+{
+    StreamChannel* stream = (StreamChannel*)streamID;
+    if (stream == nullptr || stream->config.isTx)
+        return ReportError(EINVAL, "Trigger: invalid RX stream");
+    if (stream->IsTap())
+        return ReportError(EINVAL, "Trigger: stream shares channel, use stream that was set up first");
+    if (config && config->level <= 0)
+        return ReportError(EINVAL, "Trigger: level must be positive");
+    stream->SetTrigger(config);
+    return 0;
+}
+
+int ILimeSDRStreaming::UnshareStream(const size_t streamID)
+{
+    StreamChannel* stream = (StreamChannel*)streamID;
+    if (stream == nullptr || stream->config.isTx)
+        return ReportError(EINVAL, "SharedStream: invalid RX stream");
+    return stream->Unshare();
+}
+
 //-----------------------------------------------------------------------------
 ILimeSDRStreaming::StreamChannel::StreamChannel(Streamer* streamer, StreamConfig conf) :
-    mActive(false)
+    mActive(false),
+    tapsActive(false)
 {
     mStreamer = streamer;
     this->config = conf;
@@ -257,6 +420,11 @@ ILimeSDRStreaming::StreamChannel::StreamChannel(Streamer* streamer, StreamConfig
     pktLost = 0;
     sampleCnt = 0;
     startTime = std::chrono::high_resolution_clock::now();
+    pendingSamples = nullptr;
+    directPending = false;
+    publishExclusive = false;
+    pendingExclusive = false;
+    pendingTimestamp = 0;
 
     if (this->config.bufferLength == 0) //default size
         this->config.bufferLength = 1024*8*SamplesPacket::maxSamplesInPacket;
@@ -267,16 +435,102 @@ ILimeSDRStreaming::StreamChannel::StreamChannel(Streamer* streamer, StreamConfig
             fifoSize <<= 1;
         this->config.bufferLength = fifoSize*SamplesPacket::maxSamplesInPacket;
     }
-    fifo = new RingFIFO(this->config.bufferLength);
+    fifo = new RingFIFO(this->config.bufferLength, this->config.bufferFlags, this->config.numaNode);
+    if (config.isTx && config.mergeBursts)
+        merger.reset(new BurstMerger(this->config.bufferLength));
+
+    //formats converted in chunks, sized to stay in cache
+    const bool inPlace = config.format == StreamConfig::STREAM_12_BIT_IN_16
+        || config.format == StreamConfig::STREAM_12_BIT_COMPRESSED
+        || (!config.isTx && config.format != StreamConfig::STREAM_COMPLEX_INT8);
+    if (!inPlace)
+        convertBuffer.resize(4*SamplesPacket::maxSamplesInPacket);
 }
 
 ILimeSDRStreaming::StreamChannel::~StreamChannel()
 {
+    channelizer.reset();
+    tap.reset();
     delete fifo;
 }
 
+/** @brief Returns bit shift between FIFO samples and int8 format
+    12 bit samples are left aligned when link format is not compressed.
+*/
+int ILimeSDRStreaming::StreamChannel::GetInt8Shift() const
+{
+    const int shift = config.int8Shift;
+    return config.linkFormat == StreamConfig::STREAM_12_BIT_COMPRESSED ? shift : shift+4;
+}
+
+/** @brief Returns milliseconds left until deadline, 0 if it has passed
+*/
+static int32_t RemainingTimeout(const std::chrono::high_resolution_clock::time_point &deadline)
+{
+    const auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline-std::chrono::high_resolution_clock::now()).count();
+    return left > 0 ? left : 0;
+}
+
+/** @brief Takes received samples from FIFO, or from shared packets when channel has taps
+*/
+uint32_t ILimeSDRStreaming::StreamChannel::PopRaw(complex16_t* samples, const uint32_t count, uint64_t* timestamp, const int32_t timeout_ms, uint32_t* flags)
+{
+    if (tap)
+    {
+        const uint32_t popped = tap->Pop(samples, count, timestamp, timeout_ms, flags);
+        overflow += tap->TakeOverflows();
+        return popped;
+    }
+    return fifo->pop_samples(samples, count, 1, timestamp, timeout_ms, flags);
+}
+
+/** @brief Takes received samples from FIFO, passing them through resampler when enabled
+    @param samples destination array
+    @param count number of samples
+    @param timestamp returns timestamp of the first sample
+    @param timeout_ms timeout for waiting on empty FIFO
+    @param flags returns metadata flags
+    @return number of samples taken
+*/
+uint32_t ILimeSDRStreaming::StreamChannel::PopSamples(complex16_t* samples, const uint32_t count, uint64_t* timestamp, const int32_t timeout_ms, uint32_t* flags)
+{
+    if (!resampler)
+        return PopRaw(samples, count, timestamp, timeout_ms, flags);
+
+    const auto deadline = std::chrono::high_resolution_clock::now() + std::chrono::milliseconds(timeout_ms);
+    uint32_t produced = 0;
+    *flags = 0;
+    while (produced < count)
+    {
+        //pop only input needed for requested outputs, resampler keeps the rest
+        const size_t needed = std::min(resampler->InputsRequired(count-produced), resamplerInput.size());
+        uint64_t inTimestamp = 0;
+        uint32_t inFlags = 0;
+        uint32_t popped = 0;
+        if (needed > 0)
+        {
+            const int32_t timeout = produced == 0 ? timeout_ms : RemainingTimeout(deadline);
+            popped = PopRaw(resamplerInput.data(), needed, &inTimestamp, timeout, &inFlags);
+        }
+        uint64_t outTimestamp = 0;
+        const size_t cnt = resampler->Process(resamplerInput.data(), popped, inTimestamp, &samples[produced], count-produced, &outTimestamp);
+        if (produced == 0 && cnt > 0)
+            *timestamp = outTimestamp;
+        *flags |= inFlags;
+        produced += cnt;
+        if (popped < needed)
+            break;
+    }
+    return produced;
+}
+
 int ILimeSDRStreaming::StreamChannel::Read(void* samples, const uint32_t count, Metadata* meta, const int32_t timeout_ms)
 {
+    if (channelizer)
+    {
+        ReportError(EBUSY, "Stream samples are read by its sub-streams");
+        return -1;
+    }
     int popped = 0;
     if(config.format == StreamConfig::STREAM_COMPLEX_FLOAT32 && !config.isTx)
     {
@@ -284,32 +538,125 @@ int ILimeSDRStreaming::StreamChannel::Read(void* samples, const uint32_t count,
         complex16_t* ptr = (complex16_t*)samples;
         int16_t* samplesShort = (int16_t*)samples;
         float* samplesFloat = (float*)samples;
-        popped = fifo->pop_samples(ptr, count, 1, &meta->timestamp, timeout_ms, &meta->flags);
+        popped = PopSamples(ptr, count, &meta->timestamp, timeout_ms, &meta->flags);
         for(int i=2*popped-1; i>=0; --i)
             samplesFloat[i] = (float)samplesShort[i]/32767.0f;
     }
+    else if(config.format == StreamConfig::STREAM_COMPLEX_FLOAT16 && !config.isTx)
+    {
+        //in place conversion, half precision sample is the same size
+        complex16_t* ptr = (complex16_t*)samples;
+        popped = PopSamples(ptr, count, &meta->timestamp, timeout_ms, &meta->flags);
+        ConvertI16ToF16(ptr, (uint16_t*)samples, popped, 1.0f/32767.0f);
+    }
+    else if(config.format == StreamConfig::STREAM_COMPLEX_INT8 && !config.isTx)
+    {
+        //int8 sample is smaller, convert through scratch buffer
+        int8_t* dest = (int8_t*)samples;
+        const int shift = GetInt8Shift();
+        const auto deadline = std::chrono::high_resolution_clock::now() + std::chrono::milliseconds(timeout_ms);
+        uint32_t flags = 0;
+        while (popped < (int)count)
+        {
+            const uint32_t chunk = std::min<uint32_t>(count-popped, convertBuffer.size());
+            uint64_t timestamp = 0;
+            uint32_t chunkFlags = 0;
+            const int32_t timeout = popped == 0 ? timeout_ms : RemainingTimeout(deadline);
+            const uint32_t cnt = PopSamples(convertBuffer.data(), chunk, &timestamp, timeout, &chunkFlags);
+            if (popped == 0)
+                meta->timestamp = timestamp;
+            flags |= chunkFlags;
+            ConvertI16ToI8(convertBuffer.data(), &dest[2*popped], cnt, shift);
+            popped += cnt;
+            if (cnt < chunk || (chunkFlags & Metadata::END_BURST))
+                break;
+        }
+        meta->flags = flags;
+    }
     else
     {
         complex16_t* ptr = (complex16_t*)samples;
-        popped = fifo->pop_samples(ptr, count, 1, &meta->timestamp, timeout_ms, &meta->flags);
+        popped = PopSamples(ptr, count, &meta->timestamp, timeout_ms, &meta->flags);
     }
     return popped;
 }
 
+/** @brief Converts samples to be transmitted from stream format
+    @param samples source array in stream format
+    @param offset index of the first sample to convert
+    @param dest destination
+    @param count number of samples
+*/
+void ILimeSDRStreaming::StreamChannel::ConvertToI16(const void* samples, const uint32_t offset, complex16_t* dest, const uint32_t count) const
+{
+    switch (config.format)
+    {
+    case StreamConfig::STREAM_COMPLEX_INT8:
+        ConvertI8ToI16(&((const int8_t*)samples)[2*offset], dest, count, GetInt8Shift());
+        break;
+    case StreamConfig::STREAM_COMPLEX_FLOAT16:
+        ConvertF16ToI16(&((const uint16_t*)samples)[2*offset], dest, count, 32767.0f);
+        break;
+    case StreamConfig::STREAM_COMPLEX_FLOAT32:
+        ConvertF32ToI16(&((const float*)samples)[2*offset], dest, count, 32767.0f);
+        break;
+    default:
+        memcpy(dest, &((const complex16_t*)samples)[offset], count*sizeof(complex16_t));
+        break;
+    }
+}
+
 int ILimeSDRStreaming::StreamChannel::Write(const void* samples, const uint32_t count, const Metadata *meta, const int32_t timeout_ms)
 {
     int pushed = 0;
+    if (!config.isTx && tap)
+    {
+        pushed = fanout->Push((const complex16_t*)samples, count, meta->timestamp, meta->flags);
+        sampleCnt += pushed;
+        return pushed;
+    }
+    //transmit thread stops when it has nothing to send
     if (config.isTx && mActive && mStreamer->txRunning.load() == false)
         mStreamer->UpdateThreads();
-    if(config.format == StreamConfig::STREAM_COMPLEX_FLOAT32 && config.isTx)
+    if (merger)
     {
-        const float* samplesFloat = (const float*)samples;
-        int16_t* samplesShort = new int16_t[2*count];
-        for(size_t i=0; i<2*count; ++i)
-            samplesShort[i] = samplesFloat[i]*32767.0f;
-        const complex16_t* ptr = (const complex16_t*)samplesShort ;
-        pushed = fifo->push_samples(ptr, count, 1, meta->timestamp, timeout_ms, meta->flags);
-        delete[] samplesShort;
+        //each call is a burst, converted straight into merger memory
+        if (not (meta->flags & Metadata::SYNC_TIMESTAMP))
+        {
+            ReportError(EINVAL, "Merged TX stream requires timestamped bursts");
+            return -1;
+        }
+        if (count > merger->GetCapacity())
+        {
+            ReportError(EINVAL, "Burst of %u samples exceeds merged TX buffer of %u", count, merger->GetCapacity());
+            return -1;
+        }
+        BurstMerger::Burst* burst = merger->Allocate(count, timeout_ms);
+        if (burst == nullptr)
+            return 0;
+        ConvertToI16(samples, 0, burst->samples.data(), count);
+        merger->Submit(burst, meta->timestamp);
+        sampleCnt += count;
+        return count;
+    }
+    if(config.isTx && !convertBuffer.empty())
+    {
+        //convert through scratch buffer, chunk by chunk
+        const auto deadline = std::chrono::high_resolution_clock::now() + std::chrono::milliseconds(timeout_ms);
+        while (pushed < (int)count)
+        {
+            const uint32_t chunk = std::min<uint32_t>(count-pushed, convertBuffer.size());
+            ConvertToI16(samples, pushed, convertBuffer.data(), chunk);
+            //burst ends with the last chunk
+            uint32_t flags = meta->flags;
+            if (pushed + chunk < count)
+                flags &= ~Metadata::END_BURST;
+            const int32_t timeout = pushed == 0 ? timeout_ms : RemainingTimeout(deadline);
+            const uint32_t cnt = fifo->push_samples(convertBuffer.data(), chunk, 1, meta->timestamp+pushed, timeout, flags);
+            pushed += cnt;
+            if (cnt < chunk)
+                break;
+        }
     }
     else
     {
@@ -320,13 +667,287 @@ int ILimeSDRStreaming::StreamChannel::Write(const void* samples, const uint32_t
     return pushed;
 }
 
+/** @brief Returns buffer for decoding next received packet
+    When a reader is blocked on empty FIFO its buffer is returned, so samples
+    are decoded in place instead of being copied through the FIFO.
+    @param scratch frame used when samples have to go through the FIFO
+    @param count number of samples in packet
+    @param timestamp timestamp of the first sample in packet
+    @return destination for packet samples, must be followed by CommitPacketBuffer()
+*/
+complex16_t* ILimeSDRStreaming::StreamChannel::AcquirePacketBuffer(Frame& scratch, const uint32_t count, const uint64_t timestamp)
+{
+    pendingPublisher = std::atomic_load(&publisher);
+    pendingTimestamp = timestamp;
+    pendingExclusive = publishExclusive;
+    if (pendingPublisher && pendingExclusive)
+    {
+        //decode straight into shared memory, FIFO is bypassed
+        directPending = false;
+        pendingSamples = pendingPublisher->Acquire(count, timestamp);
+        if (pendingSamples)
+            return pendingSamples;
+        pendingPublisher.reset();
+    }
+    pendingCapture = std::atomic_load(&capture);
+    if (pendingCapture)
+    {
+        //decode into trigger history ring, FIFO gets only captured segments
+        directPending = false;
+        pendingSamples = pendingCapture->Acquire(count, timestamp);
+        return pendingSamples;
+    }
+    pendingFanout = std::atomic_load(&fanout);
+    if (pendingFanout)
+    {
+        //decode once into shared packet, taps take references to it
+        directPending = false;
+        pendingSamples = pendingFanout->Acquire(count, timestamp);
+        if (pendingSamples)
+            return pendingSamples;
+        pendingFanout.reset();
+        pendingSamples = scratch.samples;
+        return pendingSamples;
+    }
+    complex16_t* dest = config.isTx ? nullptr : fifo->AcquireDirect(count, timestamp);
+    directPending = dest != nullptr;
+    pendingSamples = directPending ? dest : scratch.samples;
+    return pendingSamples;
+}
+
+/** @brief Delivers samples decoded to AcquirePacketBuffer() destination
+    @param count number of samples decoded
+    @param meta packet metadata, used when samples are pushed to FIFO
+    @param timeout_ms timeout for pushing to FIFO
+    @return number of samples delivered
+*/
+int ILimeSDRStreaming::StreamChannel::CommitPacketBuffer(const uint32_t count, const Metadata* meta, const int32_t timeout_ms)
+{
+    //correct in place, before samples become visible to any reader
+    std::shared_ptr<const IQCorrector> corr = std::atomic_load(&corrector);
+    if (corr)
+        corr->Apply(pendingSamples, count);
+    if (pendingPublisher)
+    {
+        std::shared_ptr<SharedStreamPublisher> pub;
+        pub.swap(pendingPublisher);
+        const uint32_t flags = meta ? meta->flags : 0;
+        if (pendingExclusive)
+        {
+            pub->Commit(count, flags);
+            sampleCnt += count;
+            return count;
+        }
+        pub->Publish(pendingSamples, count, pendingTimestamp, flags);
+    }
+    if (pendingCapture)
+    {
+        std::shared_ptr<TriggeredCapture> trigger;
+        trigger.swap(pendingCapture);
+        trigger->Commit(count, [this, meta, timeout_ms](const complex16_t* samples, uint32_t cnt, uint64_t timestamp, bool last)
+        {
+            const uint32_t flags = (meta ? meta->flags : 0) | (last ? Metadata::END_BURST : 0);
+            if (fifo->push_samples(samples, cnt, 1, timestamp, timeout_ms, flags) != cnt)
+                ++overflow;
+        });
+        //all received samples count, not only captured ones
+        sampleCnt += count;
+        return count;
+    }
+    if (pendingFanout)
+    {
+        std::shared_ptr<PacketFanout> shared;
+        shared.swap(pendingFanout);
+        shared->Commit(count, meta ? meta->flags : 0);
+        sampleCnt += count;
+        return count;
+    }
+    if (directPending)
+    {
+        directPending = false;
+        fifo->CommitDirect(count, meta ? meta->flags : 0);
+        sampleCnt += count;
+        return count;
+    }
+    return Write(pendingSamples, count, meta, timeout_ms);
+}
+
+/** @brief Starts publishing received samples to shared memory ring
+    Ring holds about as many samples as the stream FIFO.
+    @param name shared memory object name
+    @param exclusive samples are not pushed to FIFO
+    @param sampleRate stream sampling rate, informational for consumers
+    @return 0 on success
+*/
+int ILimeSDRStreaming::StreamChannel::Share(const std::string &name, const bool exclusive, const double sampleRate)
+{
+    if (config.isTx)
+        return ReportError(EINVAL, "SharedStream: only RX streams can be shared");
+    const uint32_t slotSamples = 4*samples12InPkt;
+    const uint32_t slotsCount = std::max<uint32_t>(config.bufferLength/slotSamples, 2);
+    std::shared_ptr<SharedStreamPublisher> pub = std::make_shared<SharedStreamPublisher>();
+    if (pub->Open(name, slotsCount, slotSamples, sampleRate) != 0)
+        return -1;
+    std::atomic_store(&publisher, std::shared_ptr<SharedStreamPublisher>());
+    publishExclusive = exclusive;
+    std::atomic_store(&publisher, pub);
+    return 0;
+}
+
+/** @brief Enables rate conversion of read samples, stream must not be active
+    @param resampling rational factor and filter specification, 1/1 disables it
+    @return 0 on success
+*/
+int ILimeSDRStreaming::StreamChannel::SetResampling(const StreamConfig::Resampling &resampling)
+{
+    if (mActive)
+        return ReportError(EBUSY, "Resampler: stream is active");
+    if (resampling.interpolation == resampling.decimation && resampling.interpolation != 0)
+    {
+        resampler.reset();
+        resamplerInput.clear();
+        return 0;
+    }
+    if (config.isTx)
+        return ReportError(EINVAL, "Resampler: only RX streams can be resampled");
+    std::unique_ptr<Resampler> stage(new Resampler);
+    if (stage->Configure(resampling.interpolation, resampling.decimation, resampling.taps, resampling.passband, resampling.stopband) != 0)
+        return -1;
+    resampler = std::move(stage);
+    resamplerInput.resize(4*SamplesPacket::maxSamplesInPacket);
+    config.resampling = resampling;
+    return 0;
+}
+
+/** @brief Adds narrowband stream fed from this stream, stream must not be active
+    @param subStreamID returns sub-stream handle
+    @param config sub-stream format, FIFO size and resampling
+    @param frequency channel center, fraction of this stream sampling rate
+    @return 0 on success
+*/
+int ILimeSDRStreaming::StreamChannel::AddSubStream(size_t &subStreamID, const StreamConfig &config, const double frequency)
+{
+    subStreamID = ~0;
+    if (config.isTx || this->config.isTx)
+        return ReportError(EINVAL, "Channelizer: only RX streams have sub-streams");
+    if (mActive)
+        return ReportError(EBUSY, "Channelizer: stream is active");
+    if (!channelizer)
+        channelizer.reset(new Channelizer([this](complex16_t* samples, uint32_t count, uint64_t* timestamp, int32_t timeout_ms)
+        {
+            uint32_t flags;
+            return PopSamples(samples, count, timestamp, timeout_ms, &flags);
+        }));
+
+    StreamConfig conf = config;
+    conf.channelID = this->config.channelID;
+    conf.linkFormat = this->config.linkFormat;
+    conf.bufferFlags = this->config.bufferFlags;
+    conf.numaNode = this->config.numaNode;
+    Channelizer::Output* output = new Channelizer::Output(mStreamer, conf, frequency);
+    if (channelizer->AddOutput(output) != 0)
+        return -1;
+    subStreamID = size_t(output);
+    return 0;
+}
+
+/** @brief Replaces DC and IQ correction of received packets, safe while streaming
+    @param correction coefficients, nullptr disables correction
+*/
+void ILimeSDRStreaming::StreamChannel::SetCorrection(const IQCorrection* correction)
+{
+    std::shared_ptr<const IQCorrector> corr;
+    if (correction)
+        corr = std::make_shared<IQCorrector>(*correction);
+    std::atomic_store(&corrector, corr);
+}
+
+/** @brief Replaces trigger of received packets, safe while streaming
+    @param config trigger settings, nullptr passes all samples
+*/
+void ILimeSDRStreaming::StreamChannel::SetTrigger(const TriggerConfig* config)
+{
+    std::shared_ptr<TriggeredCapture> trigger;
+    if (config)
+        trigger = std::make_shared<TriggeredCapture>(*config, Frame::samplesCount);
+    std::atomic_store(&capture, trigger);
+}
+
+/** @brief Lets another stream consume samples of this RX channel
+    Packets are shared by reference from then on, each stream reads its own
+    queue, including this one.
+    @param stream new stream, takes packets of this channel
+    @return 0 on success
+*/
+int ILimeSDRStreaming::StreamChannel::AddTap(StreamChannel* stream)
+{
+    if (config.isTx || stream->config.isTx)
+        return ReportError(EINVAL, "Only RX streams can share channel");
+    if (!tap)
+    {
+        std::shared_ptr<PacketFanout> shared = std::make_shared<PacketFanout>();
+        tap.reset(new PacketFanout::Consumer(shared, config.bufferLength/SamplesPacket::maxSamplesInPacket));
+        tap->SetActive(mActive);
+        std::atomic_store(&fanout, shared);
+    }
+    stream->fanout = fanout;
+    stream->tap.reset(new PacketFanout::Consumer(fanout, stream->config.bufferLength/SamplesPacket::maxSamplesInPacket));
+    return 0;
+}
+
+/** @brief Keeps receive loop delivering packets while any tap of channel is active
+*/
+void ILimeSDRStreaming::StreamChannel::UpdateTapsActivity()
+{
+    StreamChannel* owner = mStreamer->mRxStreams[config.channelID&1];
+    if (owner && owner->tap)
+        owner->tapsActive = fanout->HasActiveConsumers();
+}
+
+/** @brief Returns true for stream reading channel owned by another stream
+    Only the owner decodes packets, per packet processing is set up on it.
+*/
+bool ILimeSDRStreaming::StreamChannel::IsTap() const
+{
+    return tap && !config.isTx && mStreamer->mRxStreams[config.channelID&1] != this;
+}
+
+int ILimeSDRStreaming::StreamChannel::Unshare()
+{
+    //receive loop may still hold the publisher until its packet is committed
+    std::atomic_store(&publisher, std::shared_ptr<SharedStreamPublisher>());
+    return 0;
+}
+
+/** @brief Takes several packets of samples from transmit FIFO in single operation
+    @param samples destination array for packetSize*packetsCount samples
+    @param packetSize number of samples in each packet
+    @param packetsCount maximum number of packets
+    @param meta returns metadata of each packet
+    @param counts returns number of samples in each packet
+    @param timeout_ms timeout for waiting on empty FIFO
+    @return number of packets taken
+*/
+int ILimeSDRStreaming::StreamChannel::ReadPackets(complex16_t* samples, const uint32_t packetSize, const uint32_t packetsCount, Metadata* meta, uint32_t* counts, const int32_t timeout_ms)
+{
+    if (merger)
+    {
+        const uint32_t popped = merger->ReadPackets(samples, packetSize, packetsCount, meta, counts, timeout_ms);
+        pktLost += merger->TakeOverlaps();
+        return popped;
+    }
+    return fifo->pop_packets(samples, packetSize, packetsCount, meta, counts, timeout_ms);
+}
+
 IStreamChannel::Info ILimeSDRStreaming::StreamChannel::GetInfo()
 {
     Info stats;
     memset(&stats,0,sizeof(stats));
     RingFIFO::BufferInfo info = fifo->GetInfo();
     stats.fifoSize = info.size;
-    stats.fifoItemsCount = info.itemsFilled;
+    stats.fifoItemsCount = tap ? tap->GetQueuedSamples() : info.itemsFilled;
+    if (merger)
+        stats.fifoItemsCount = merger->GetQueuedSamples();
     stats.active = mActive;
     stats.droppedPackets = pktLost;
     stats.overrun = overflow;
@@ -351,21 +972,51 @@ bool ILimeSDRStreaming::StreamChannel::IsActive() const
     return mActive;
 }
 
+bool ILimeSDRStreaming::StreamChannel::IsReceiving() const
+{
+    return mActive || tapsActive.load();
+}
+
 int ILimeSDRStreaming::StreamChannel::Start()
 {
+    //bursts held by transmit thread are dropped by that thread
+    if (merger)
+        merger->Clear();
     mActive = true;
     fifo->Clear();
+    if (tap)
+    {
+        tap->Clear();
+        tap->SetActive(true);
+        UpdateTapsActivity();
+    }
+    if (resampler)
+        resampler->Reset();
     overflow = 0;
     underflow = 0;
     pktLost = 0;
     sampleCnt.store(0);
     startTime = std::chrono::high_resolution_clock::now();
-    return mStreamer->UpdateThreads();
+    const int status = mStreamer->UpdateThreads();
+    if (status == 0 && channelizer)
+    {
+        //link format is resolved by UpdateThreads, outputs convert from it
+        channelizer->SetLinkFormat(config.linkFormat);
+        return channelizer->Start();
+    }
+    return status;
 }
 
 int ILimeSDRStreaming::StreamChannel::Stop()
 {
     mActive = false;
+    if (tap)
+    {
+        tap->SetActive(false);
+        UpdateTapsActivity();
+    }
+    if (channelizer)
+        channelizer->Stop();
     return mStreamer->UpdateThreads();
 }
 
@@ -384,6 +1035,8 @@ ILimeSDRStreaming::Streamer::Streamer(ILimeSDRStreaming* port)
     txDataRate_Bps = 0;
     txBatchSize = 1;
     rxBatchSize = 1;
+    rxForwarder = nullptr;
+    txForwarder = nullptr;
     mChipID = dataPort->mStreamers.size();
     streamSize = 1;
     for(auto& i : mTxStreams)
@@ -394,6 +1047,9 @@ ILimeSDRStreaming::Streamer::Streamer(ILimeSDRStreaming* port)
 
 ILimeSDRStreaming::Streamer::~Streamer()
 {
+    for(auto& taps : mRxTaps)
+        while (!taps.empty())
+            CloseStream((size_t)taps.back());
     for(auto& i : mTxStreams)
         if (i != nullptr)
             CloseStream((size_t)i);
@@ -413,20 +1069,55 @@ int ILimeSDRStreaming::Streamer::SetupStream(size_t& streamID, const StreamConfi
     streamID = ~0;
     const int ch = config.channelID&1;
     
-    if ((config.isTx && mTxStreams[ch]) || (!config.isTx && mRxStreams[ch]))
+    //RX channel can be consumed by several streams, TX channel by one
+    const bool shared = !config.isTx && mRxStreams[ch];
+    if (config.isTx && mTxStreams[ch])
     {
         lime::error("Setup Stream: Channel already in use");
         return -1;
     }
     
-    if ((txRunning.load()) || rxRunning.load() && (!mTxStreams[ch]) && (!mRxStreams[ch]))
+    const bool forwarding = rxForwarder || txForwarder;
+    if (not forwarding && ((txRunning.load()) || rxRunning.load() && (!mTxStreams[ch]) && (!mRxStreams[ch])))
     {
         lime::error("Stream cannot be set up while streaming is running");
         return -1;
     }
-              
-    StreamChannel* stream = new StreamChannel(this,config);
-    //TODO check for duplicate streams
+
+    if (config.format == StreamConfig::STREAM_COMPLEX_INT8 && (config.int8Shift < 0 || config.int8Shift > 8))
+    {
+        lime::error("Setup Stream: int8 shift must be in range [0,8]");
+        return -1;
+    }
+
+    //resolve NUMA placement once, used for buffers and threads of the stream
+    StreamConfig conf = config;
+    if (conf.numaNode == StreamConfig::NUMA_AUTO)
+        conf.numaNode = numa::GetNodeCount() > 1 ? dataPort->GetNumaNode() : -1;
+    if (conf.numaNode < 0)
+        conf.numaNode = -1;
+
+    StreamChannel* stream = new StreamChannel(this,conf);
+    if (stream->SetResampling(conf.resampling) != 0)
+    {
+        lime::error("Setup Stream: %s", GetLastErrorMessage());
+        delete stream;
+        return -1;
+    }
+    if (shared)
+    {
+        if (mRxStreams[ch]->AddTap(stream) != 0)
+        {
+            lime::error("Setup Stream: %s", GetLastErrorMessage());
+            delete stream;
+            return -1;
+        }
+        //link is already configured when streaming is running
+        stream->config.linkFormat = mRxStreams[ch]->config.linkFormat;
+        mRxTaps[ch].push_back(stream);
+        streamID = size_t(stream);
+        return 0;
+    }
     if(config.isTx)
         mTxStreams[ch] = stream;
     else
@@ -453,12 +1144,38 @@ int ILimeSDRStreaming::Streamer::SetupStream(size_t& streamID, const StreamConfi
 int ILimeSDRStreaming::Streamer::CloseStream(const size_t streamID)
 {
     StreamChannel *stream = (StreamChannel*)streamID;
-    for(auto& i : mRxStreams)
-        if(i==stream)
+    for (auto& taps : mRxTaps)
+    {
+        auto tap = std::find(taps.begin(), taps.end(), stream);
+        if (tap == taps.end())
+            continue;
+        taps.erase(tap);
+        const int ch = stream->config.channelID&1;
+        delete stream;
+        if (mRxStreams[ch])
+            mRxStreams[ch]->UpdateTapsActivity();
+        UpdateThreads();
+        return 0;
+    }
+    for (int ch = 0; ch < 2; ++ch)
+        if (mRxStreams[ch] == stream)
         {
-            delete i;
-            i = nullptr;  
-            return 0;  
+            //another stream of the channel takes over receiving
+            StreamChannel* next = nullptr;
+            if (!mRxTaps[ch].empty())
+            {
+                next = mRxTaps[ch].front();
+                mRxTaps[ch].erase(mRxTaps[ch].begin());
+            }
+            {
+                std::lock_guard<std::mutex> lck(rxStreamsLock);
+                mRxStreams[ch] = next;
+                if (next)
+                    next->UpdateTapsActivity();
+            }
+            delete stream;
+            UpdateThreads();
+            return 0;
         }
     
     for(auto& i : mTxStreams)
@@ -471,15 +1188,173 @@ int ILimeSDRStreaming::Streamer::CloseStream(const size_t streamID)
     return 0;
 }
 
+/** @brief Returns NUMA node requested by the streams of given direction
+    @param tx true for transmit streams
+    @return NUMA node index, -1 if not bound
+*/
+int ILimeSDRStreaming::Streamer::GetNumaNode(bool tx) const
+{
+    for (auto i : (tx ? mTxStreams : mRxStreams))
+        if (i && i->config.numaNode >= 0)
+            return i->config.numaNode;
+    return -1;
+}
+
+/** @brief Fills FPGA packets with samples from active transmit streams
+    Samples for all packets are taken from each channel FIFO at once.
+    @param packets destination packets
+    @param packetsCount maximum number of packets to fill
+    @param packed use compressed 12 bit samples
+    @param timeout_ms timeout for waiting on empty FIFO
+    @return number of packets filled, -1 on FIFO underflow
+*/
+int ILimeSDRStreaming::Streamer::FillTxPackets(FPGA_DataPacket* packets, const int packetsCount, const bool packed, const int32_t timeout_ms)
+{
+    if (txForwarder)
+        return txForwarder->PopTxPackets(packets, packetsCount, timeout_ms);
+
+    std::shared_ptr<FilePlayback> playback = std::atomic_load(&txPlayback);
+    if (playback)
+    {
+        const int filled = playback->FillPackets(packets, packetsCount, packed, streamSize);
+        if (filled > 0)
+            return filled;
+        if (filled < 0)
+            lime::error("%s", GetLastErrorMessage());
+        //end of file, continue from stream FIFOs
+        std::atomic_compare_exchange_strong(&txPlayback, &playback, std::shared_ptr<FilePlayback>());
+    }
+
+    const int maxSamplesBatch = (packed ? samples12InPkt:samples16InPkt)/streamSize;
+    int popped[2] = {0, 0};
+    int packetsPopped = 0;
+    bool anyActive = false;
+    for(int ch=0; ch<streamSize; ++ch)
+    {
+        if (txSamples[ch].size() < size_t(packetsCount*maxSamplesBatch))
+        {
+            txSamples[ch].resize(packetsCount*maxSamplesBatch);
+            txMeta[ch].resize(packetsCount);
+            txCounts[ch].resize(packetsCount);
+        }
+        StreamChannel* channel = mTxStreams[ch];
+        if (channel==nullptr || channel->mActive==false)
+            continue;
+        //keep channels aligned to the packets count of the first one
+        const int toPop = anyActive ? packetsPopped : packetsCount;
+        anyActive = true;
+        popped[ch] = channel->ReadPackets(txSamples[ch].data(), maxSamplesBatch, toPop, txMeta[ch].data(), txCounts[ch].data(), timeout_ms);
+        if (popped[ch] == 0)
+        {
+            channel->underflow++;
+            return -1;
+        }
+        packetsPopped = std::max(packetsPopped, popped[ch]);
+    }
+    if (not anyActive)
+        packetsPopped = packetsCount;
+
+    for(int i=0; i<packetsPopped; ++i)
+    {
+        const IStreamChannel::Metadata* meta = nullptr;
+        complex16_t* src[2];
+        for(int ch=0; ch<streamSize; ++ch)
+        {
+            src[ch] = &txSamples[ch][i*maxSamplesBatch];
+            StreamChannel* channel = mTxStreams[ch];
+            if (channel==nullptr || channel->mActive==false)
+            {
+                memset(src[ch], 0, maxSamplesBatch*sizeof(complex16_t));
+                continue;
+            }
+            int samplesPopped = 0;
+            if (i < popped[ch])
+            {
+                samplesPopped = txCounts[ch][i];
+                meta = &txMeta[ch][i];
+            }
+            if (samplesPopped != maxSamplesBatch)
+            {
+                const bool endBurst = popped[ch] > 0 && (txMeta[ch][popped[ch]-1].flags & IStreamChannel::Metadata::END_BURST);
+                if (not endBurst)
+                {
+                    channel->underflow++;
+#ifndef NDEBUG
+                    printf("popping from TX, samples popped %i/%i\n", samplesPopped, maxSamplesBatch);
+#endif
+                    return -1;
+                }
+                memset(&src[ch][samplesPopped], 0, (maxSamplesBatch-samplesPopped)*sizeof(complex16_t));
+            }
+        }
+
+        packets[i].counter = meta ? meta->timestamp : 0;
+        packets[i].reserved[0] = 0;
+        //by default ignore timestamps
+        const int ignoreTimestamp = !(meta && (meta->flags & IStreamChannel::Metadata::SYNC_TIMESTAMP));
+        packets[i].reserved[0] |= ((int)ignoreTimestamp << 4); //ignore timestamp
+        fpga::Samples2FPGAPacketPayload(src, maxSamplesBatch, streamSize==2, packed, packets[i].data);
+    }
+    return packetsPopped;
+}
+
+/** @brief Passes received packets to forwarder instead of decoding them
+    @param packets received packets
+    @param packetsCount number of packets
+    @return true if packets were taken by forwarder
+*/
+bool ILimeSDRStreaming::Streamer::ForwardRxPackets(const FPGA_DataPacket* packets, const int packetsCount)
+{
+    if (rxForwarder == nullptr)
+        return false;
+    if (packetsCount > 0)
+        rxForwarder->PushRxPackets(packets, packetsCount);
+    return true;
+}
+
+/** @brief Starts transmitting from memory mapped file instead of TX FIFOs
+    @param config playback options
+    @return 0 on success
+*/
+int ILimeSDRStreaming::Streamer::StartPlayback(const PlaybackConfig &config)
+{
+    if (!((mTxStreams[0] && mTxStreams[0]->mActive) || (mTxStreams[1] && mTxStreams[1]->mActive)))
+        return ReportError(EINVAL, "Playback: TX stream must be started");
+    if (config.channelsCount != streamSize)
+        return ReportError(EINVAL, "Playback: file has %i channels, stream uses %i", config.channelsCount, streamSize);
+    if (config.sampleRate > 0)
+    {
+        LMS7002M lms;
+        lms.SetConnection(dataPort, mChipID);
+        const double rate = lms.GetSampleRate(true, LMS7002M::ChA);
+        if (fabs(rate - config.sampleRate) > 1e-3*config.sampleRate)
+            return ReportError(EINVAL, "Playback: file sample rate %g MHz differs from TX rate %g MHz", config.sampleRate/1e6, rate/1e6);
+    }
+
+    std::shared_ptr<FilePlayback> playback = std::make_shared<FilePlayback>();
+    if (playback->Open(config) != 0)
+        return -1;
+    std::atomic_store(&txPlayback, playback);
+    if (txRunning.load() == false)
+        return UpdateThreads();
+    return 0;
+}
+
+int ILimeSDRStreaming::Streamer::StopPlayback()
+{
+    std::atomic_store(&txPlayback, std::shared_ptr<FilePlayback>());
+    return 0;
+}
+
 size_t ILimeSDRStreaming::Streamer::GetStreamSize(bool tx)
 {
     int batchSize = (tx ? txBatchSize : rxBatchSize)/streamSize;
     for(auto i : mRxStreams)
-        if(i && i->config.format != StreamConfig::STREAM_12_BIT_COMPRESSED)
+        if(i && !UsesCompressedLink(i->config.format))
             return samples16InPkt*batchSize;
     
     for(auto i : mTxStreams)
-        if(i && i->config.format != StreamConfig::STREAM_12_BIT_COMPRESSED)
+        if(i && !UsesCompressedLink(i->config.format))
             return samples16InPkt*batchSize;
 
     return samples12InPkt*batchSize;
@@ -528,7 +1403,7 @@ int ILimeSDRStreaming::Streamer::UpdateThreads(bool stopAll)
     if (!stopAll)
     {
         for(auto i : mRxStreams)
-            if(i && i->IsActive())
+            if(i && i->IsReceiving())
             {
                 needRx = true;
                 break;
@@ -554,9 +1429,12 @@ int ILimeSDRStreaming::Streamer::UpdateThreads(bool stopAll)
         rxThread.join();
         rxRunning.store(false);
     }
-    dataPort->WriteRegister(0xFFFF, 1 << mChipID);
+    //forwarded streams are configured by the remote side
+    const bool forwarding = rxForwarder || txForwarder;
+    if (not forwarding)
+        dataPort->WriteRegister(0xFFFF, 1 << mChipID);
     //configure FPGA on first start, or disable FPGA when not streaming
-    if((needTx or needRx) && (not rxRunning.load() and not txRunning.load()))
+    if(not forwarding && (needTx or needRx) && (not rxRunning.load() and not txRunning.load()))
     {
         LMS7002M lmsControl;
         lmsControl.SetConnection(dataPort, mChipID);
@@ -573,14 +1451,18 @@ int ILimeSDRStreaming::Streamer::UpdateThreads(bool stopAll)
         //by default use 12 bit compressed, adjust link format for stream
 
         for(auto i : mRxStreams)
-            if(i && i->config.format != StreamConfig::STREAM_12_BIT_COMPRESSED)
+            if(i && !UsesCompressedLink(i->config.format))
             {
                 config.linkFormat = StreamConfig::STREAM_12_BIT_IN_16;
                 break;
             }
+        for(auto& taps : mRxTaps)
+            for(auto i : taps)
+                if(!UsesCompressedLink(i->config.format))
+                    config.linkFormat = StreamConfig::STREAM_12_BIT_IN_16;
         
         for(auto i : mTxStreams)
-            if(i && i->config.format != StreamConfig::STREAM_12_BIT_COMPRESSED)
+            if(i && !UsesCompressedLink(i->config.format))
             {
                 config.linkFormat = StreamConfig::STREAM_12_BIT_IN_16;
                 break;
@@ -589,6 +1471,9 @@ int ILimeSDRStreaming::Streamer::UpdateThreads(bool stopAll)
         for(auto i : mRxStreams)
             if (i)
                 i->config.linkFormat = config.linkFormat;
+        for(auto& taps : mRxTaps)
+            for(auto i : taps)
+                i->config.linkFormat = config.linkFormat;
         for(auto i : mTxStreams)
             if (i)
                 i->config.linkFormat = config.linkFormat;
@@ -607,44 +1492,37 @@ int ILimeSDRStreaming::Streamer::UpdateThreads(bool stopAll)
 
         dataPort->WriteRegister(0x0007, channelEnables);
 
-        bool fromChip = true;
-        lmsControl.Modify_SPI_Reg_bits(LMS7param(LML1_MODE), 0, fromChip);
-        lmsControl.Modify_SPI_Reg_bits(LMS7param(LML2_MODE), 0, fromChip);
-        lmsControl.Modify_SPI_Reg_bits(LMS7param(LML1_FIDM), 0, fromChip);
-        lmsControl.Modify_SPI_Reg_bits(LMS7param(LML2_FIDM), 0, fromChip);
-        
-        lmsControl.Modify_SPI_Reg_bits(LMS7param(PD_RX_AFE1), 0, fromChip);
-        lmsControl.Modify_SPI_Reg_bits(LMS7param(PD_TX_AFE1), 0, fromChip);
-        lmsControl.Modify_SPI_Reg_bits(LMS7param(PD_RX_AFE2), (channelEnables&2 ? 0 : 1), fromChip);
-        lmsControl.Modify_SPI_Reg_bits(LMS7param(PD_TX_AFE2), (channelEnables&2 ? 0 : 1), fromChip);
-
-        if (lmsControl.Get_SPI_Reg_bits(LMS7_MASK, true) == 0)
+        //each register is read once, modifications are sent in few transactions
         {
-            lmsControl.Modify_SPI_Reg_bits(LMS7param(LML2_S0S), 1, fromChip);
-            lmsControl.Modify_SPI_Reg_bits(LMS7param(LML2_S1S), 0, fromChip);
-            lmsControl.Modify_SPI_Reg_bits(LMS7param(LML2_S2S), 3, fromChip);
-            lmsControl.Modify_SPI_Reg_bits(LMS7param(LML2_S3S), 2, fromChip);
-        }
-        else
-        {
-            lmsControl.Modify_SPI_Reg_bits(LMS7param(LML2_S0S), 0, fromChip);
-            lmsControl.Modify_SPI_Reg_bits(LMS7param(LML2_S1S), 1, fromChip);
-            lmsControl.Modify_SPI_Reg_bits(LMS7param(LML2_S2S), 2, fromChip);
-            lmsControl.Modify_SPI_Reg_bits(LMS7param(LML2_S3S), 3, fromChip);
-        }
-
-        if(channelEnables & 0x2) //enable MIMO
-        {
-            uint16_t macBck = lmsControl.Get_SPI_Reg_bits(LMS7param(MAC), fromChip);
-            lmsControl.Modify_SPI_Reg_bits(LMS7param(MAC), 1, fromChip);
-            lmsControl.Modify_SPI_Reg_bits(LMS7param(EN_NEXTRX_RFE), 1, fromChip);
-            lmsControl.Modify_SPI_Reg_bits(LMS7param(EN_NEXTTX_TRF), 1, fromChip);
-            lmsControl.Modify_SPI_Reg_bits(LMS7param(MAC), macBck, fromChip);
+            LMS7002M_SPIBatch batch(&lmsControl);
+            bool fromChip = true;
+            lmsControl.Modify_SPI_Reg_bits<LMS7param(LML1_MODE), LMS7param(LML2_MODE),
+                LMS7param(LML1_FIDM), LMS7param(LML2_FIDM)>({0, 0, 0, 0}, fromChip);
+
+            const uint16_t pdAfe2 = channelEnables&2 ? 0 : 1;
+            lmsControl.Modify_SPI_Reg_bits<LMS7param(PD_RX_AFE1), LMS7param(PD_TX_AFE1),
+                LMS7param(PD_RX_AFE2), LMS7param(PD_TX_AFE2)>({0, 0, pdAfe2, pdAfe2}, fromChip);
+
+            if (lmsControl.Get_SPI_Reg_bits(LMS7_MASK, true) == 0)
+                lmsControl.Modify_SPI_Reg_bits<LMS7param(LML2_S0S), LMS7param(LML2_S1S),
+                    LMS7param(LML2_S2S), LMS7param(LML2_S3S)>({1, 0, 3, 2}, fromChip);
+            else
+                lmsControl.Modify_SPI_Reg_bits<LMS7param(LML2_S0S), LMS7param(LML2_S1S),
+                    LMS7param(LML2_S2S), LMS7param(LML2_S3S)>({0, 1, 2, 3}, fromChip);
+
+            if(channelEnables & 0x2) //enable MIMO
+            {
+                uint16_t macBck = lmsControl.Get_SPI_Reg_bits<LMS7param(MAC)>(fromChip);
+                lmsControl.Modify_SPI_Reg_bits<LMS7param(MAC)>(1, fromChip);
+                lmsControl.Modify_SPI_Reg_bits<LMS7param(EN_NEXTRX_RFE)>(1, fromChip);
+                lmsControl.Modify_SPI_Reg_bits<LMS7param(EN_NEXTTX_TRF)>(1, fromChip);
+                lmsControl.Modify_SPI_Reg_bits<LMS7param(MAC)>(macBck, fromChip);
+            }
         }
 
         fpga::StartStreaming(dataPort);
     }
-    else if(not needTx and not needRx)
+    else if(not forwarding and not needTx and not needRx)
     {
         //disable FPGA streaming
         fpga::StopStreaming(dataPort);
@@ -656,6 +1534,8 @@ int ILimeSDRStreaming::Streamer::UpdateThreads(bool stopAll)
         rxRunning.store(true);
         terminateRx.store(false);
         rxThread = std::thread(dataPort->RxLoopFunction, this);
+        if (GetNumaNode(false) >= 0)
+            numa::BindThread(rxThread, GetNumaNode(false));
     }
     if(needTx and not txRunning.load())
     {
@@ -664,6 +1544,8 @@ int ILimeSDRStreaming::Streamer::UpdateThreads(bool stopAll)
         txRunning.store(true);
         terminateTx.store(false);
         txThread = std::thread(dataPort->TxLoopFunction, this);
+        if (GetNumaNode(true) >= 0)
+            numa::BindThread(txThread, GetNumaNode(true));
     }
     return 0;
 }
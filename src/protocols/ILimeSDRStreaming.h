@@ -7,17 +7,39 @@
 #include <condition_variable>
 #include <vector>
 #include <chrono>
+#include <memory>
 
 #include "dataTypes.h"
 #include "fifo.h"
+#include "FilePlayback.h"
+#include "SharedStream.h"
+#include "PacketFanout.h"
+#include "BurstMerger.h"
+#include "Resampler.h"
 #include "LMS64CProtocol.h"
 
 namespace lime
 {
+class Channelizer;
+class IQCorrector;
+class TriggeredCapture;
 
-class ILimeSDRStreaming : public LMS64CProtocol
+class LIME_API ILimeSDRStreaming : public LMS64CProtocol
 {
 public:
+    /*!
+     * Takes raw link packets in place of stream FIFOs, so they can be
+     * passed on without conversion, e.g. by RemoteServer.
+     */
+    class PacketForwarder
+    {
+    public:
+        virtual ~PacketForwarder(){};
+        //! @brief Takes packets received from device, must not block
+        virtual void PushRxPackets(const FPGA_DataPacket* packets, const int count) = 0;
+        //! @brief Fills packets for transmitting, returns number of packets filled
+        virtual int PopTxPackets(FPGA_DataPacket* packets, const int count, const int32_t timeout_ms) = 0;
+    };
 
     class Streamer;
 
@@ -35,9 +57,23 @@ public:
 
         int Read(void* samples, const uint32_t count, Metadata* meta, const int32_t timeout_ms = 100);
         int Write(const void* samples, const uint32_t count, const Metadata* meta, const int32_t timeout_ms = 100);
+        complex16_t* AcquirePacketBuffer(Frame& scratch, const uint32_t count, const uint64_t timestamp);
+        int CommitPacketBuffer(const uint32_t count, const Metadata* meta, const int32_t timeout_ms = 100);
+        int ReadPackets(complex16_t* samples, const uint32_t packetSize, const uint32_t packetsCount, Metadata* meta, uint32_t* counts, const int32_t timeout_ms = 100);
         StreamChannel::Info GetInfo();
+        int Share(const std::string &name, const bool exclusive, const double sampleRate);
+        int Unshare();
+        int SetResampling(const StreamConfig::Resampling &resampling);
+        int AddSubStream(size_t &subStreamID, const StreamConfig &config, const double frequency);
+        void SetCorrection(const IQCorrection* correction);
+        void SetTrigger(const TriggerConfig* config);
+        int AddTap(StreamChannel* stream);
+        void UpdateTapsActivity();
+        bool IsTap() const;
 
         bool IsActive() const;
+        //! @brief Returns true if receive loop delivers packets to this stream or its taps
+        bool IsReceiving() const;
         int Start();
         int Stop();
         StreamConfig config;
@@ -48,6 +84,29 @@ public:
         bool mActive;
     protected:
         RingFIFO* fifo;   
+        int GetInt8Shift() const;
+        uint32_t PopSamples(complex16_t* samples, const uint32_t count, uint64_t* timestamp, const int32_t timeout_ms, uint32_t* flags);
+        complex16_t* pendingSamples;
+        bool directPending;
+        std::shared_ptr<SharedStreamPublisher> publisher; ///<shared memory ring receiving RX samples
+        std::atomic<bool> publishExclusive;
+        std::shared_ptr<SharedStreamPublisher> pendingPublisher;
+        bool pendingExclusive;
+        uint64_t pendingTimestamp;
+        std::vector<complex16_t> convertBuffer; ///<scratch for host format conversions
+        std::unique_ptr<Resampler> resampler;   ///<rate conversion of read samples
+        std::unique_ptr<Channelizer> channelizer; ///<consumes samples for sub-streams
+        std::shared_ptr<const IQCorrector> corrector; ///<applied to received packets, swapped atomically
+        std::shared_ptr<TriggeredCapture> capture;    ///<filters received packets, swapped atomically
+        std::shared_ptr<TriggeredCapture> pendingCapture;
+        std::shared_ptr<PacketFanout> fanout;   ///<shares packets of channel with several streams
+        std::shared_ptr<PacketFanout> pendingFanout;
+        std::unique_ptr<PacketFanout::Consumer> tap; ///<read position in fanout packets
+        std::atomic<bool> tapsActive;           ///<other streams of channel are active
+        std::unique_ptr<BurstMerger> merger;    ///<orders TX bursts of several writers
+        void ConvertToI16(const void* samples, const uint32_t offset, complex16_t* dest, const uint32_t count) const;
+        uint32_t PopRaw(complex16_t* samples, const uint32_t count, uint64_t* timestamp, const int32_t timeout_ms, uint32_t* flags);
+        std::vector<complex16_t> resamplerInput;
         std::atomic<uint64_t> sampleCnt;
         std::chrono::time_point<std::chrono::high_resolution_clock> startTime;
     private:
@@ -69,6 +128,11 @@ public:
         uint64_t GetHardwareTimestamp(void);
         void SetHardwareTimestamp(const uint64_t now);
         int UpdateThreads(bool stopAll = false);
+        int GetNumaNode(bool tx) const;
+        int FillTxPackets(FPGA_DataPacket* packets, const int packetsCount, const bool packed, const int32_t timeout_ms);
+        bool ForwardRxPackets(const FPGA_DataPacket* packets, const int packetsCount);
+        int StartPlayback(const PlaybackConfig &config);
+        int StopPlayback();
 
         std::atomic<uint32_t> rxDataRate_Bps;
         std::atomic<uint32_t> txDataRate_Bps;
@@ -81,7 +145,9 @@ public:
         std::atomic<bool> terminateTx;
 
         StreamChannel* mRxStreams[2];
+        std::mutex rxStreamsLock;   ///<held by receive loop while delivering packets to mRxStreams
         StreamChannel* mTxStreams[2];
+        std::vector<StreamChannel*> mRxTaps[2];  ///<additional streams sharing RX channel
         std::atomic<uint64_t> rxLastTimestamp;
         std::atomic<uint64_t> txLastLateTime;
         uint64_t mTimestampOffset;
@@ -89,6 +155,14 @@ public:
         int streamSize;
         unsigned txBatchSize;
         unsigned rxBatchSize;
+        PacketForwarder* rxForwarder;
+        PacketForwarder* txForwarder;
+    private:
+        //transmit loop scratch buffers, one per channel
+        std::vector<complex16_t> txSamples[2];
+        std::vector<IStreamChannel::Metadata> txMeta[2];
+        std::vector<uint32_t> txCounts[2];
+        std::shared_ptr<FilePlayback> txPlayback; ///<file source replacing TX FIFOs
     };
 
     ILimeSDRStreaming();
@@ -110,6 +184,18 @@ public:
     virtual double GetHardwareTimestampRate(void);
 
     int UploadWFM(const void* const* samples, uint8_t chCount, size_t sample_count, StreamConfig::StreamDataFormat format, int epIndex) override;
+    int StartPlayback(const size_t streamID, const PlaybackConfig &config) override;
+    int StopPlayback(const size_t streamID) override;
+    int ShareStream(const size_t streamID, const std::string &name, const bool exclusive) override;
+    int UnshareStream(const size_t streamID) override;
+    int SetupSubStream(size_t &subStreamID, const size_t streamID, const double frequencyOffset, const StreamConfig &config) override;
+    int SetStreamCorrection(const size_t streamID, const IQCorrection* correction) override;
+    int SetStreamTrigger(const size_t streamID, const TriggerConfig* config) override;
+
+    int StartForwarding(PacketForwarder* forwarder, const bool tx, const int channelsCount, const bool packed, const float latency);
+    int StopForwarding(const bool tx);
+    //! @brief Clears device stream buffers, called before streaming starts
+    virtual int ResetStreamBuffers(){return 0;};
 
 protected:
     virtual int ReceiveData(char* buffer, int length, int epIndex, int timeout = 100);
@@ -123,7 +209,8 @@ protected:
     std::function<void(Streamer* args)> RxLoopFunction;
     std::function<void(Streamer* args)> TxLoopFunction;
 
-    virtual int ResetStreamBuffers(){return 0;};
+    //! @brief Returns NUMA node of the device controller, -1 if unknown
+    virtual int GetNumaNode(){return -1;};
 };
 
 } //lime
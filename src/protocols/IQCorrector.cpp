@@ -0,0 +1,62 @@
+/**
+    @file IQCorrector.cpp
+    @author Lime Microsystems
+    @brief DC offset and IQ imbalance correction of received samples.
+*/
+
+#include "IQCorrector.h"
+#include "SampleConversion.h"
+#include <cmath>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+using namespace lime;
+
+IQCorrector::IQCorrector(const IQCorrection &correction) :
+    correction(correction)
+{
+    const float (&m)[2][2] = correction.matrix;
+    const float offsetI = -(m[0][0]*correction.dcI + m[0][1]*correction.dcQ);
+    const float offsetQ = -(m[1][0]*correction.dcI + m[1][1]*correction.dcQ);
+    for (int k = 0; k < 4; k += 2)
+    {
+        diagonal[k] = m[0][0];
+        diagonal[k+1] = m[1][1];
+        cross[k] = m[0][1];
+        cross[k+1] = m[1][0];
+        offset[k] = offsetI;
+        offset[k+1] = offsetQ;
+    }
+}
+
+void IQCorrector::Apply(complex16_t* samples, const uint32_t count) const
+{
+    uint32_t n = 0;
+#ifdef __SSE2__
+    const __m128 d = _mm_loadu_ps(diagonal);
+    const __m128 c = _mm_loadu_ps(cross);
+    const __m128 o = _mm_loadu_ps(offset);
+    for (; n+4 <= count; n += 4)
+    {
+        //four complex samples, widened to two vectors of I0 Q0 I1 Q1
+        __m128i raw = _mm_loadu_si128((const __m128i*)&samples[n]);
+        __m128 lo = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(raw, raw), 16));
+        __m128 hi = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(raw, raw), 16));
+        __m128 loSwap = _mm_shuffle_ps(lo, lo, _MM_SHUFFLE(2, 3, 0, 1));
+        __m128 hiSwap = _mm_shuffle_ps(hi, hi, _MM_SHUFFLE(2, 3, 0, 1));
+        lo = _mm_add_ps(_mm_add_ps(_mm_mul_ps(lo, d), _mm_mul_ps(loSwap, c)), o);
+        hi = _mm_add_ps(_mm_add_ps(_mm_mul_ps(hi, d), _mm_mul_ps(hiSwap, c)), o);
+        raw = _mm_packs_epi32(_mm_cvtps_epi32(lo), _mm_cvtps_epi32(hi));
+        _mm_storeu_si128((__m128i*)&samples[n], raw);
+    }
+#endif
+    for (; n < count; ++n)
+    {
+        const float i = samples[n].i;
+        const float q = samples[n].q;
+        samples[n].i = RoundI16(diagonal[0]*i + cross[0]*q + offset[0]);
+        samples[n].q = RoundI16(cross[1]*i + diagonal[1]*q + offset[1]);
+    }
+}
@@ -0,0 +1,38 @@
+/**
+    @file IQCorrector.h
+    @author Lime Microsystems
+    @brief DC offset and IQ imbalance correction of received samples.
+*/
+
+#pragma once
+#include "IConnection.h"
+#include "dataTypes.h"
+
+namespace lime{
+
+/*!
+ * IQCorrector applies IQCorrection to samples in place:
+ * [I Q]' = matrix * ([I Q] - dc), saturated to 16 bits.
+ *
+ * Coefficients are fixed at construction. To update them while streaming,
+ * create new corrector and swap the shared pointer holding it atomically,
+ * packets in flight finish with the old coefficients.
+ */
+class LIME_API IQCorrector
+{
+public:
+    IQCorrector(const IQCorrection &correction);
+
+    //! @brief Corrects samples in place
+    void Apply(complex16_t* samples, const uint32_t count) const;
+
+    const IQCorrection& GetCorrection() const {return correction;}
+
+private:
+    IQCorrection correction;
+    float diagonal[4];  ///<m00, m11 for two interleaved samples
+    float cross[4];     ///<m01, m10, applied to I/Q swapped samples
+    float offset[4];    ///<-matrix*dc for two interleaved samples
+};
+
+}
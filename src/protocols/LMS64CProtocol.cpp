@@ -41,7 +41,11 @@ static int convertStatus(const int &status, const LMS64CProtocol::GenericPacket
     return ReportError(EPROTO, status2string(pkt.status));
 }
 
-LMS64CProtocol::LMS64CProtocol(void)
+LMS64CProtocol::LMS64CProtocol(void) :
+    mReadingResponse(false),
+    mResyncing(false),
+    mWritesPending(0),
+    mPipelineDepth(1)
 {
     //set a sane-default for the rate
     _cachedRefClockRate = 61.44e6/2;
@@ -387,132 +391,287 @@ LMS64CProtocol::FPGAinfo LMS64CProtocol::GetFPGAInfo()
 */
 int LMS64CProtocol::TransferPacket(GenericPacket& pkt)
 {
-    std::lock_guard<std::mutex> lock(mControlPortLock);
     int status = 0;
     if(IsOpen() == false){
         debug("Breakpoint #27 - Connection is not open");
         ReportError(ENOTCONN, "connection is not open");
     }
 
-    int packetLen;
     eLMS_PROTOCOL protocol = LMS_PROTOCOL_UNDEFINED;
     if(this->GetType() == SPI_PORT)
         protocol = LMS_PROTOCOL_NOVENA;
     else
         protocol = LMS_PROTOCOL_LMS64C;
-    switch(protocol)
-    {
-    case LMS_PROTOCOL_UNDEFINED:
-        debug("Breakpoint #28 - Protocol type undefined");
-        return ReportError("protocol type undefined");
-    case LMS_PROTOCOL_LMS64C:
-        packetLen = ProtocolLMS64C::pktLength;
-        break;
-    case LMS_PROTOCOL_NOVENA:
-        packetLen = pkt.outBuffer.size() > ProtocolNovena::pktLength ? ProtocolNovena::pktLength : pkt.outBuffer.size();
-        break;
-    default:
-        packetLen = 0;
-        std::string log = "Breakpoint #29 - Unknown protocol type " + std::to_string(int(protocol));
-        debug(log.c_str());
-        return ReportError("Unknown protocol type %d", int(protocol));
+    if(protocol == LMS_PROTOCOL_LMS64C)
+    {
+        ControlTransfer transfer;
+        StartTransfer(pkt, transfer);
+        return FinishTransfer(transfer);
     }
+
+    std::lock_guard<std::mutex> lock(mControlPortLock);
     int outLen = 0;
     unsigned char* outBuffer = NULL;
     outBuffer = PreparePacket(pkt, outLen, protocol);
     unsigned char* inBuffer = new unsigned char[outLen];
     memset(inBuffer, 0, outLen);
 
-    int outBufPos = 0;
     int inDataPos = 0;
     if(outLen == 0)
         outLen = 1;
 
-    if(protocol == LMS_PROTOCOL_NOVENA)
+    bool transferData = true; //some commands are fake, so don't need transferring
+    if(pkt.cmd == CMD_GET_INFO)
     {
-        bool transferData = true; //some commands are fake, so don't need transferring
-        if(pkt.cmd == CMD_GET_INFO)
-        {
-            //spi does not have GET INFO, fake it to inform what device it is
-            pkt.status = STATUS_COMPLETED_CMD;
-            pkt.inBuffer.clear();
-            pkt.inBuffer.resize(64, 0);
-            pkt.inBuffer[0] = 0; //firmware
-            pkt.inBuffer[1] = LMS_DEV_NOVENA; //device
-            pkt.inBuffer[2] = 0; //protocol
-            pkt.inBuffer[3] = 0; //hardware
-            pkt.inBuffer[4] = EXP_BOARD_UNSUPPORTED; //expansion
-            transferData = false;
-        }
-
-        if(transferData)
-        {
-            if (callback_logData)
-                callback_logData(true, outBuffer, outLen);
-            int bytesWritten = Write(outBuffer, outLen);
-            if( bytesWritten == outLen)
-            {
-                if(pkt.cmd == CMD_LMS7002_RD)
-                {
-                    inDataPos = Read(&inBuffer[inDataPos], outLen);
-                    if(inDataPos != outLen){
-                        std::string log = "Breakpoint #30 - Read(" + std::to_string(outLen) + " bytes) got " +  std::to_string(inDataPos);
-                        debug(log.c_str());
-                        status = ReportError("Read(%d bytes) got %d", (int)outLen, (int)inDataPos);
-                    }
-                    else
-                    {
-                        if (callback_logData)
-                            callback_logData(false, inBuffer, inDataPos);
-                    }
-                }
-                ParsePacket(pkt, inBuffer, inDataPos, protocol);
-            }
-            else{
-                std::string log = "Breakpoint #31 - Write(" + std::to_string(outLen) + " bytes) got " +  std::to_string(bytesWritten);
-                debug(log.c_str());
-                status = ReportError("Write(%d bytes) got %d", (int)outLen, (int)bytesWritten);
-            }
-        }
+        //spi does not have GET INFO, fake it to inform what device it is
+        pkt.status = STATUS_COMPLETED_CMD;
+        pkt.inBuffer.clear();
+        pkt.inBuffer.resize(64, 0);
+        pkt.inBuffer[0] = 0; //firmware
+        pkt.inBuffer[1] = LMS_DEV_NOVENA; //device
+        pkt.inBuffer[2] = 0; //protocol
+        pkt.inBuffer[3] = 0; //hardware
+        pkt.inBuffer[4] = EXP_BOARD_UNSUPPORTED; //expansion
+        transferData = false;
     }
-    else
+
+    if(transferData)
     {
-        for(int i=0; i<outLen; i+=packetLen)
+        if (callback_logData)
+            callback_logData(true, outBuffer, outLen);
+        int bytesWritten = Write(outBuffer, outLen);
+        if( bytesWritten == outLen)
         {
-            int bytesToSend = packetLen;
-            if (callback_logData)
-                callback_logData(true, &outBuffer[outBufPos], bytesToSend);
-            if( Write(&outBuffer[outBufPos], bytesToSend) )
+            if(pkt.cmd == CMD_LMS7002_RD)
             {
-                outBufPos += packetLen;
-                long readLen = packetLen;
-                int bread = Read(&inBuffer[inDataPos], readLen);
-                if(bread != readLen && protocol != LMS_PROTOCOL_NOVENA)
-                {
-                    std::string log = "Breakpoint #32 - Read(" + std::to_string(readLen) + " bytes) failed";
+                inDataPos = Read(&inBuffer[inDataPos], outLen);
+                if(inDataPos != outLen){
+                    std::string log = "Breakpoint #30 - Read(" + std::to_string(outLen) + " bytes) got " +  std::to_string(inDataPos);
                     debug(log.c_str());
-                    status = ReportError(EIO, "Read(%d bytes) failed", (int)readLen);
-                    break;
+                    status = ReportError("Read(%d bytes) got %d", (int)outLen, (int)inDataPos);
+                }
+                else
+                {
+                    if (callback_logData)
+                        callback_logData(false, inBuffer, inDataPos);
                 }
-                if (callback_logData)
-                    callback_logData(false, &inBuffer[inDataPos], bread);
-                inDataPos += bread;
-            }
-            else
-            {
-                std::string log = "Breakpoint #33 - Write(" + std::to_string(bytesToSend) + " bytes) failed";
-                debug(log.c_str());
-                status = ReportError(EIO, "Write(%d bytes) failed", (int)bytesToSend);
-                break;
             }
+            ParsePacket(pkt, inBuffer, inDataPos, protocol);
+        }
+        else{
+            std::string log = "Breakpoint #31 - Write(" + std::to_string(outLen) + " bytes) got " +  std::to_string(bytesWritten);
+            debug(log.c_str());
+            status = ReportError("Write(%d bytes) got %d", (int)outLen, (int)bytesWritten);
         }
-        ParsePacket(pkt, inBuffer, inDataPos, protocol);
     }
     delete[] outBuffer;
     delete[] inBuffer;
     return convertStatus(status, pkt);
 }
 
+LMS64CProtocol::ControlTransfer::ControlTransfer() :
+    pkt(nullptr),
+    written(0),
+    received(0),
+    status(0),
+    finished(false)
+{
+}
+
+int LMS64CProtocol::SubmitPacket(GenericPacket &pkt, ControlTransfer &transfer)
+{
+    transfer.pkt = &pkt;
+    {
+        std::lock_guard<std::mutex> lock(mPipelineLock);
+        transfer.finished = (mPipelineDepth <= 1) || (this->GetType() == SPI_PORT);
+    }
+    if (transfer.finished)
+    {
+        transfer.status = this->TransferPacket(pkt);
+        return transfer.status;
+    }
+    if(IsOpen() == false)
+        return ReportError(ENOTCONN, "connection is not open");
+    if (StartTransfer(pkt, transfer) != 0)
+    {
+        //collect responses of packets already written
+        transfer.status = FinishTransfer(transfer);
+        transfer.finished = true;
+        return transfer.status;
+    }
+    return 0;
+}
+
+int LMS64CProtocol::CompletePacket(ControlTransfer &transfer)
+{
+    if (transfer.finished)
+        return transfer.status;
+    return FinishTransfer(transfer);
+}
+
+void LMS64CProtocol::SetControlPipelineDepth(const size_t depth)
+{
+    std::lock_guard<std::mutex> lock(mPipelineLock);
+    mPipelineDepth = std::max<size_t>(depth, 1);
+}
+
+/** @brief Writes LMS64C packets of transfer, waiting for pipeline room
+    @return 0 when all packets were written
+*/
+int LMS64CProtocol::StartTransfer(GenericPacket &pkt, ControlTransfer &transfer)
+{
+    const int packetLen = ProtocolLMS64C::pktLength;
+    int outLen = 0;
+    unsigned char* outBuffer = PreparePacket(pkt, outLen, LMS_PROTOCOL_LMS64C);
+    transfer.pkt = &pkt;
+    transfer.out.assign(outBuffer, outBuffer+outLen);
+    delete[] outBuffer;
+    const size_t count = outLen/packetLen;
+    transfer.in.assign(outLen, 0);
+    transfer.done.assign(count, 0);
+    transfer.written = 0;
+    transfer.received = 0;
+    transfer.status = 0;
+
+    std::lock_guard<std::mutex> writeLock(mControlWriteLock);
+    std::unique_lock<std::mutex> lock(mPipelineLock);
+    for (size_t i = 0; i < count; ++i)
+    {
+        while (mResyncing || mInFlight.size() >= mPipelineDepth)
+            PumpResponses(lock);
+        ++mWritesPending;
+        lock.unlock();
+        unsigned char* request = &transfer.out[i*packetLen];
+        if (callback_logData)
+            callback_logData(true, request, packetLen);
+        const bool written = Write(request, packetLen) != 0;
+        lock.lock();
+        --mWritesPending;
+        if (not written)
+        {
+            std::string log = "Breakpoint #33 - Write(" + std::to_string(packetLen) + " bytes) failed";
+            debug(log.c_str());
+            transfer.status = EIO;
+            transfer.error = "Write(" + std::to_string(packetLen) + " bytes) failed";
+            mPipelineCond.notify_all();
+            break;
+        }
+        //device answers in order, so response of this packet comes after ones in flight
+        mInFlight.push_back(InFlight{&transfer, i});
+        transfer.written = i+1;
+        mPipelineCond.notify_all();
+    }
+    return transfer.status;
+}
+
+/** @brief Waits for all responses of transfer and parses them
+    @return 0 on success
+*/
+int LMS64CProtocol::FinishTransfer(ControlTransfer &transfer)
+{
+    const int packetLen = ProtocolLMS64C::pktLength;
+    std::unique_lock<std::mutex> lock(mPipelineLock);
+    for (size_t i = 0; i < transfer.written; ++i)
+        while (not transfer.done[i])
+            PumpResponses(lock);
+    lock.unlock();
+
+    ParsePacket(*transfer.pkt, transfer.in.data(), transfer.received*packetLen, LMS_PROTOCOL_LMS64C);
+    int status = 0;
+    if (transfer.status != 0)
+        status = ReportError(transfer.status, "%s", transfer.error.c_str());
+    return convertStatus(status, *transfer.pkt);
+}
+
+/** @brief Reads response of the oldest packet in flight, for whichever
+    transfer it belongs to, or waits while another thread is reading.
+    @param lock held pipeline lock
+*/
+void LMS64CProtocol::PumpResponses(std::unique_lock<std::mutex> &lock)
+{
+    if (mReadingResponse || mInFlight.empty())
+    {
+        mPipelineCond.wait(lock);
+        return;
+    }
+    mReadingResponse = true;
+    const InFlight packet = mInFlight.front();
+    ControlTransfer &transfer = *packet.transfer;
+    const int packetLen = ProtocolLMS64C::pktLength;
+    unsigned char* response = &transfer.in[packet.index*packetLen];
+    lock.unlock();
+
+    const int bread = Read(response, packetLen);
+    if (bread == packetLen && callback_logData)
+        callback_logData(false, response, bread);
+    //firmware echoes command, other command means responses got out of order
+    const bool valid = (bread == packetLen) && (response[0] == transfer.out[packet.index*packetLen]);
+
+    lock.lock();
+    mInFlight.pop_front();
+    if (not valid && transfer.status == 0)
+    {
+        transfer.status = EIO;
+        if (bread != packetLen)
+        {
+            std::string log = "Breakpoint #32 - Read(" + std::to_string(packetLen) + " bytes) failed";
+            debug(log.c_str());
+            transfer.error = "Read(" + std::to_string(packetLen) + " bytes) failed";
+        }
+        else
+        {
+            std::stringstream ss;
+            ss << "response command 0x" << std::hex << int(response[0]) << " does not match request";
+            transfer.error = ss.str();
+        }
+    }
+    //responses after a failed one are not parsed
+    if (valid && transfer.received == packet.index)
+        transfer.received = packet.index+1;
+    transfer.done[packet.index] = 1;
+    if (not valid)
+        ResyncResponses(lock);
+    mReadingResponse = false;
+    mPipelineCond.notify_all();
+}
+
+/** @brief Fails packets in flight and discards their responses
+    Called after lost or mismatched response, when later responses can no
+    longer be matched to requests by order. New packets are not written
+    until pipeline is empty again.
+    @param lock held pipeline lock, responses are read without it
+*/
+void LMS64CProtocol::ResyncResponses(std::unique_lock<std::mutex> &lock)
+{
+    mResyncing = true;
+    while (mWritesPending > 0)
+        mPipelineCond.wait(lock);
+    //response of failed packet itself may still come
+    const size_t stale = mInFlight.size() + 1;
+    for (const InFlight &packet : mInFlight)
+    {
+        ControlTransfer &transfer = *packet.transfer;
+        if (transfer.status == 0)
+        {
+            transfer.status = EIO;
+            transfer.error = "response of earlier packet was lost";
+        }
+        transfer.done[packet.index] = 1;
+    }
+    mInFlight.clear();
+    mPipelineCond.notify_all();
+    lock.unlock();
+
+    const int packetLen = ProtocolLMS64C::pktLength;
+    std::vector<unsigned char> response(packetLen);
+    for (size_t i = 0; i < stale; ++i)
+        if (Read(response.data(), packetLen) != packetLen)
+            break;
+
+    lock.lock();
+    mResyncing = false;
+}
+
 /** @brief Takes generic packet and converts to specific protocol buffer
     @param pkt generic data packet to convert
     @param length returns length of returned buffer
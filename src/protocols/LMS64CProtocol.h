@@ -7,6 +7,8 @@
 #pragma once
 #include <IConnection.h>
 #include <mutex>
+#include <condition_variable>
+#include <deque>
 #include <LMS64CCommands.h>
 #include <LMSBoards.h>
 
@@ -61,6 +63,7 @@ public:
         USB_PORT = 1,
         SPI_PORT = 2,
         PCIE_PORT = 3,
+        TCP_PORT = 4,
         //insert new types here
         CONNECTION_TYPES_COUNT //used only for memory allocation
     };
@@ -137,6 +140,48 @@ public:
      */
     virtual int TransferPacket(GenericPacket &pkt);
 
+    /*!
+     * State of packet between SubmitPacket and CompletePacket,
+     * must stay in place until completed.
+     */
+    struct ControlTransfer
+    {
+        ControlTransfer();
+        GenericPacket *pkt;
+        std::vector<unsigned char> out; ///<protocol packets
+        std::vector<unsigned char> in;  ///<responses in order of packets
+        std::vector<char> done;         ///<response received for packet
+        size_t written;                 ///<packets written to device
+        size_t received;                ///<packets with valid response
+        int status;
+        std::string error;
+        bool finished;                  ///<transferred by SubmitPacket
+    };
+
+    /** @brief Writes packet without waiting for its response
+        Packets from any threads can be in flight together, responses are
+        matched to requests by order. Without pipelining, packet is
+        transferred here.
+        @param pkt packet, must stay valid until completed
+        @param transfer state of this packet
+        @return 0 on success
+    */
+    int SubmitPacket(GenericPacket &pkt, ControlTransfer &transfer);
+
+    /** @brief Waits for responses of submitted packet and parses them
+        @param transfer state filled by SubmitPacket
+        @return 0 on success, same as TransferPacket
+    */
+    int CompletePacket(ControlTransfer &transfer);
+
+    /** @brief Sets number of protocol packets written ahead of responses
+        Packets of long transfers and of transfers from several threads are
+        kept in flight together, responses are matched to requests by order.
+        Device must process queued packets in order,
+        1 keeps a single request/response cycle.
+    */
+    void SetControlPipelineDepth(const size_t depth);
+
     struct LMSinfo
     {
         eLMS_DEV device;
@@ -204,5 +249,24 @@ private:
     int ParsePacket(GenericPacket &pkt, const unsigned char* buffer, const int length, const eLMS_PROTOCOL protocol);
     std::mutex mControlPortLock;
     double _cachedRefClockRate;
+
+    int StartTransfer(GenericPacket &pkt, ControlTransfer &transfer);
+    int FinishTransfer(ControlTransfer &transfer);
+    void PumpResponses(std::unique_lock<std::mutex> &lock);
+    void ResyncResponses(std::unique_lock<std::mutex> &lock);
+
+    struct InFlight
+    {
+        ControlTransfer *transfer;
+        size_t index;
+    };
+    std::mutex mControlWriteLock;   ///<keeps packets of one transfer together
+    std::mutex mPipelineLock;
+    std::condition_variable mPipelineCond;
+    std::deque<InFlight> mInFlight; ///<packets waiting for response, oldest first
+    bool mReadingResponse;
+    bool mResyncing;                ///<stale responses are being discarded
+    size_t mWritesPending;          ///<packets being written, not yet in flight
+    size_t mPipelineDepth;
 };
 }
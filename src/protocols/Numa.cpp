@@ -0,0 +1,174 @@
+/**
+    @file Numa.cpp
+    @author Lime Microsystems
+    @brief Helpers for placing memory and threads on NUMA nodes.
+*/
+
+#include "Numa.h"
+#include "Logger.h"
+#include <fstream>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include <ciso646>
+
+#ifdef __linux__
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/syscall.h>
+#include <sys/sysmacros.h>
+#include <unistd.h>
+#include <limits.h>
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+using namespace lime;
+
+#ifdef __linux__
+
+static const int MPOL_PREFERRED_MODE = 1; //from linux/mempolicy.h
+
+/** @brief Parses kernel list format, e.g. "0-3,8-11"
+*/
+static std::vector<int> ParseList(const std::string &text)
+{
+    std::vector<int> items;
+    size_t pos = 0;
+    while (pos < text.size())
+    {
+        size_t end = text.find(',', pos);
+        if (end == std::string::npos)
+            end = text.size();
+        const std::string range = text.substr(pos, end-pos);
+        int first, last;
+        const int cnt = sscanf(range.c_str(), "%d-%d", &first, &last);
+        if (cnt == 1)
+            last = first;
+        if (cnt >= 1)
+            for (int i = first; i <= last; ++i)
+                items.push_back(i);
+        pos = end+1;
+    }
+    return items;
+}
+
+static bool ReadLine(const std::string &path, std::string &line)
+{
+    std::ifstream file(path);
+    if (not file.is_open())
+        return false;
+    std::getline(file, line);
+    return true;
+}
+
+int numa::GetNodeCount()
+{
+    std::string line;
+    if (not ReadLine("/sys/devices/system/node/online", line))
+        return 1;
+    const std::vector<int> nodes = ParseList(line);
+    return nodes.empty() ? 1 : nodes.back()+1;
+}
+
+int numa::GetSysfsDeviceNode(const std::string &sysfsPath)
+{
+    char resolved[PATH_MAX];
+    if (realpath(sysfsPath.c_str(), resolved) == nullptr)
+        return -1;
+    std::string path(resolved);
+    while (path.size() > 5 && path.compare(0, 5, "/sys/") == 0)
+    {
+        std::string line;
+        if (ReadLine(path + "/numa_node", line))
+            return atoi(line.c_str());
+        path = path.substr(0, path.find_last_of('/'));
+    }
+    return -1;
+}
+
+int numa::GetCharDeviceNode(const std::string &devicePath)
+{
+    struct stat st;
+    if (stat(devicePath.c_str(), &st) != 0 || not S_ISCHR(st.st_mode))
+        return -1;
+    char path[64];
+    sprintf(path, "/sys/dev/char/%u:%u", major(st.st_rdev), minor(st.st_rdev));
+    return GetSysfsDeviceNode(path);
+}
+
+int numa::GetUSBBusNode(int busNumber)
+{
+    char path[64];
+    sprintf(path, "/sys/bus/usb/devices/usb%i", busNumber);
+    return GetSysfsDeviceNode(path);
+}
+
+int numa::BindMemory(void* ptr, size_t size, int node)
+{
+    const int bitsPerWord = 8*sizeof(unsigned long);
+    std::vector<unsigned long> mask(node/bitsPerWord+1, 0);
+    mask[node/bitsPerWord] = 1UL << (node%bitsPerWord);
+    //raw system call, to avoid dependency on libnuma
+    if (syscall(SYS_mbind, ptr, size, MPOL_PREFERRED_MODE, mask.data(), mask.size()*bitsPerWord+1, 0) != 0)
+    {
+        lime::warning("NUMA: failed to bind memory to node %i", node);
+        return -1;
+    }
+    return 0;
+}
+
+int numa::BindThread(std::thread &thread, int node)
+{
+    std::string line;
+    if (not ReadLine("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist", line))
+    {
+        lime::warning("NUMA: node %i not found", node);
+        return -1;
+    }
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    for (int cpu : ParseList(line))
+        if (cpu < CPU_SETSIZE)
+            CPU_SET(cpu, &cpus);
+    if (pthread_setaffinity_np(thread.native_handle(), sizeof(cpus), &cpus) != 0)
+    {
+        lime::warning("NUMA: failed to move thread to node %i", node);
+        return -1;
+    }
+    return 0;
+}
+
+#else //__linux__
+
+int numa::GetNodeCount()
+{
+    return 1;
+}
+
+int numa::GetSysfsDeviceNode(const std::string &)
+{
+    return -1;
+}
+
+int numa::GetCharDeviceNode(const std::string &)
+{
+    return -1;
+}
+
+int numa::GetUSBBusNode(int)
+{
+    return -1;
+}
+
+int numa::BindMemory(void*, size_t, int)
+{
+    return -1;
+}
+
+int numa::BindThread(std::thread &, int)
+{
+    return -1;
+}
+
+#endif //__linux__
@@ -0,0 +1,55 @@
+/**
+    @file Numa.h
+    @author Lime Microsystems
+    @brief Helpers for placing memory and threads on NUMA nodes.
+*/
+
+#pragma once
+#include "LimeSuiteConfig.h"
+#include <cstddef>
+#include <string>
+#include <thread>
+
+namespace lime{
+namespace numa{
+
+//! @brief Returns number of NUMA nodes in the system, 1 if unknown
+LIME_API int GetNodeCount();
+
+/** @brief Returns NUMA node of a device given its sysfs path
+    Walks up the device hierarchy until the node is found,
+    e.g. from USB root hub to its PCI host controller.
+    @param sysfsPath device path in /sys
+    @return node index, -1 if unknown
+*/
+LIME_API int GetSysfsDeviceNode(const std::string &sysfsPath);
+
+/** @brief Returns NUMA node of the controller behind character device
+    @param devicePath device file, e.g. /dev/xillybus_read_32
+    @return node index, -1 if unknown
+*/
+LIME_API int GetCharDeviceNode(const std::string &devicePath);
+
+/** @brief Returns NUMA node of the host controller for USB bus
+    @param busNumber USB bus number
+    @return node index, -1 if unknown
+*/
+LIME_API int GetUSBBusNode(int busNumber);
+
+/** @brief Sets preferred NUMA node for memory pages not yet touched
+    @param ptr page aligned memory address
+    @param size memory size in bytes
+    @param node NUMA node index
+    @return 0 on success
+*/
+LIME_API int BindMemory(void* ptr, size_t size, int node);
+
+/** @brief Restricts thread to the CPUs of NUMA node
+    @param thread thread to move
+    @param node NUMA node index
+    @return 0 on success
+*/
+LIME_API int BindThread(std::thread &thread, int node);
+
+}
+}
@@ -0,0 +1,247 @@
+/**
+    @file PacketFanout.cpp
+    @author Lime Microsystems
+    @brief Delivers received packets to several consumers without copying.
+*/
+
+#include "PacketFanout.h"
+#include "BufferPool.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <new>
+
+using namespace lime;
+
+PacketFanout::Consumer::Consumer(std::shared_ptr<PacketFanout> fanout, const uint32_t capacity) :
+    fanout(fanout),
+    queue(std::max<uint32_t>(capacity, 1), nullptr),
+    head(0),
+    filled(0),
+    first(0),
+    overflows(0),
+    active(false)
+{
+    fanout->AddConsumer(this, queue.size());
+}
+
+PacketFanout::Consumer::~Consumer()
+{
+    fanout->RemoveConsumer(this);
+    Clear();
+}
+
+void PacketFanout::Consumer::SetActive(const bool active)
+{
+    this->active.store(active);
+}
+
+void PacketFanout::Consumer::Clear()
+{
+    std::lock_guard<std::mutex> lck(lock);
+    for (; filled > 0; --filled)
+    {
+        fanout->Release(queue[head]);
+        head = (head+1) % queue.size();
+    }
+    first = 0;
+}
+
+uint32_t PacketFanout::Consumer::TakeOverflows()
+{
+    std::lock_guard<std::mutex> lck(lock);
+    const uint32_t count = overflows;
+    overflows = 0;
+    return count;
+}
+
+uint32_t PacketFanout::Consumer::GetQueuedSamples()
+{
+    std::lock_guard<std::mutex> lck(lock);
+    uint32_t count = 0;
+    for (uint32_t k = 0; k < filled; ++k)
+        count += queue[(head+k) % queue.size()]->count;
+    return count - first;
+}
+
+/** @brief Queues packet reference, oldest packet is dropped when queue is full
+*/
+void PacketFanout::Consumer::Push(Packet* packet)
+{
+    {
+        std::lock_guard<std::mutex> lck(lock);
+        if (filled == queue.size())
+        {
+            fanout->Release(queue[head]);
+            head = (head+1) % queue.size();
+            --filled;
+            first = 0;
+            ++overflows;
+        }
+        queue[(head+filled) % queue.size()] = packet;
+        ++filled;
+    }
+    hasItems.notify_one();
+}
+
+uint32_t PacketFanout::Consumer::Pop(complex16_t* samples, const uint32_t count, uint64_t* timestamp, const int32_t timeout_ms, uint32_t* flags)
+{
+    uint32_t taken = 0;
+    if (flags)
+        *flags = 0;
+    std::unique_lock<std::mutex> lck(lock);
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+    while (taken < count)
+    {
+        while (filled == 0)
+            if (hasItems.wait_until(lck, deadline) == std::cv_status::timeout)
+                return taken;
+
+        Packet* packet = queue[head];
+        if (taken == 0 && timestamp)
+            *timestamp = packet->timestamp + first;
+        if (flags)
+            *flags |= packet->flags;
+        const uint32_t cnt = std::min(count-taken, packet->count-first);
+        memcpy(&samples[taken], &packet->samples[first], cnt*sizeof(complex16_t));
+        taken += cnt;
+        first += cnt;
+        if (first < packet->count)
+            break;
+
+        //packet depleted
+        const bool endOfBurst = packet->flags & IStreamChannel::Metadata::END_BURST;
+        fanout->Release(packet);
+        head = (head+1) % queue.size();
+        --filled;
+        first = 0;
+        if (endOfBurst)
+            break;
+    }
+    return taken;
+}
+
+PacketFanout::PacketFanout() :
+    pending(nullptr)
+{
+}
+
+PacketFanout::~PacketFanout()
+{
+    for (auto &block : blocks)
+    {
+        Packet* packets = static_cast<Packet*>(block.first);
+        for (uint32_t k = 0; k < block.second; ++k)
+            packets[k].~Packet();
+        BufferPool::Instance().Free(block.first);
+    }
+}
+
+/** @brief Registers consumer and grows pool by its queue size
+*/
+void PacketFanout::AddConsumer(Consumer* consumer, const uint32_t capacity)
+{
+    //every queued packet needs a buffer, plus ones being decoded
+    const uint32_t count = capacity + 2;
+    void* memory = BufferPool::Instance().Allocate(count*sizeof(Packet));
+    if (memory == nullptr)
+        throw std::bad_alloc();
+    Packet* packets = static_cast<Packet*>(memory);
+    std::lock_guard<std::mutex> lckConsumers(consumersLock);
+    std::lock_guard<std::mutex> lck(poolLock);
+    blocks.push_back(std::make_pair(memory, count));
+    for (uint32_t k = 0; k < count; ++k)
+    {
+        new (&packets[k]) Packet;
+        packets[k].refs.store(0);
+        freePackets.push_back(&packets[k]);
+    }
+    consumers.push_back(consumer);
+}
+
+/** @brief Unregisters consumer, waits for packet being handed out
+*/
+void PacketFanout::RemoveConsumer(Consumer* consumer)
+{
+    std::lock_guard<std::mutex> lck(consumersLock);
+    consumers.erase(std::remove(consumers.begin(), consumers.end(), consumer), consumers.end());
+}
+
+void PacketFanout::Release(Packet* packet)
+{
+    if (packet->refs.fetch_sub(1) != 1)
+        return;
+    std::lock_guard<std::mutex> lck(poolLock);
+    freePackets.push_back(packet);
+}
+
+bool PacketFanout::HasActiveConsumers()
+{
+    std::lock_guard<std::mutex> lck(consumersLock);
+    for (auto consumer : consumers)
+        if (consumer->IsActive())
+            return true;
+    return false;
+}
+
+complex16_t* PacketFanout::Acquire(const uint32_t count, const uint64_t timestamp)
+{
+    std::lock_guard<std::mutex> lck(poolLock);
+    if (freePackets.empty())
+        return nullptr;
+    pending = freePackets.back();
+    freePackets.pop_back();
+    pending->timestamp = timestamp;
+    pending->count = std::min<uint32_t>(count, samples12InPkt);
+    pending->flags = 0;
+    return pending->samples;
+}
+
+void PacketFanout::Commit(const uint32_t count, const uint32_t flags)
+{
+    Packet* packet = pending;
+    pending = nullptr;
+    if (packet == nullptr)
+        return;
+    packet->count = std::min(count, packet->count);
+    packet->flags = flags;
+
+    std::lock_guard<std::mutex> lck(consumersLock);
+    uint32_t targets = 0;
+    for (auto consumer : consumers)
+        targets += consumer->IsActive();
+    if (targets == 0)
+    {
+        std::lock_guard<std::mutex> lckPool(poolLock);
+        freePackets.push_back(packet);
+        return;
+    }
+    //references are set before any consumer can release the packet,
+    //consumer activated meanwhile waits for the next packet
+    packet->refs.store(targets);
+    for (auto consumer : consumers)
+        if (targets > 0 && consumer->IsActive())
+        {
+            consumer->Push(packet);
+            --targets;
+        }
+    while (targets-- > 0)
+        Release(packet);
+}
+
+uint32_t PacketFanout::Push(const complex16_t* samples, const uint32_t count, const uint64_t timestamp, const uint32_t flags)
+{
+    uint32_t pushed = 0;
+    while (pushed < count)
+    {
+        const uint32_t cnt = std::min<uint32_t>(count-pushed, samples12InPkt);
+        complex16_t* dest = Acquire(cnt, timestamp+pushed);
+        if (dest == nullptr)
+            break;
+        memcpy(dest, &samples[pushed], cnt*sizeof(complex16_t));
+        pushed += cnt;
+        //only the last packet keeps end of burst
+        Commit(cnt, pushed < count ? flags & ~IStreamChannel::Metadata::END_BURST : flags);
+    }
+    return pushed;
+}
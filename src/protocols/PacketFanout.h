@@ -0,0 +1,131 @@
+/**
+    @file PacketFanout.h
+    @author Lime Microsystems
+    @brief Delivers received packets to several consumers without copying.
+*/
+
+#pragma once
+#include "IConnection.h"
+#include "dataTypes.h"
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace lime{
+
+/*!
+ * PacketFanout lets several streams consume one physical RX channel.
+ * Each packet is decoded once into a pooled buffer, every active consumer
+ * queues a pointer to it and the buffer returns to the pool when the last
+ * consumer is done with it. Consumers have their own read position and
+ * overflow counter, a slow consumer loses its oldest packets without
+ * affecting the others.
+ */
+class LIME_API PacketFanout
+{
+public:
+    struct Packet
+    {
+        uint64_t timestamp;
+        uint32_t count;
+        uint32_t flags;
+        std::atomic<uint32_t> refs;     ///<consumers still holding the packet
+        complex16_t samples[samples12InPkt];
+    };
+
+    //! Read side of the fanout, one per stream
+    class LIME_API Consumer
+    {
+    public:
+        /** @brief Registers new inactive consumer
+            @param fanout packets source
+            @param capacity number of queued packets before overflow
+        */
+        Consumer(std::shared_ptr<PacketFanout> fanout, const uint32_t capacity);
+        ~Consumer();
+
+        /** @brief Takes samples, same semantics as RingFIFO::pop_samples()
+            @param samples destination array
+            @param count number of samples
+            @param timestamp returns timestamp of the first sample
+            @param timeout_ms timeout for waiting on empty queue
+            @param flags returns metadata flags
+            @return number of samples taken
+        */
+        uint32_t Pop(complex16_t* samples, const uint32_t count, uint64_t* timestamp, const int32_t timeout_ms, uint32_t* flags);
+
+        //! @brief Inactive consumers do not receive packets
+        void SetActive(const bool active);
+        bool IsActive() const {return active.load();}
+
+        //! @brief Drops queued packets
+        void Clear();
+
+        //! @brief Returns number of packets dropped since last call
+        uint32_t TakeOverflows();
+
+        //! @brief Returns number of queued samples
+        uint32_t GetQueuedSamples();
+
+        std::shared_ptr<PacketFanout> GetFanout() const {return fanout;}
+
+    private:
+        friend class PacketFanout;
+        Consumer(const Consumer&) = delete;
+        Consumer& operator=(const Consumer&) = delete;
+        void Push(Packet* packet);
+
+        std::shared_ptr<PacketFanout> fanout;
+        std::vector<Packet*> queue;
+        uint32_t head;
+        uint32_t filled;
+        uint32_t first;         ///<samples already taken from head packet
+        uint32_t overflows;
+        std::atomic<bool> active;
+        std::mutex lock;
+        std::condition_variable hasItems;
+    };
+
+    PacketFanout();
+    ~PacketFanout();
+
+    /** @brief Returns buffer for decoding next packet
+        @param count number of samples in packet
+        @param timestamp timestamp of the first sample
+        @return nullptr when all buffers are held by consumers
+    */
+    complex16_t* Acquire(const uint32_t count, const uint64_t timestamp);
+
+    /** @brief Hands packet returned by Acquire() to active consumers
+        @param count number of samples decoded
+        @param flags packet metadata flags
+    */
+    void Commit(const uint32_t count, const uint32_t flags);
+
+    /** @brief Copies samples into packets and hands them to consumers
+        @return number of samples delivered
+    */
+    uint32_t Push(const complex16_t* samples, const uint32_t count, const uint64_t timestamp, const uint32_t flags);
+
+    //! @brief Returns true if any consumer is active
+    bool HasActiveConsumers();
+
+private:
+    PacketFanout(const PacketFanout&) = delete;
+    PacketFanout& operator=(const PacketFanout&) = delete;
+    void AddConsumer(Consumer* consumer, const uint32_t capacity);
+    void RemoveConsumer(Consumer* consumer);
+    void Release(Packet* packet);
+
+    //lock order: consumersLock, Consumer::lock, poolLock
+    std::mutex consumersLock;
+    std::vector<Consumer*> consumers;
+    std::mutex poolLock;
+    std::vector<Packet*> freePackets;
+    std::vector<std::pair<void*, uint32_t>> blocks; ///<pool memory and packets in it
+    Packet* pending;                    ///<packet between Acquire() and Commit()
+};
+
+}
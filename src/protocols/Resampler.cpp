@@ -0,0 +1,173 @@
+/**
+    @file Resampler.cpp
+    @author Lime Microsystems
+    @brief Polyphase FIR resampler for received samples.
+*/
+
+#include "Resampler.h"
+#include "SampleConversion.h"
+#include "ErrorReporting.h"
+#include "lms_gfir.h"
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+using namespace lime;
+
+static uint32_t gcd(uint32_t a, uint32_t b)
+{
+    while (b != 0)
+    {
+        const uint32_t t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+Resampler::Resampler() :
+    interpolation(1),
+    decimation(1),
+    phaseTaps(0),
+    delay(0),
+    position(0),
+    phase(0),
+    firstTimestamp(0),
+    started(false)
+{
+}
+
+int Resampler::Configure(uint32_t interpolation, uint32_t decimation, uint32_t taps, float passband, float stopband)
+{
+    if (interpolation == 0 || decimation == 0 || taps == 0)
+        return ReportError(EINVAL, "Resampler: factors and taps must be positive");
+    if (not (passband > 0 && passband < stopband && stopband <= 2.0f))
+        return ReportError(EINVAL, "Resampler: invalid passband %g, stopband %g", passband, stopband);
+    const uint32_t div = gcd(interpolation, decimation);
+    interpolation /= div;
+    decimation /= div;
+
+    const uint32_t factor = std::max(interpolation, decimation);
+    if (uint64_t(taps)*factor > maxFilterLength)
+        return ReportError(ERANGE, "Resampler: %u/%u needs %u taps, limit is %u",
+            interpolation, decimation, taps*factor, maxFilterLength);
+
+    //prototype runs at upsampled rate, where lower Nyquist is 0.5/factor
+    const int length = taps*factor;
+    std::vector<double> coefs(length);
+    const double nyquist = 0.5/factor;
+    GenerateFilter(length, passband*nyquist, stopband*nyquist, 1.0, 0, coefs.data());
+
+    this->interpolation = interpolation;
+    this->decimation = decimation;
+    phaseTaps = (length + interpolation - 1)/interpolation;
+    phaseTaps += phaseTaps & 1;
+    delay = (length-1)/(2.0*interpolation);
+
+    //branch p holds h[p + k*L] for newest..oldest sample, stored oldest first,
+    //gain L restores amplitude lost by zero stuffing
+    banks.assign(2*phaseTaps*interpolation, 0.0f);
+    for (uint32_t p = 0; p < interpolation; ++p)
+        for (uint32_t k = 0; k < phaseTaps; ++k)
+        {
+            const uint32_t index = p + k*interpolation;
+            const float value = index < uint32_t(length) ? coefs[index]*interpolation : 0;
+            float* tap = &banks[2*(p*phaseTaps + phaseTaps-1-k)];
+            tap[0] = value;
+            tap[1] = value;
+        }
+    Reset();
+    return 0;
+}
+
+void Resampler::Reset()
+{
+    history.assign(2*(phaseTaps-1), 0.0f);
+    position = phaseTaps-1;
+    phase = 0;
+    firstTimestamp = 0;
+    started = false;
+}
+
+size_t Resampler::InputsRequired(size_t outputs) const
+{
+    if (outputs == 0)
+        return 0;
+    const size_t last = position + (phase + uint64_t(outputs-1)*decimation)/interpolation;
+    const size_t buffered = history.size()/2;
+    return last+1 > buffered ? last+1-buffered : 0;
+}
+
+size_t Resampler::Process(const complex16_t* src, size_t count, uint64_t timestamp, complex16_t* dest, size_t capacity, uint64_t* outTimestamp)
+{
+    if (count > 0)
+    {
+        //discontinuity in input, filter history is no longer valid
+        if (started && int64_t(timestamp) != firstTimestamp + int64_t(history.size()/2))
+            Reset();
+        if (not started)
+        {
+            firstTimestamp = int64_t(timestamp) - int64_t(history.size()/2);
+            started = true;
+        }
+        const size_t offset = history.size();
+        history.resize(offset + 2*count);
+        float* values = &history[offset];
+        for (size_t i = 0; i < count; ++i)
+        {
+            values[2*i] = src[i].i;
+            values[2*i+1] = src[i].q;
+        }
+    }
+
+    const size_t buffered = history.size()/2;
+    if (outTimestamp && position < buffered)
+        *outTimestamp = std::max<int64_t>(0, llround(firstTimestamp + position + double(phase)/interpolation - delay));
+
+    size_t produced = 0;
+    while (position < buffered && produced < capacity)
+    {
+        const float* x = &history[2*(position+1-phaseTaps)];
+        const float* h = &banks[2*phase*phaseTaps];
+        float i = 0;
+        float q = 0;
+        uint32_t k = 0;
+#ifdef __SSE2__
+        __m128 acc = _mm_setzero_ps();
+        for (; k < 2*phaseTaps; k += 4)
+            acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(&h[k]), _mm_loadu_ps(&x[k])));
+        //fold second complex sample lane onto first
+        acc = _mm_add_ps(acc, _mm_movehl_ps(acc, acc));
+        float sums[4];
+        _mm_storeu_ps(sums, acc);
+        i = sums[0];
+        q = sums[1];
+#endif
+        for (; k < 2*phaseTaps; k += 2)
+        {
+            i += h[k]*x[k];
+            q += h[k+1]*x[k+1];
+        }
+        dest[produced].i = RoundI16(i);
+        dest[produced].q = RoundI16(q);
+        ++produced;
+
+        phase += decimation;
+        position += phase/interpolation;
+        phase %= interpolation;
+    }
+
+    //drop input that is older than the next output needs
+    const size_t drop = std::min(position+1-phaseTaps, buffered);
+    if (drop > 0)
+    {
+        history.erase(history.begin(), history.begin()+2*drop);
+        position -= drop;
+        firstTimestamp += drop;
+    }
+    return produced;
+}
@@ -0,0 +1,80 @@
+/**
+    @file Resampler.h
+    @author Lime Microsystems
+    @brief Polyphase FIR resampler for received samples.
+*/
+
+#pragma once
+#include "LimeSuiteConfig.h"
+#include "dataTypes.h"
+#include <cstdint>
+#include <vector>
+
+namespace lime{
+
+/*!
+ * Resampler changes sampling rate by rational factor interpolation/decimation
+ * with polyphase FIR filter designed by GFIR routines. Only filter branches
+ * needed for output samples are computed, input is not upsampled.
+ *
+ * Timestamps stay in device sample units: output timestamp is the device
+ * time of the output sample, compensated for filter delay.
+ */
+class LIME_API Resampler
+{
+public:
+    //! Limit on prototype filter length, design time grows with cube of it
+    static const uint32_t maxFilterLength = 512;
+
+    Resampler();
+
+    /** @brief Designs filter and clears state
+        @param interpolation upsampling factor
+        @param decimation downsampling factor
+        @param taps filter taps per unit of the larger factor
+        @param passband passband edge, fraction of the lower Nyquist frequency
+        @param stopband stopband edge, fraction of the lower Nyquist frequency
+        @return 0 on success
+    */
+    int Configure(uint32_t interpolation, uint32_t decimation, uint32_t taps, float passband, float stopband);
+
+    //! @brief Clears filter history, next input starts new stream
+    void Reset();
+
+    /** @brief Returns number of input samples needed to produce given number of outputs
+        Input that is already buffered is taken into account.
+    */
+    size_t InputsRequired(size_t outputs) const;
+
+    /** @brief Filters input samples
+        Input is always taken completely, samples that do not fit into output
+        are kept for the next call.
+        @param src input samples
+        @param count number of input samples
+        @param timestamp device timestamp of the first input sample
+        @param dest output samples
+        @param capacity maximum number of output samples
+        @param outTimestamp returns device timestamp of the first output sample
+        @return number of output samples
+    */
+    size_t Process(const complex16_t* src, size_t count, uint64_t timestamp, complex16_t* dest, size_t capacity, uint64_t* outTimestamp);
+
+    uint32_t GetInterpolation() const {return interpolation;}
+    uint32_t GetDecimation() const {return decimation;}
+    //! @brief Returns number of taps in each polyphase branch
+    uint32_t GetPhaseTaps() const {return phaseTaps;}
+
+private:
+    uint32_t interpolation;
+    uint32_t decimation;
+    uint32_t phaseTaps;         ///<taps per branch, even for vectorized filtering
+    double delay;               ///<filter delay in input samples
+    std::vector<float> banks;   ///<per phase reversed taps, duplicated for I and Q
+    std::vector<float> history; ///<interleaved I/Q input, oldest needed sample first
+    size_t position;            ///<index of newest input sample for next output
+    uint32_t phase;             ///<polyphase branch of next output
+    int64_t firstTimestamp;     ///<device timestamp of history[0]
+    bool started;
+};
+
+}
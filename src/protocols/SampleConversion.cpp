@@ -0,0 +1,203 @@
+/**
+    @file SampleConversion.cpp
+    @author Lime Microsystems
+    @brief Conversions between FIFO samples and host stream formats.
+*/
+
+#include "SampleConversion.h"
+#include <cstring>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#ifdef __F16C__
+#include <immintrin.h>
+#endif
+
+using namespace lime;
+
+static inline int16_t SaturateI16(float value)
+{
+    if (value >= 32767.0f)
+        return 32767;
+    if (value <= -32768.0f)
+        return -32768;
+    return (int16_t)value;
+}
+
+uint16_t lime::FloatToHalf(float value)
+{
+    uint32_t x;
+    memcpy(&x, &value, sizeof(x));
+    const uint16_t sign = (x >> 16) & 0x8000;
+    const int32_t exp = ((x >> 23) & 0xFF) - 127 + 15;
+    uint32_t mant = x & 0x7FFFFF;
+
+    if (((x >> 23) & 0xFF) == 0xFF) //infinity or NaN
+        return sign | 0x7C00 | (mant ? 0x200 : 0);
+    if (exp >= 31) //overflow
+        return sign | 0x7C00;
+    if (exp <= 0) //subnormal or zero
+    {
+        if (exp < -10)
+            return sign;
+        mant |= 0x800000;
+        const int shift = 14 - exp;
+        uint32_t half = mant >> shift;
+        const uint32_t rem = mant & ((1u << shift) - 1);
+        const uint32_t halfway = 1u << (shift - 1);
+        if (rem > halfway || (rem == halfway && (half & 1)))
+            ++half;
+        return sign | half;
+    }
+    uint32_t half = (exp << 10) | (mant >> 13);
+    const uint32_t rem = mant & 0x1FFF;
+    //carry may propagate to exponent, giving correct rounding up to infinity
+    if (rem > 0x1000 || (rem == 0x1000 && (half & 1)))
+        ++half;
+    return sign | half;
+}
+
+float lime::HalfToFloat(uint16_t value)
+{
+    const uint32_t sign = (uint32_t)(value & 0x8000) << 16;
+    uint32_t exp = (value >> 10) & 0x1F;
+    uint32_t mant = value & 0x3FF;
+    uint32_t x;
+    if (exp == 0)
+    {
+        if (mant == 0)
+            x = sign;
+        else //normalize subnormal
+        {
+            exp = 127 - 15 + 1;
+            while ((mant & 0x400) == 0)
+            {
+                mant <<= 1;
+                --exp;
+            }
+            x = sign | (exp << 23) | ((mant & 0x3FF) << 13);
+        }
+    }
+    else if (exp == 31)
+        x = sign | 0x7F800000 | (mant << 13);
+    else
+        x = sign | ((exp + 127 - 15) << 23) | (mant << 13);
+    float f;
+    memcpy(&f, &x, sizeof(f));
+    return f;
+}
+
+void lime::ConvertI16ToI8(const complex16_t* src, int8_t* dest, size_t count, int shift)
+{
+    size_t i = 0;
+#ifdef __SSE2__
+    const __m128i sh = _mm_cvtsi32_si128(shift);
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m128i a = _mm_sra_epi16(_mm_loadu_si128((const __m128i*)&src[i]), sh);
+        const __m128i b = _mm_sra_epi16(_mm_loadu_si128((const __m128i*)&src[i+4]), sh);
+        _mm_storeu_si128((__m128i*)&dest[2*i], _mm_packs_epi16(a, b));
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        int i8 = src[i].i >> shift;
+        int q8 = src[i].q >> shift;
+        dest[2*i] = i8 > 127 ? 127 : (i8 < -128 ? -128 : i8);
+        dest[2*i+1] = q8 > 127 ? 127 : (q8 < -128 ? -128 : q8);
+    }
+}
+
+void lime::ConvertI8ToI16(const int8_t* src, complex16_t* dest, size_t count, int shift)
+{
+    size_t i = 0;
+#ifdef __SSE2__
+    const __m128i sh = _mm_cvtsi32_si128(shift);
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m128i v = _mm_loadu_si128((const __m128i*)&src[2*i]);
+        //duplicate bytes and shift back to sign extend
+        const __m128i lo = _mm_srai_epi16(_mm_unpacklo_epi8(v, v), 8);
+        const __m128i hi = _mm_srai_epi16(_mm_unpackhi_epi8(v, v), 8);
+        _mm_storeu_si128((__m128i*)&dest[i], _mm_sll_epi16(lo, sh));
+        _mm_storeu_si128((__m128i*)&dest[i+4], _mm_sll_epi16(hi, sh));
+    }
+#endif
+    const int mult = 1 << shift;
+    for (; i < count; ++i)
+    {
+        dest[i].i = src[2*i]*mult;
+        dest[i].q = src[2*i+1]*mult;
+    }
+}
+
+void lime::ConvertI16ToF16(const complex16_t* src, uint16_t* dest, size_t count, float scale)
+{
+    size_t i = 0;
+#if defined(__F16C__) && defined(__SSE2__)
+    const __m128 s = _mm_set1_ps(scale);
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128i v = _mm_loadu_si128((const __m128i*)&src[i]);
+        const __m128 lo = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16)), s);
+        const __m128 hi = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16)), s);
+        const __m128i h = _mm_unpacklo_epi64(_mm_cvtps_ph(lo, _MM_FROUND_TO_NEAREST_INT), _mm_cvtps_ph(hi, _MM_FROUND_TO_NEAREST_INT));
+        _mm_storeu_si128((__m128i*)&dest[2*i], h);
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        //read both values first, conversion can be in place
+        const complex16_t value = src[i];
+        dest[2*i] = FloatToHalf(value.i*scale);
+        dest[2*i+1] = FloatToHalf(value.q*scale);
+    }
+}
+
+void lime::ConvertF16ToI16(const uint16_t* src, complex16_t* dest, size_t count, float scale)
+{
+    size_t i = 0;
+#if defined(__F16C__) && defined(__SSE2__)
+    const __m128 s = _mm_set1_ps(scale);
+    const __m128 maxValue = _mm_set1_ps(32767.0f);
+    const __m128 minValue = _mm_set1_ps(-32768.0f);
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128i h = _mm_loadu_si128((const __m128i*)&src[2*i]);
+        __m128 lo = _mm_mul_ps(_mm_cvtph_ps(h), s);
+        __m128 hi = _mm_mul_ps(_mm_cvtph_ps(_mm_unpackhi_epi64(h, h)), s);
+        lo = _mm_max_ps(_mm_min_ps(lo, maxValue), minValue);
+        hi = _mm_max_ps(_mm_min_ps(hi, maxValue), minValue);
+        _mm_storeu_si128((__m128i*)&dest[i], _mm_packs_epi32(_mm_cvttps_epi32(lo), _mm_cvttps_epi32(hi)));
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        dest[i].i = SaturateI16(HalfToFloat(src[2*i])*scale);
+        dest[i].q = SaturateI16(HalfToFloat(src[2*i+1])*scale);
+    }
+}
+
+void lime::ConvertF32ToI16(const float* src, complex16_t* dest, size_t count, float scale)
+{
+    size_t i = 0;
+#ifdef __SSE2__
+    const __m128 s = _mm_set1_ps(scale);
+    const __m128 maxValue = _mm_set1_ps(32767.0f);
+    const __m128 minValue = _mm_set1_ps(-32768.0f);
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 lo = _mm_mul_ps(_mm_loadu_ps(&src[2*i]), s);
+        __m128 hi = _mm_mul_ps(_mm_loadu_ps(&src[2*i+4]), s);
+        lo = _mm_max_ps(_mm_min_ps(lo, maxValue), minValue);
+        hi = _mm_max_ps(_mm_min_ps(hi, maxValue), minValue);
+        _mm_storeu_si128((__m128i*)&dest[i], _mm_packs_epi32(_mm_cvttps_epi32(lo), _mm_cvttps_epi32(hi)));
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        dest[i].i = SaturateI16(src[2*i]*scale);
+        dest[i].q = SaturateI16(src[2*i+1]*scale);
+    }
+}
@@ -0,0 +1,74 @@
+/**
+    @file SampleConversion.h
+    @author Lime Microsystems
+    @brief Conversions between FIFO samples and host stream formats.
+*/
+
+#pragma once
+#include "LimeSuiteConfig.h"
+#include "dataTypes.h"
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace lime{
+
+/** @brief Converts complex int16 samples to complex int8
+    Values are shifted right and saturated to int8 range.
+    @param src source samples
+    @param dest destination, 2 bytes per complex sample
+    @param count number of complex samples
+    @param shift number of least significant bits dropped
+*/
+LIME_API void ConvertI16ToI8(const complex16_t* src, int8_t* dest, size_t count, int shift);
+
+/** @brief Converts complex int8 samples to complex int16
+    @param src source, 2 bytes per complex sample
+    @param dest destination samples
+    @param count number of complex samples
+    @param shift number of bits values are shifted left
+*/
+LIME_API void ConvertI8ToI16(const int8_t* src, complex16_t* dest, size_t count, int shift);
+
+/** @brief Converts complex int16 samples to IEEE half precision floats
+    Can be done in place, src and dest can point to the same buffer.
+    @param src source samples
+    @param dest destination, 2 halfs per complex sample
+    @param count number of complex samples
+    @param scale multiplier applied to integer values
+*/
+LIME_API void ConvertI16ToF16(const complex16_t* src, uint16_t* dest, size_t count, float scale);
+
+/** @brief Converts complex IEEE half precision floats to int16
+    @param src source, 2 halfs per complex sample
+    @param dest destination samples
+    @param count number of complex samples
+    @param scale multiplier applied to float values
+*/
+LIME_API void ConvertF16ToI16(const uint16_t* src, complex16_t* dest, size_t count, float scale);
+
+/** @brief Converts complex float samples to int16, values are saturated
+    @param src source, 2 floats per complex sample
+    @param dest destination samples
+    @param count number of complex samples
+    @param scale multiplier applied to float values
+*/
+LIME_API void ConvertF32ToI16(const float* src, complex16_t* dest, size_t count, float scale);
+
+//! @brief Returns IEEE half precision value, rounded to nearest even
+LIME_API uint16_t FloatToHalf(float value);
+
+//! @brief Returns float value of IEEE half precision number
+LIME_API float HalfToFloat(uint16_t value);
+
+//! @brief Returns value rounded to nearest integer and saturated to int16 range
+inline int16_t RoundI16(float value)
+{
+    if (value >= 32767.0f)
+        return 32767;
+    if (value <= -32768.0f)
+        return -32768;
+    return (int16_t)lrintf(value);
+}
+
+}
@@ -0,0 +1,374 @@
+/**
+    @file SharedStream.cpp
+    @author Lime Microsystems
+    @brief Receive samples ring in shared memory for local consumers.
+*/
+
+#include "SharedStream.h"
+#include "ErrorReporting.h"
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <thread>
+#include <new>
+#include <ciso646>
+
+#ifdef __unix__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#ifdef __linux__
+#include <climits>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
+using namespace lime;
+
+static const uint32_t sharedStreamMagic = 0x53534D4C; //"LMSS"
+static const uint32_t sharedStreamVersion = 1;
+
+//futex on shared mapping, not process private
+static void WakeConsumers(std::atomic<uint32_t>* counter)
+{
+#ifdef __linux__
+    syscall(SYS_futex, counter, FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+#endif
+}
+
+static void WaitForPublisher(const std::atomic<uint32_t>* counter, uint32_t value, int timeout_ms)
+{
+#ifdef __linux__
+    struct timespec ts;
+    ts.tv_sec = timeout_ms / 1000;
+    ts.tv_nsec = (timeout_ms % 1000) * 1000000L;
+    syscall(SYS_futex, counter, FUTEX_WAIT, value, &ts, nullptr, 0);
+#else
+    std::this_thread::sleep_for(std::chrono::milliseconds(std::min(timeout_ms, 1)));
+#endif
+}
+
+static size_t GetSlotSize(uint32_t slotSamples)
+{
+    const size_t size = sizeof(SharedStreamSlot) + slotSamples*sizeof(complex16_t);
+    return (size + 63) / 64 * 64; //cache line aligned slots
+}
+
+//-----------------------------------------------------------------------------
+SharedStreamPublisher::SharedStreamPublisher() :
+    header(nullptr),
+    mappedSize(0),
+    slotIndex(0),
+    slotOpen(false),
+    nextTimestamp(0)
+{
+}
+
+SharedStreamPublisher::~SharedStreamPublisher()
+{
+    Close();
+}
+
+int SharedStreamPublisher::Open(const std::string &name, uint32_t slotsCount, uint32_t slotSamples, double sampleRate)
+{
+#ifdef __unix__
+    Close();
+    if (slotsCount < 2 || slotSamples < samples12InPkt)
+        return ReportError(EINVAL, "SharedStream: ring must have at least 2 slots of %i samples", samples12InPkt);
+
+    const size_t slotSize = GetSlotSize(slotSamples);
+    const size_t headerSize = (sizeof(SharedStreamHeader) + 63) / 64 * 64;
+    const size_t size = headerSize + slotsCount*slotSize;
+    //existing object may belong to another publisher, it is never taken over
+    const int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+    if (fd < 0 && errno == EEXIST)
+        return ReportError(EEXIST, "SharedStream: %s already exists", name.c_str());
+    if (fd < 0)
+        return ReportError(errno, "SharedStream: failed to create %s", name.c_str());
+    if (ftruncate(fd, size) != 0)
+    {
+        close(fd);
+        shm_unlink(name.c_str());
+        return ReportError(errno, "SharedStream: failed to allocate %s", name.c_str());
+    }
+    void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (ptr == MAP_FAILED)
+    {
+        shm_unlink(name.c_str());
+        return ReportError(errno, "SharedStream: failed to map %s", name.c_str());
+    }
+
+    header = new (ptr) SharedStreamHeader;
+    if (not header->writeIndex.is_lock_free())
+    {
+        munmap(ptr, size);
+        shm_unlink(name.c_str());
+        header = nullptr;
+        return ReportError(ENOTSUP, "SharedStream: 64 bit atomics are not lock free");
+    }
+    header->version = sharedStreamVersion;
+    header->slotsCount = slotsCount;
+    header->slotSamples = slotSamples;
+    header->slotSize = slotSize;
+    header->sampleRate = sampleRate;
+    header->writeIndex.store(0);
+    header->wakeCounter.store(0);
+    header->alive.store(1);
+    for (uint32_t i = 0; i < slotsCount; ++i)
+        new (GetSlot(i)) SharedStreamSlot;
+    //consumers check magic last
+    std::atomic_thread_fence(std::memory_order_release);
+    header->magic = sharedStreamMagic;
+
+    this->name = name;
+    mappedSize = size;
+    slotIndex = 0;
+    slotOpen = false;
+    return 0;
+#else
+    return ReportError(ENOTSUP, "SharedStream: not supported on this platform");
+#endif
+}
+
+void SharedStreamPublisher::Close()
+{
+#ifdef __unix__
+    if (header == nullptr)
+        return;
+    Flush();
+    header->alive.store(0);
+    header->wakeCounter.fetch_add(1);
+    WakeConsumers(&header->wakeCounter);
+    munmap(header, mappedSize);
+    //attached consumers keep their mapping
+    shm_unlink(name.c_str());
+    header = nullptr;
+#endif
+}
+
+SharedStreamSlot* SharedStreamPublisher::GetSlot(uint64_t index) const
+{
+    const size_t headerSize = (sizeof(SharedStreamHeader) + 63) / 64 * 64;
+    char* base = reinterpret_cast<char*>(header) + headerSize;
+    return reinterpret_cast<SharedStreamSlot*>(base + (index % header->slotsCount)*header->slotSize);
+}
+
+void SharedStreamPublisher::BeginSlot(uint64_t timestamp)
+{
+    SharedStreamSlot* slot = GetSlot(slotIndex);
+    slot->sequence.store(2*slotIndex+1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot->timestamp = timestamp;
+    slot->count = 0;
+    slot->flags = 0;
+    slotOpen = true;
+}
+
+void SharedStreamPublisher::EndSlot()
+{
+    SharedStreamSlot* slot = GetSlot(slotIndex);
+    slot->sequence.store(2*slotIndex+2, std::memory_order_release);
+    ++slotIndex;
+    slotOpen = false;
+    header->writeIndex.store(slotIndex, std::memory_order_release);
+    header->wakeCounter.fetch_add(1, std::memory_order_release);
+    WakeConsumers(&header->wakeCounter);
+}
+
+complex16_t* SharedStreamPublisher::Acquire(uint32_t count, uint64_t timestamp)
+{
+    if (header == nullptr || count > header->slotSamples)
+        return nullptr;
+    if (slotOpen)
+    {
+        const SharedStreamSlot* slot = GetSlot(slotIndex);
+        if (timestamp != nextTimestamp || slot->count + count > header->slotSamples)
+            EndSlot();
+    }
+    if (not slotOpen)
+        BeginSlot(timestamp);
+    nextTimestamp = timestamp;
+    SharedStreamSlot* slot = GetSlot(slotIndex);
+    return reinterpret_cast<complex16_t*>(slot+1) + slot->count;
+}
+
+void SharedStreamPublisher::Commit(uint32_t count, uint32_t flags)
+{
+    if (header == nullptr || not slotOpen)
+        return;
+    SharedStreamSlot* slot = GetSlot(slotIndex);
+    slot->count += count;
+    slot->flags |= flags;
+    nextTimestamp += count;
+    if (slot->count == header->slotSamples)
+        EndSlot();
+}
+
+void SharedStreamPublisher::Publish(const complex16_t* samples, uint32_t count, uint64_t timestamp, uint32_t flags)
+{
+    if (header == nullptr)
+        return;
+    while (count > 0)
+    {
+        const uint32_t chunk = std::min(count, header->slotSamples);
+        complex16_t* dest = Acquire(chunk, timestamp);
+        std::copy(samples, samples+chunk, dest);
+        Commit(chunk, flags);
+        samples += chunk;
+        timestamp += chunk;
+        count -= chunk;
+    }
+}
+
+void SharedStreamPublisher::Flush()
+{
+    if (header && slotOpen && GetSlot(slotIndex)->count > 0)
+        EndSlot();
+}
+
+//-----------------------------------------------------------------------------
+SharedStreamConsumer::SharedStreamConsumer() :
+    header(nullptr),
+    mappedSize(0),
+    cursor(0),
+    pendingSequence(0),
+    overflows(0)
+{
+}
+
+SharedStreamConsumer::~SharedStreamConsumer()
+{
+    Detach();
+}
+
+int SharedStreamConsumer::Attach(const std::string &name, bool fromOldest)
+{
+#ifdef __unix__
+    Detach();
+    const int fd = shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd < 0)
+        return ReportError(errno, "SharedStream: %s not found", name.c_str());
+    struct stat st;
+    if (fstat(fd, &st) != 0 || size_t(st.st_size) < sizeof(SharedStreamHeader))
+    {
+        close(fd);
+        return ReportError(EINVAL, "SharedStream: %s is not initialized", name.c_str());
+    }
+    void* ptr = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (ptr == MAP_FAILED)
+        return ReportError(errno, "SharedStream: failed to map %s", name.c_str());
+
+    const SharedStreamHeader* hdr = static_cast<const SharedStreamHeader*>(ptr);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (hdr->magic != sharedStreamMagic || hdr->version != sharedStreamVersion)
+    {
+        munmap(ptr, st.st_size);
+        return ReportError(EINVAL, "SharedStream: %s has unsupported format", name.c_str());
+    }
+    header = hdr;
+    mappedSize = st.st_size;
+    const uint64_t written = header->writeIndex.load(std::memory_order_acquire);
+    cursor = written;
+    if (fromOldest)
+        cursor = written >= header->slotsCount ? written - header->slotsCount + 1 : 0;
+    overflows = 0;
+    return 0;
+#else
+    return ReportError(ENOTSUP, "SharedStream: not supported on this platform");
+#endif
+}
+
+void SharedStreamConsumer::Detach()
+{
+#ifdef __unix__
+    if (header)
+        munmap((void*)header, mappedSize);
+#endif
+    header = nullptr;
+}
+
+const SharedStreamSlot* SharedStreamConsumer::GetSlot(uint64_t index) const
+{
+    const size_t headerSize = (sizeof(SharedStreamHeader) + 63) / 64 * 64;
+    const char* base = reinterpret_cast<const char*>(header) + headerSize;
+    return reinterpret_cast<const SharedStreamSlot*>(base + (index % header->slotsCount)*header->slotSize);
+}
+
+bool SharedStreamConsumer::Wait(int timeout_ms)
+{
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+    while (true)
+    {
+        const uint32_t wake = header->wakeCounter.load(std::memory_order_acquire);
+        if (header->writeIndex.load(std::memory_order_acquire) > cursor)
+            return true;
+        if (header->alive.load() == 0)
+            return false;
+        const auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline-std::chrono::steady_clock::now()).count();
+        if (left <= 0)
+            return false;
+        WaitForPublisher(&header->wakeCounter, wake, std::min<long>(left, 100));
+    }
+}
+
+int SharedStreamConsumer::Acquire(const complex16_t** samples, uint64_t* timestamp, uint32_t* flags, int timeout_ms)
+{
+    if (header == nullptr)
+        return -1;
+    while (true)
+    {
+        if (not Wait(timeout_ms))
+            return 0;
+        const uint64_t written = header->writeIndex.load(std::memory_order_acquire);
+        //slot at index 'written' may already be rewritten
+        if (written - cursor >= header->slotsCount)
+        {
+            const uint64_t oldest = written - header->slotsCount + 1;
+            overflows += oldest - cursor;
+            cursor = oldest;
+        }
+        const SharedStreamSlot* slot = GetSlot(cursor);
+        pendingSequence = slot->sequence.load(std::memory_order_acquire);
+        if (pendingSequence != 2*cursor+2)
+        {
+            ++overflows;
+            ++cursor;
+            continue;
+        }
+        *samples = reinterpret_cast<const complex16_t*>(slot+1);
+        if (timestamp)
+            *timestamp = slot->timestamp;
+        if (flags)
+            *flags = slot->flags;
+        return std::min(slot->count, header->slotSamples);
+    }
+}
+
+bool SharedStreamConsumer::Release()
+{
+    if (header == nullptr)
+        return false;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const bool valid = GetSlot(cursor)->sequence.load(std::memory_order_relaxed) == pendingSequence;
+    ++cursor;
+    if (not valid)
+        ++overflows;
+    return valid;
+}
+
+SharedStreamConsumer::Info SharedStreamConsumer::GetInfo() const
+{
+    Info info = {};
+    if (header == nullptr)
+        return info;
+    info.slotsCount = header->slotsCount;
+    info.slotSamples = header->slotSamples;
+    info.sampleRate = header->sampleRate;
+    info.overflows = overflows;
+    info.publisherAlive = header->alive.load() != 0;
+    return info;
+}
@@ -0,0 +1,154 @@
+/**
+    @file SharedStream.h
+    @author Lime Microsystems
+    @brief Receive samples ring in shared memory for local consumers.
+*/
+
+#pragma once
+#include "LimeSuiteConfig.h"
+#include "dataTypes.h"
+#include <atomic>
+#include <string>
+
+namespace lime{
+
+/*!
+ * Layout of the shared memory region: header followed by slotsCount slots.
+ * Every slot is guarded by a sequence number (seqlock), odd while the
+ * publisher writes it, so readers can detect that the slot was overwritten
+ * while they were using it.
+ */
+struct SharedStreamHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t slotsCount;
+    uint32_t slotSamples;           ///<maximum samples in slot
+    uint64_t slotSize;              ///<bytes per slot, including slot header
+    double sampleRate;
+    std::atomic<uint64_t> writeIndex;   ///<number of slots completed
+    std::atomic<uint32_t> wakeCounter;  ///<incremented on every completed slot
+    std::atomic<uint32_t> alive;        ///<cleared when publisher closes
+};
+
+struct SharedStreamSlot
+{
+    std::atomic<uint64_t> sequence; ///<2*index+1 while writing, 2*index+2 when complete
+    uint64_t timestamp;             ///<timestamp of the first sample
+    uint32_t count;                 ///<number of samples
+    uint32_t flags;
+    //complex16_t samples[slotSamples] follow
+};
+
+/*!
+ * SharedStreamPublisher creates named POSIX shared memory ring and
+ * publishes received samples to it. Packets are collected into slots,
+ * slot is completed when full or when timestamps are not continuous.
+ */
+class LIME_API SharedStreamPublisher
+{
+public:
+    SharedStreamPublisher();
+    ~SharedStreamPublisher();
+
+    /** @brief Creates shared memory ring
+        @param name shared memory object name, e.g. "/lime-rx0"
+        @param slotsCount number of slots in ring
+        @param slotSamples number of samples in slot
+        @param sampleRate sampling rate, informational
+        @return 0 on success, fails if object with the same name exists
+    */
+    int Open(const std::string &name, uint32_t slotsCount, uint32_t slotSamples, double sampleRate);
+
+    //! @brief Marks ring as closed and removes shared memory object
+    void Close();
+
+    /** @brief Returns destination for samples in current slot
+        @param count number of samples to be written
+        @param timestamp timestamp of first sample
+        @return destination, must be followed by Commit()
+    */
+    complex16_t* Acquire(uint32_t count, uint64_t timestamp);
+
+    /** @brief Completes samples written to Acquire() destination
+        @param count number of samples written
+        @param flags metadata flags
+    */
+    void Commit(uint32_t count, uint32_t flags);
+
+    //! @brief Copies samples to the ring
+    void Publish(const complex16_t* samples, uint32_t count, uint64_t timestamp, uint32_t flags);
+
+    //! @brief Completes partially filled slot
+    void Flush();
+
+private:
+    SharedStreamSlot* GetSlot(uint64_t index) const;
+    void BeginSlot(uint64_t timestamp);
+    void EndSlot();
+
+    std::string name;
+    SharedStreamHeader* header;
+    size_t mappedSize;
+    uint64_t slotIndex;         ///<index of slot being written
+    bool slotOpen;
+    uint64_t nextTimestamp;
+};
+
+/*!
+ * SharedStreamConsumer attaches to a ring read-only and returns pointers
+ * to the samples in shared memory. Every consumer keeps its own read cursor,
+ * consumer that falls more than the ring length behind skips to the oldest
+ * valid slot and counts the lost slots.
+ */
+class LIME_API SharedStreamConsumer
+{
+public:
+    struct Info
+    {
+        uint32_t slotsCount;
+        uint32_t slotSamples;
+        double sampleRate;
+        uint64_t overflows;     ///<slots lost by this consumer
+        bool publisherAlive;
+    };
+
+    SharedStreamConsumer();
+    ~SharedStreamConsumer();
+
+    /** @brief Attaches to shared memory ring
+        @param name shared memory object name given to publisher
+        @param fromOldest start with the oldest slot instead of the next one
+        @return 0 on success
+    */
+    int Attach(const std::string &name, bool fromOldest = false);
+    void Detach();
+
+    /** @brief Waits for next slot and returns its samples without copying
+        @param samples returns pointer to samples in shared memory
+        @param timestamp returns timestamp of first sample
+        @param flags returns slot flags
+        @param timeout_ms timeout for waiting
+        @return number of samples, 0 on timeout, -1 when not attached
+    */
+    int Acquire(const complex16_t** samples, uint64_t* timestamp, uint32_t* flags, int timeout_ms);
+
+    /** @brief Finishes using samples returned by Acquire()
+        @return true if the samples were not overwritten while in use
+    */
+    bool Release();
+
+    Info GetInfo() const;
+
+private:
+    const SharedStreamSlot* GetSlot(uint64_t index) const;
+    bool Wait(int timeout_ms);
+
+    const SharedStreamHeader* header;
+    size_t mappedSize;
+    uint64_t cursor;        ///<next slot to read
+    uint64_t pendingSequence;
+    uint64_t overflows;
+};
+
+}
@@ -0,0 +1,456 @@
+/**
+    @file StreamRecorder.cpp
+    @author Lime Microsystems
+    @brief Records receive streams to disk in SigMF format.
+*/
+
+#include "StreamRecorder.h"
+#include "ErrorReporting.h"
+#include "FPGA_common.h"
+#include "Logger.h"
+#include "VersionInfo.h"
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <sstream>
+#include <fcntl.h>
+
+#ifdef __unix__
+#include <unistd.h>
+#else
+#include <io.h>
+#endif
+
+using namespace lime;
+
+static const size_t diskAlignment = 4096;
+static const int samplesPerRead = 8192;
+static const int idleWait_ms = 10;
+
+//-----------------------------------------------------------------------------
+// file helpers, O_DIRECT where supported
+//-----------------------------------------------------------------------------
+static int OpenDataFile(const std::string &path, bool &directIO)
+{
+#ifdef __unix__
+    int fd = -1;
+#ifdef O_DIRECT
+    //not supported by some file systems, e.g. tmpfs
+    fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_DIRECT, 0644);
+#endif
+    directIO = fd >= 0;
+    if (fd < 0)
+        fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    return fd;
+#else
+    directIO = false;
+    return _open(path.c_str(), _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, 0644);
+#endif
+}
+
+static bool WriteAll(int fd, const char* data, size_t bytes)
+{
+    while (bytes > 0)
+    {
+#ifdef __unix__
+        const ssize_t ret = write(fd, data, bytes);
+#else
+        const int ret = _write(fd, data, bytes);
+#endif
+        if (ret < 0 && errno == EINTR)
+            continue;
+        if (ret <= 0)
+            return false;
+        data += ret;
+        bytes -= ret;
+    }
+    return true;
+}
+
+static void CloseDataFile(int fd, uint64_t size)
+{
+#ifdef __unix__
+    //remove padding of the last aligned block
+    if (ftruncate(fd, size) != 0)
+        lime::warning("Recorder: failed to truncate data file");
+    close(fd);
+#else
+    _chsize_s(fd, size);
+    _close(fd);
+#endif
+}
+
+static std::string EscapeJSON(const std::string &text)
+{
+    std::string out;
+    for (char c : text)
+    {
+        if (c == '"' || c == '\\')
+            out += '\\';
+        if ((unsigned char)c < 0x20)
+            continue;
+        out += c;
+    }
+    return out;
+}
+
+//-----------------------------------------------------------------------------
+RecorderConfig::RecorderConfig() :
+    format(StreamConfig::STREAM_12_BIT_IN_16),
+    packed(false),
+    blockSize(4*1024*1024),
+    blocksCount(16),
+    sampleRate(0),
+    frequency(0)
+{
+}
+
+StreamRecorder::StreamRecorder() :
+    currentBlock(-1),
+    blockFill(0),
+    fd(-1),
+    directIO(false),
+    stopReader(false),
+    readerDone(false),
+    active(false),
+    error(false),
+    samples(0),
+    bytesWritten(0),
+    gaps(0),
+    droppedSamples(0),
+    writerStalls(0)
+{
+}
+
+StreamRecorder::~StreamRecorder()
+{
+    Stop();
+}
+
+std::string StreamRecorder::GetDatatype(const RecorderConfig &config)
+{
+    if (config.packed)
+        return "ci12_le"; //not SigMF core type, compressed link payload
+    switch (config.format)
+    {
+    case StreamConfig::STREAM_COMPLEX_FLOAT32: return "cf32_le";
+    case StreamConfig::STREAM_COMPLEX_FLOAT16: return "cf16_le";
+    case StreamConfig::STREAM_COMPLEX_INT8: return "ci8";
+    default: return "ci16_le";
+    }
+}
+
+size_t StreamRecorder::GetSampleSize() const
+{
+    switch (config.format)
+    {
+    case StreamConfig::STREAM_COMPLEX_FLOAT32: return 2*sizeof(float);
+    case StreamConfig::STREAM_COMPLEX_INT8: return 2*sizeof(int8_t);
+    default: return 2*sizeof(int16_t);
+    }
+}
+
+int StreamRecorder::Start(const std::vector<IStreamChannel*> &streams, const RecorderConfig &config)
+{
+    if (active.load())
+        return ReportError(EBUSY, "Recorder: recording already running");
+    if (streams.empty())
+        return ReportError(EINVAL, "Recorder: no streams to record");
+    if (config.packed && (config.format != StreamConfig::STREAM_12_BIT_COMPRESSED || streams.size() > 2))
+        return ReportError(EINVAL, "Recorder: packed recording requires 12 bit compressed format and up to 2 channels");
+
+    this->config = config;
+    this->config.blockSize = std::max(diskAlignment, (config.blockSize+diskAlignment-1)/diskAlignment*diskAlignment);
+    this->config.blocksCount = std::max<size_t>(config.blocksCount, 2);
+    this->streams = streams;
+
+    const std::string dataPath = config.path + ".sigmf-data";
+    fd = OpenDataFile(dataPath, directIO);
+    if (fd < 0)
+        return ReportError(errno, "Recorder: failed to open %s", dataPath.c_str());
+    if (not directIO)
+        lime::warning("Recorder: direct I/O not supported, writing through page cache");
+
+    try
+    {
+        blocks.Allocate(this->config.blockSize*this->config.blocksCount);
+    }
+    catch (const std::bad_alloc &)
+    {
+        CloseDataFile(fd, 0);
+        fd = -1;
+        return ReportError(ENOMEM, "Recorder: failed to allocate buffers");
+    }
+
+    freeBlocks.clear();
+    fullBlocks.clear();
+    for (size_t i = 0; i < this->config.blocksCount; ++i)
+        freeBlocks.push_back(i);
+    currentBlock = -1;
+    blockFill = 0;
+    captures.clear();
+    samples.store(0);
+    bytesWritten.store(0);
+    gaps.store(0);
+    droppedSamples.store(0);
+    writerStalls.store(0);
+    error.store(false);
+    stopReader.store(false);
+    readerDone = false;
+
+    char timeText[32];
+    const std::time_t now = std::time(nullptr);
+    std::strftime(timeText, sizeof(timeText), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+    startTime = timeText;
+
+    active.store(true);
+    writerThread = std::thread(&StreamRecorder::WriterLoop, this);
+    readerThread = std::thread(&StreamRecorder::ReaderLoop, this);
+    return 0;
+}
+
+int StreamRecorder::Stop()
+{
+    if (not active.load())
+        return 0;
+    {
+        std::lock_guard<std::mutex> lck(queueLock);
+        stopReader.store(true);
+        queueCond.notify_all();
+    }
+    readerThread.join();
+    writerThread.join();
+    CloseDataFile(fd, bytesWritten.load());
+    fd = -1;
+    blocks.Release();
+    active.store(false);
+    return WriteMetadata();
+}
+
+StreamRecorder::Status StreamRecorder::GetStatus() const
+{
+    Status status;
+    status.active = active.load();
+    status.error = error.load();
+    status.samples = samples.load();
+    status.bytesWritten = bytesWritten.load();
+    status.gaps = gaps.load();
+    status.droppedSamples = droppedSamples.load();
+    status.writerStalls = writerStalls.load();
+    return status;
+}
+
+/** @brief Pauses reader when stream returned no samples without blocking,
+    e.g. it is stopped, returns early when recording is stopped
+*/
+void StreamRecorder::WaitIdle()
+{
+    std::unique_lock<std::mutex> lck(queueLock);
+    queueCond.wait_for(lck, std::chrono::milliseconds(idleWait_ms), [this](){return stopReader.load() || error.load();});
+}
+
+void StreamRecorder::ReaderLoop()
+{
+    const size_t chCount = streams.size();
+    const size_t sampleSize = GetSampleSize();
+    std::vector<std::vector<char>> chBuffers(chCount, std::vector<char>(samplesPerRead*sampleSize));
+    std::vector<char> output(chCount > 1 || config.packed ? samplesPerRead*chCount*sampleSize : 0);
+    uint64_t nextTimestamp = 0;
+
+    while (not stopReader.load() && not error.load())
+    {
+        IStreamChannel::Metadata meta;
+        meta.flags = 0;
+        meta.timestamp = 0;
+        const int cnt = streams[0]->Read(chBuffers[0].data(), samplesPerRead, &meta, 100);
+        if (cnt <= 0)
+        {
+            WaitIdle();
+            continue;
+        }
+
+        //other channels are read to the same length
+        bool complete = true;
+        for (size_t ch = 1; ch < chCount && complete; ++ch)
+        {
+            int got = 0;
+            while (got < cnt && not stopReader.load())
+            {
+                IStreamChannel::Metadata chMeta;
+                chMeta.flags = 0;
+                chMeta.timestamp = 0;
+                const int ret = streams[ch]->Read(&chBuffers[ch][got*sampleSize], cnt-got, &chMeta, 100);
+                if (ret > 0)
+                    got += ret;
+                else
+                    WaitIdle();
+            }
+            complete = got == cnt;
+        }
+        if (not complete)
+            break;
+
+        if (captures.empty() || meta.timestamp != nextTimestamp)
+        {
+            if (not captures.empty())
+            {
+                ++gaps;
+                if (meta.timestamp > nextTimestamp)
+                    droppedSamples += meta.timestamp - nextTimestamp;
+            }
+            Capture capture;
+            capture.sampleStart = samples.load();
+            capture.timestamp = meta.timestamp;
+            captures.push_back(capture);
+        }
+        nextTimestamp = meta.timestamp + cnt;
+
+        if (config.packed)
+        {
+            const complex16_t* src[2];
+            for (size_t ch = 0; ch < chCount; ++ch)
+                src[ch] = (const complex16_t*)chBuffers[ch].data();
+            const int bytes = fpga::Samples2FPGAPacketPayload(src, cnt, chCount == 2, true, (uint8_t*)output.data());
+            Append(output.data(), bytes);
+        }
+        else if (chCount == 1)
+            Append(chBuffers[0].data(), cnt*sampleSize);
+        else
+        {
+            char* dest = output.data();
+            for (int i = 0; i < cnt; ++i)
+                for (size_t ch = 0; ch < chCount; ++ch)
+                {
+                    memcpy(dest, &chBuffers[ch][i*sampleSize], sampleSize);
+                    dest += sampleSize;
+                }
+            Append(output.data(), dest-output.data());
+        }
+        samples += cnt;
+    }
+
+    if (currentBlock >= 0 && blockFill > 0)
+        SubmitBlock(blockFill);
+    std::unique_lock<std::mutex> lck(queueLock);
+    readerDone = true;
+    queueCond.notify_all();
+}
+
+void StreamRecorder::Append(const char* data, size_t bytes)
+{
+    while (bytes > 0)
+    {
+        if (currentBlock < 0)
+        {
+            std::unique_lock<std::mutex> lck(queueLock);
+            if (freeBlocks.empty())
+            {
+                ++writerStalls;
+                queueCond.wait(lck, [this](){return not freeBlocks.empty() || error.load();});
+            }
+            if (error.load())
+                return;
+            currentBlock = freeBlocks.front();
+            freeBlocks.pop_front();
+            blockFill = 0;
+        }
+        const size_t count = std::min(bytes, config.blockSize - blockFill);
+        memcpy(&blocks[currentBlock*config.blockSize + blockFill], data, count);
+        blockFill += count;
+        data += count;
+        bytes -= count;
+        if (blockFill == config.blockSize)
+            SubmitBlock(blockFill);
+    }
+}
+
+void StreamRecorder::SubmitBlock(size_t bytes)
+{
+    std::unique_lock<std::mutex> lck(queueLock);
+    fullBlocks.push_back(std::make_pair(currentBlock, bytes));
+    currentBlock = -1;
+    queueCond.notify_all();
+}
+
+void StreamRecorder::WriterLoop()
+{
+    std::unique_lock<std::mutex> lck(queueLock);
+    while (true)
+    {
+        queueCond.wait(lck, [this](){return not fullBlocks.empty() || readerDone;});
+        if (fullBlocks.empty())
+            break;
+        const std::pair<int, size_t> item = fullBlocks.front();
+        fullBlocks.pop_front();
+        lck.unlock();
+
+        char* data = &blocks[item.first*config.blockSize];
+        size_t bytes = item.second;
+        //direct I/O needs aligned length, padding is truncated when file is closed
+        if (bytes % diskAlignment)
+        {
+            const size_t padded = (bytes + diskAlignment - 1) / diskAlignment * diskAlignment;
+            memset(data + bytes, 0, padded - bytes);
+            bytes = padded;
+        }
+        const bool written = WriteAll(fd, data, bytes);
+        if (written)
+            bytesWritten += item.second;
+
+        lck.lock();
+        if (not written)
+        {
+            lime::error("Recorder: disk write failed (%s), recording stopped", strerror(errno));
+            error.store(true);
+            stopReader.store(true);
+            queueCond.notify_all();
+            break;
+        }
+        freeBlocks.push_back(item.first);
+        queueCond.notify_all();
+    }
+}
+
+int StreamRecorder::WriteMetadata()
+{
+    const std::string metaPath = config.path + ".sigmf-meta";
+    std::ofstream file(metaPath);
+    if (not file.is_open())
+        return ReportError(errno, "Recorder: failed to write %s", metaPath.c_str());
+
+    file.precision(15);
+    file << "{\n";
+    file << "    \"global\": {\n";
+    file << "        \"core:datatype\": \"" << GetDatatype(config) << "\",\n";
+    file << "        \"core:version\": \"1.0.0\",\n";
+    file << "        \"core:num_channels\": " << streams.size() << ",\n";
+    if (config.sampleRate > 0)
+        file << "        \"core:sample_rate\": " << config.sampleRate << ",\n";
+    if (not config.hardware.empty())
+        file << "        \"core:hw\": \"" << EscapeJSON(config.hardware) << "\",\n";
+    if (not config.description.empty())
+        file << "        \"core:description\": \"" << EscapeJSON(config.description) << "\",\n";
+    file << "        \"core:recorder\": \"LimeSuite " << GetLibraryVersion() << "\",\n";
+    file << "        \"lime:gaps\": " << gaps.load() << ",\n";
+    file << "        \"lime:dropped_samples\": " << droppedSamples.load() << "\n";
+    file << "    },\n";
+    file << "    \"captures\": [";
+    for (size_t i = 0; i < captures.size(); ++i)
+    {
+        file << (i ? ",\n" : "\n");
+        file << "        {\"core:sample_start\": " << captures[i].sampleStart;
+        file << ", \"core:global_index\": " << captures[i].timestamp;
+        if (config.frequency > 0)
+            file << ", \"core:frequency\": " << config.frequency;
+        if (i == 0)
+            file << ", \"core:datetime\": \"" << startTime << "\"";
+        file << "}";
+    }
+    file << "\n    ],\n";
+    file << "    \"annotations\": []\n";
+    file << "}\n";
+    return file.good() ? 0 : ReportError(EIO, "Recorder: failed to write %s", metaPath.c_str());
+}
@@ -0,0 +1,139 @@
+/**
+    @file StreamRecorder.h
+    @author Lime Microsystems
+    @brief Records receive streams to disk in SigMF format.
+*/
+
+#pragma once
+#include "LimeSuiteConfig.h"
+#include "IConnection.h"
+#include "BufferPool.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace lime{
+
+//! Recording options
+struct LIME_API RecorderConfig
+{
+    RecorderConfig();
+
+    //! File name without extension, .sigmf-data and .sigmf-meta are appended
+    std::string path;
+
+    //! Sample format used when the recorded streams were set up
+    StreamConfig::StreamDataFormat format;
+
+    /*!
+     * Store 12 bit samples packed as in compressed link payload,
+     * 3 bytes per complex sample. Only for STREAM_12_BIT_COMPRESSED.
+     */
+    bool packed;
+
+    //! Size of a single disk write in bytes, multiple of 4096
+    size_t blockSize;
+
+    //! Number of blocks queued between stream reader and disk writer
+    size_t blocksCount;
+
+    //! Sampling rate in Hz, written to metadata
+    double sampleRate;
+
+    //! Center frequency in Hz, written to metadata
+    double frequency;
+
+    //! Optional hardware and free text description for metadata
+    std::string hardware;
+    std::string description;
+};
+
+/*!
+ * StreamRecorder reads samples from one or more receive streams and writes
+ * them interleaved to a file. Data is written from a separate thread, in
+ * large aligned blocks bypassing the page cache (O_DIRECT) when the file
+ * system allows it. Timestamp discontinuities start new SigMF capture
+ * segments, so gaps in the recording can be located afterwards.
+ */
+class LIME_API StreamRecorder
+{
+public:
+    struct Status
+    {
+        bool active;
+        bool error;             ///<disk write failed, recording stopped
+        uint64_t samples;       ///<samples recorded per channel
+        uint64_t bytesWritten;
+        uint32_t gaps;          ///<timestamp discontinuities
+        uint64_t droppedSamples;///<samples missing in gaps
+        uint32_t writerStalls;  ///<times the reader waited for free block
+    };
+
+    StreamRecorder();
+    ~StreamRecorder();
+
+    /** @brief Starts recording, streams must be set up and started by caller
+        @param streams receive streams, recorded channels are interleaved
+        @param config recording options
+        @return 0 on success
+    */
+    int Start(const std::vector<IStreamChannel*> &streams, const RecorderConfig &config);
+
+    /** @brief Stops recording, flushes data and writes metadata file
+        @return 0 on success
+    */
+    int Stop();
+
+    Status GetStatus() const;
+
+    //! @brief Returns SigMF datatype for given recording format
+    static std::string GetDatatype(const RecorderConfig &config);
+
+private:
+    struct Capture
+    {
+        uint64_t sampleStart;
+        uint64_t timestamp;
+    };
+
+    void ReaderLoop();
+    void WaitIdle();
+    void WriterLoop();
+    void Append(const char* data, size_t bytes);
+    void SubmitBlock(size_t bytes);
+    int WriteMetadata();
+    size_t GetSampleSize() const;
+
+    RecorderConfig config;
+    std::vector<IStreamChannel*> streams;
+    PooledBuffer<char> blocks; ///<blocksCount consecutive blocks
+    std::deque<int> freeBlocks;
+    std::deque<std::pair<int, size_t>> fullBlocks; ///<block index and bytes used
+    int currentBlock;
+    size_t blockFill;
+    std::mutex queueLock;
+    std::condition_variable queueCond;
+
+    std::vector<Capture> captures;
+    std::string startTime;
+    int fd;
+    bool directIO;
+    std::atomic<bool> stopReader;
+    bool readerDone;
+    std::thread readerThread;
+    std::thread writerThread;
+
+    std::atomic<bool> active;
+    std::atomic<bool> error;
+    std::atomic<uint64_t> samples;
+    std::atomic<uint64_t> bytesWritten;
+    std::atomic<uint32_t> gaps;
+    std::atomic<uint64_t> droppedSamples;
+    std::atomic<uint32_t> writerStalls;
+};
+
+}
@@ -0,0 +1,117 @@
+/**
+    @file TriggeredCapture.cpp
+    @author Lime Microsystems
+    @brief Keeps only received packets around power triggered bursts.
+*/
+
+#include "TriggeredCapture.h"
+#include <algorithm>
+#include <cmath>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+using namespace lime;
+
+TriggeredCapture::TriggeredCapture(const TriggerConfig &config, const uint32_t packetSize) :
+    config(config),
+    current(0),
+    stored(0),
+    windowIndex(0),
+    windowSum(0),
+    capturing(false),
+    quietPackets(0),
+    triggers(0)
+{
+    slots.resize(config.preTriggerPackets+1);
+    for (auto &slot : slots)
+    {
+        slot.samples.resize(packetSize);
+        slot.count = 0;
+        slot.timestamp = 0;
+    }
+    window.assign(std::max<uint32_t>(config.window, 1), 0);
+    powers.resize(packetSize);
+    const double level = config.level;
+    thresholdSum = std::max<uint64_t>(llround(level*level*window.size()), 1);
+}
+
+complex16_t* TriggeredCapture::Acquire(const uint32_t count, const uint64_t timestamp)
+{
+    Slot &slot = slots[current];
+    slot.count = std::min<uint32_t>(count, slot.samples.size());
+    slot.timestamp = timestamp;
+    return slot.samples.data();
+}
+
+/** @brief Slides power window over packet samples
+    @return true if window power reached trigger level at any sample
+*/
+bool TriggeredCapture::UpdatePower(const complex16_t* samples, const uint32_t count)
+{
+    uint32_t n = 0;
+#ifdef __SSE2__
+    //I*I+Q*Q of four samples at once, fits unsigned 32 bits
+    for (; n+4 <= count; n += 4)
+    {
+        const __m128i x = _mm_loadu_si128((const __m128i*)&samples[n]);
+        _mm_storeu_si128((__m128i*)&powers[n], _mm_madd_epi16(x, x));
+    }
+#endif
+    for (; n < count; ++n)
+        powers[n] = int32_t(samples[n].i)*samples[n].i + int32_t(samples[n].q)*samples[n].q;
+
+    bool above = false;
+    const size_t length = window.size();
+    for (n = 0; n < count; ++n)
+    {
+        windowSum += powers[n];
+        windowSum -= window[windowIndex];
+        window[windowIndex] = powers[n];
+        if (++windowIndex == length)
+            windowIndex = 0;
+        above |= windowSum >= thresholdSum;
+    }
+    return above;
+}
+
+void TriggeredCapture::Commit(const uint32_t count, const Sink &sink)
+{
+    Slot &slot = slots[current];
+    slot.count = std::min<uint32_t>(count, slot.count);
+    const bool above = UpdatePower(slot.samples.data(), slot.count);
+
+    if (not capturing && above)
+    {
+        //deliver history oldest first, then continue with live packets
+        capturing = true;
+        ++triggers;
+        const size_t size = slots.size();
+        for (size_t k = stored; k > 0; --k)
+        {
+            const Slot &old = slots[(current + size - k) % size];
+            sink(old.samples.data(), old.count, old.timestamp, false);
+        }
+        stored = 0;
+    }
+
+    if (capturing)
+    {
+        quietPackets = above ? 0 : quietPackets+1;
+        //window trails the burst, so the packet where level falls is still
+        //above it, at least one quiet packet is needed to end the segment
+        const bool last = quietPackets >= std::max<uint32_t>(config.postTriggerPackets, 1);
+        sink(slot.samples.data(), slot.count, slot.timestamp, last);
+        if (last)
+        {
+            capturing = false;
+            quietPackets = 0;
+        }
+        return;
+    }
+
+    //idle packet stays in history until overwritten
+    stored = std::min(stored+1, slots.size()-1);
+    current = (current+1) % slots.size();
+}
@@ -0,0 +1,75 @@
+/**
+    @file TriggeredCapture.h
+    @author Lime Microsystems
+    @brief Keeps only received packets around power triggered bursts.
+*/
+
+#pragma once
+#include "IConnection.h"
+#include "dataTypes.h"
+#include <functional>
+#include <vector>
+
+namespace lime{
+
+/*!
+ * TriggeredCapture holds the last received packets in a ring and measures
+ * signal power over a sliding window. Packets are passed on only when the
+ * power crosses the trigger level: the stored pre-trigger packets, packets
+ * while power stays above the level and post-trigger packets after it
+ * falls. Idle packets are overwritten in the ring and never copied.
+ *
+ * Packets are decoded straight into the ring: Acquire() gives destination
+ * for the next packet, Commit() evaluates it.
+ */
+class LIME_API TriggeredCapture
+{
+public:
+    /*!
+     * Receives captured packets:
+     * (samples, count, timestamp of first sample, last packet of segment)
+     */
+    typedef std::function<void(const complex16_t*, uint32_t, uint64_t, bool)> Sink;
+
+    TriggeredCapture(const TriggerConfig &config, const uint32_t packetSize);
+
+    /** @brief Returns destination for next packet
+        @param count number of samples in packet, at most packetSize
+        @param timestamp timestamp of the first sample
+    */
+    complex16_t* Acquire(const uint32_t count, const uint64_t timestamp);
+
+    /** @brief Evaluates packet returned by Acquire() and delivers captured packets
+        @param count number of samples decoded
+        @param sink receives packets of triggered segment
+    */
+    void Commit(const uint32_t count, const Sink &sink);
+
+    //! @brief Returns number of segments started
+    uint64_t GetTriggersCount() const {return triggers;}
+
+private:
+    struct Slot
+    {
+        std::vector<complex16_t> samples;
+        uint32_t count;
+        uint64_t timestamp;
+    };
+
+    bool UpdatePower(const complex16_t* samples, const uint32_t count);
+
+    TriggerConfig config;
+    std::vector<Slot> slots;        ///<history ring, last slot is being filled
+    size_t current;                 ///<slot returned by Acquire()
+    size_t stored;                  ///<history packets before current slot
+    std::vector<uint32_t> window;   ///<power of samples in sliding window
+    std::vector<uint32_t> powers;   ///<power of samples in current packet
+    size_t windowIndex;
+    uint64_t windowSum;
+    uint64_t thresholdSum;          ///<window sum at trigger level
+    bool capturing;
+    uint32_t quietPackets;          ///<packets below level in current segment
+    uint64_t triggers;
+};
+
+}
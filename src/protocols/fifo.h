@@ -10,8 +10,10 @@
 #include <condition_variable>
 #include "dataTypes.h"
 #include <cmath>
+#include <algorithm>
 #include <assert.h>
 #include "IConnection.h"
+#include "BufferPool.h"
 
 namespace lime{
 
@@ -35,16 +37,24 @@ public:
         return stats;
     }
 
-    //!    @brief Initializes FIFO memory
-    RingFIFO(const uint32_t bufLength) : mBufferSize(1+(bufLength-1)/mBuffer->maxSamplesInPacket)
+    /** @brief Initializes FIFO memory
+        @param bufLength FIFO size in samples
+        @param poolFlags BufferPool flags used for packets memory
+        @param numaNode preferred NUMA node for packets memory, -1 for any
+    */
+    RingFIFO(const uint32_t bufLength, const unsigned poolFlags = BufferPool::PREFAULT, const int numaNode = -1) : mBufferSize(1+(bufLength-1)/mBuffer->maxSamplesInPacket)
     {
-        mBuffer = new SamplesPacket[mBufferSize];
+        mDirect.active = false;
+        mDirect.busy = false;
+        mBuffer = static_cast<SamplesPacket*>(BufferPool::Instance().Allocate(mBufferSize*sizeof(SamplesPacket), poolFlags, numaNode));
+        if (mBuffer == nullptr)
+            throw std::bad_alloc();
         Clear();
     }
 
     ~RingFIFO()
     {
-        delete []mBuffer;
+        BufferPool::Instance().Free(mBuffer);
     };
 
     /** @brief inserts samples to FIFO, operation is thread-safe
@@ -125,7 +135,43 @@ public:
             {
                 if (timeout_ms == 0)
                     return samplesFilled;
-                if (hasItems.wait_for(lck, std::chrono::milliseconds(timeout_ms)) == std::cv_status::timeout)
+                if (mDirect.active)
+                {
+                    //another reader owns the direct buffer, wait for packets in FIFO
+                    if (hasItems.wait_for(lck, std::chrono::milliseconds(timeout_ms)) == std::cv_status::timeout)
+                        return samplesFilled;
+                    continue;
+                }
+                //let the producer write next packets directly to the caller's buffer
+                mDirect.buffer = &buffer[samplesFilled];
+                mDirect.capacity = samplesCount - samplesFilled;
+                mDirect.filled = 0;
+                mDirect.flags = 0;
+                mDirect.active = true;
+                bool timedOut = false;
+                const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+                while (mElementsFilled == 0 && mDirect.filled < mDirect.capacity
+                    && (mDirect.flags & lime::IStreamChannel::Metadata::END_BURST) == 0)
+                    if (hasItems.wait_until(lck, deadline) == std::cv_status::timeout)
+                    {
+                        timedOut = true;
+                        break;
+                    }
+                //producer might still be writing to the buffer
+                while (mDirect.busy)
+                    hasItems.wait(lck);
+                mDirect.active = false;
+                if (mDirect.filled > 0)
+                {
+                    if (samplesFilled == 0 && timestamp != nullptr)
+                        *timestamp = mDirect.timestamp;
+                    if (flags != nullptr) *flags |= mDirect.flags;
+                    samplesFilled += mDirect.filled;
+                    //end of burst ends the pop, same as for queued packets
+                    if (samplesFilled == samplesCount || (mDirect.flags & lime::IStreamChannel::Metadata::END_BURST))
+                        goto done;
+                }
+                if (timedOut)
                     return samplesFilled;
             }
             if(samplesFilled == 0 && timestamp != nullptr)
@@ -163,6 +209,108 @@ public:
         return samplesFilled;
     }
 
+    /** @brief Takes several fixed size packets of samples out of FIFO in single operation
+        Equivalent to calling pop_samples() for each packet, stops after the packet containing end of burst.
+        @param buffer destination array, must be big enough for packetSize*packetsCount samples
+        @param packetSize number of samples in each packet
+        @param packetsCount maximum number of packets to take
+        @param meta returns timestamp of the first sample and flags for each packet
+        @param counts returns number of samples taken for each packet
+        @param timeout_ms timeout duration for waiting on empty FIFO
+        @return number of packets taken, only the last one can be incomplete
+    */
+    uint32_t pop_packets(complex16_t* buffer, const uint32_t packetSize, const uint32_t packetsCount, IStreamChannel::Metadata* meta, uint32_t* counts, const uint32_t timeout_ms)
+    {
+        assert(buffer != nullptr);
+        uint32_t packets = 0;
+        std::unique_lock<std::mutex> lck(lock);
+        while (packets < packetsCount)
+        {
+            complex16_t* dest = &buffer[packets*packetSize];
+            uint32_t filled = 0;
+            bool hasEOB = false;
+            meta[packets].flags = 0;
+            while (filled < packetSize && !hasEOB)
+            {
+                if (mElementsFilled == 0) //buffer might be empty, wait for packets
+                {
+                    if (timeout_ms == 0 || hasItems.wait_for(lck, std::chrono::milliseconds(timeout_ms)) == std::cv_status::timeout)
+                        break;
+                    continue;
+                }
+                if (filled == 0)
+                    meta[packets].timestamp = mBuffer[mHead].timestamp + mBuffer[mHead].first;
+                hasEOB = mBuffer[mHead].flags & lime::IStreamChannel::Metadata::END_BURST;
+                meta[packets].flags |= mBuffer[mHead].flags;
+                const int first = mBuffer[mHead].first;
+                const uint32_t cntbuf = mBuffer[mHead].last - first;
+                const uint32_t cnt = std::min(packetSize - filled, cntbuf);
+
+                memcpy(&dest[filled], &mBuffer[mHead].samples[first], cnt*sizeof(complex16_t));
+                filled += cnt;
+
+                if (cntbuf == cnt) //packet depleated
+                {
+                    mHead = (mHead + 1) & (mBufferSize - 1);//advance to next one
+                    --mElementsFilled;
+                }
+                else
+                    mBuffer[mHead].first += cnt;
+            }
+            counts[packets] = filled;
+            if (filled > 0)
+                ++packets;
+            if (filled < packetSize) //end of burst or timeout
+                break;
+        }
+        lck.unlock();
+        hasItems.notify_one();
+        return packets;
+    }
+
+    /** @brief Returns destination for the next packet when a reader is waiting on empty FIFO
+        Samples written to the returned buffer must be submitted with CommitDirect(),
+        only one producer may use this path at a time. Only the first reader
+        waiting on empty FIFO is served directly, others take queued packets.
+        @param samplesCount number of samples that will be written
+        @param timestamp timestamp of the first sample
+        @param flags flags associated with the samples
+        @return pointer to reader's buffer, nullptr if samples should be pushed to FIFO
+    */
+    complex16_t* AcquireDirect(const uint32_t samplesCount, const uint64_t timestamp, const uint32_t flags = 0)
+    {
+        std::unique_lock<std::mutex> lck(lock);
+        if (!mDirect.active || mDirect.busy || mElementsFilled != 0)
+            return nullptr;
+        //reader is leaving with a complete burst
+        if (mDirect.flags & IStreamChannel::Metadata::END_BURST)
+            return nullptr;
+        if (mDirect.capacity - mDirect.filled < samplesCount)
+            return nullptr;
+        if (mDirect.filled == 0)
+        {
+            mDirect.timestamp = timestamp;
+            mDirect.flags = 0;
+        }
+        mDirect.flags |= flags & ~IStreamChannel::Metadata::OVERWRITE_OLD;
+        mDirect.busy = true;
+        return &mDirect.buffer[mDirect.filled];
+    }
+
+    /** @brief Hands samples written to AcquireDirect() buffer to the reader
+        @param samplesCount number of samples written
+        @param flags flags of the written samples, END_BURST returns them to the reader
+    */
+    void CommitDirect(const uint32_t samplesCount, const uint32_t flags = 0)
+    {
+        std::unique_lock<std::mutex> lck(lock);
+        mDirect.flags |= flags & ~IStreamChannel::Metadata::OVERWRITE_OLD;
+        mDirect.filled += samplesCount;
+        mDirect.busy = false;
+        lck.unlock();
+        hasItems.notify_all();
+    }
+
     void Clear()
     {
         std::unique_lock<std::mutex> lck(lock);
@@ -177,6 +325,17 @@ protected:
     uint32_t mHead;
     uint32_t mTail;
     uint32_t mElementsFilled;
+    //! buffer of the reader waiting on empty FIFO
+    struct DirectReader
+    {
+        complex16_t* buffer;
+        uint32_t capacity;
+        uint32_t filled;
+        uint64_t timestamp;
+        uint32_t flags;
+        bool active;
+        bool busy; ///<producer is writing to the buffer
+    } mDirect;
     std::mutex lock;
     std::condition_variable hasItems;
 };
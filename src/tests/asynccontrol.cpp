@@ -0,0 +1,144 @@
+#include "gtest/gtest.h"
+#include "lms7_device.h"
+#include "lms7_async.h"
+#include "ErrorReporting.h"
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+using namespace std;
+
+class AsyncControlFixture : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        device.reset(LMS7_Device::CreateDevice(nullptr));
+        control = device->GetAsyncControl();
+    }
+
+    //keeps worker busy until released, so following requests stay queued
+    void BlockWorker()
+    {
+        release = false;
+        control->Submit([this](LMS7_Device*){
+            while (not release.load())
+                this_thread::sleep_for(chrono::milliseconds(1));
+            return 0;
+        });
+    }
+
+    unique_ptr<LMS7_Device> device;
+    LMS7_AsyncControl* control;
+    atomic<bool> release;
+};
+
+TEST_F(AsyncControlFixture, OperationsRunInOrderOnWorker)
+{
+    vector<int> order;
+    const thread::id caller = this_thread::get_id();
+    bool otherThread = true;
+    vector<future<int>> results;
+    for (int i = 0; i < 5; ++i)
+        results.push_back(control->Submit([&, i](LMS7_Device* dev){
+            order.push_back(i);
+            otherThread &= this_thread::get_id() != caller && dev == device.get();
+            return i;
+        }));
+    for (int i = 0; i < 5; ++i)
+        EXPECT_EQ(results[i].get(), i);
+    EXPECT_EQ(order, vector<int>({0, 1, 2, 3, 4}));
+    EXPECT_TRUE(otherThread);
+    control->Wait();
+    EXPECT_EQ(control->GetPendingCount(), 0u);
+}
+
+TEST_F(AsyncControlFixture, QueuedRequestWithSameKeyIsReplaced)
+{
+    BlockWorker();
+    vector<int> order;
+    const LMS7_AsyncControl::Key key = LMS7_AsyncControl::MakeKey(LMS7_AsyncControl::OP_USER, false, 0);
+    int callbacks = 0;
+    auto count = [&](int status, const char*){ if (status == 2) ++callbacks;};
+    future<int> first = control->Submit([&](LMS7_Device*){order.push_back(1); return 1;}, key, count);
+    const LMS7_AsyncControl::Key otherKey = LMS7_AsyncControl::MakeKey(LMS7_AsyncControl::OP_USER, false, 1);
+    future<int> other = control->Submit([&](LMS7_Device*){order.push_back(10); return 10;}, otherKey);
+    future<int> second = control->Submit([&](LMS7_Device*){order.push_back(2); return 2;}, key, count);
+    EXPECT_EQ(control->GetPendingCount(), 3u);
+    release = true;
+
+    //replaced request completes with result of the last one, which runs in its own place
+    EXPECT_EQ(first.get(), 2);
+    EXPECT_EQ(second.get(), 2);
+    EXPECT_EQ(other.get(), 10);
+    EXPECT_EQ(order, vector<int>({10, 2}));
+    EXPECT_EQ(callbacks, 2);
+}
+
+TEST_F(AsyncControlFixture, RequestIsNotReplacedAcrossBarrier)
+{
+    BlockWorker();
+    vector<int> order;
+    const LMS7_AsyncControl::Key key = LMS7_AsyncControl::MakeKey(LMS7_AsyncControl::OP_USER, false, 0);
+    future<int> first = control->Submit([&](LMS7_Device*){order.push_back(1); return 1;}, key);
+    control->Submit([&](LMS7_Device*){order.push_back(10); return 10;});
+    future<int> second = control->Submit([&](LMS7_Device*){order.push_back(2); return 2;}, key);
+    future<int> third = control->Submit([&](LMS7_Device*){order.push_back(3); return 3;}, key);
+    release = true;
+
+    //operation with key 0 may depend on settings queued before it
+    EXPECT_EQ(first.get(), 1);
+    EXPECT_EQ(second.get(), 3);
+    EXPECT_EQ(third.get(), 3);
+    EXPECT_EQ(order, vector<int>({1, 10, 3}));
+}
+
+TEST_F(AsyncControlFixture, ExceptionIsReportedAsError)
+{
+    string message;
+    future<int> result = control->Submit([](LMS7_Device*) -> int {
+            throw std::runtime_error("broken");
+        }, 0, [&](int status, const char* msg){ if (status != 0) message = msg;});
+    ASSERT_EQ(result.wait_for(chrono::seconds(1)), future_status::ready);
+    EXPECT_EQ(result.get(), EIO);
+    EXPECT_EQ(message, "Async operation failed: broken");
+    //worker keeps running
+    EXPECT_EQ(control->Submit([](LMS7_Device*){return 0;}).get(), 0);
+}
+
+TEST_F(AsyncControlFixture, CoalescingCanBeDisabled)
+{
+    control->SetCoalescing(false);
+    BlockWorker();
+    vector<int> order;
+    const LMS7_AsyncControl::Key key = LMS7_AsyncControl::MakeKey(LMS7_AsyncControl::OP_USER, true, 1);
+    control->Submit([&](LMS7_Device*){order.push_back(1); return 0;}, key);
+    control->Submit([&](LMS7_Device*){order.push_back(2); return 0;}, key);
+    release = true;
+    control->Wait();
+    EXPECT_EQ(order, vector<int>({1, 2}));
+}
+
+TEST_F(AsyncControlFixture, ErrorMessageIsPassedToCallback)
+{
+    string message;
+    future<int> result = control->Submit([](LMS7_Device*){
+            return lime::ReportError(EINVAL, "bad setting %d", 7);
+        }, 0, [&](int status, const char* msg){ if (status != 0) message = msg;});
+    EXPECT_EQ(result.get(), EINVAL);
+    EXPECT_EQ(message, "bad setting 7");
+}
+
+TEST_F(AsyncControlFixture, DestructionCompletesQueuedOperations)
+{
+    BlockWorker();
+    future<int> result = control->Submit([](LMS7_Device*){return 5;});
+    release = true;
+    device.reset();
+    ASSERT_EQ(result.wait_for(chrono::seconds(0)), future_status::ready);
+    EXPECT_EQ(result.get(), 5);
+}
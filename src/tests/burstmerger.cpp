@@ -0,0 +1,179 @@
+#include "gtest/gtest.h"
+#include "BurstMerger.h"
+#include <chrono>
+#include <thread>
+#include <vector>
+using namespace std;
+using namespace lime;
+
+static const uint32_t packetSize = 1020;
+
+static void SubmitBurst(BurstMerger &merger, uint64_t timestamp, uint32_t count)
+{
+    BurstMerger::Burst* burst = merger.Allocate(count, 1000);
+    ASSERT_NE(burst, nullptr);
+    for (uint32_t n = 0; n < count; ++n)
+    {
+        burst->samples[n].i = (timestamp+n) & 0x7FF;
+        burst->samples[n].q = 0;
+    }
+    merger.Submit(burst, timestamp);
+}
+
+struct Sent
+{
+    uint64_t timestamp;
+    uint32_t count;
+    bool endBurst;
+};
+
+static vector<Sent> ReadAll(BurstMerger &merger)
+{
+    vector<Sent> sent;
+    vector<complex16_t> samples(8*packetSize);
+    IStreamChannel::Metadata meta[8];
+    uint32_t counts[8];
+    while (true)
+    {
+        const uint32_t packets = merger.ReadPackets(samples.data(), packetSize, 8, meta, counts, 20);
+        if (packets == 0)
+            break;
+        for (uint32_t p = 0; p < packets; ++p)
+        {
+            EXPECT_TRUE(meta[p].flags & IStreamChannel::Metadata::SYNC_TIMESTAMP);
+            for (uint32_t n = 0; n < counts[p]; ++n)
+                EXPECT_EQ(samples[p*packetSize+n].i, int16_t((meta[p].timestamp+n) & 0x7FF));
+            //only the last packet of a read can be partial
+            if (counts[p] < packetSize)
+                EXPECT_EQ(p, packets-1);
+            Sent s = {meta[p].timestamp, counts[p], (meta[p].flags & IStreamChannel::Metadata::END_BURST) != 0};
+            sent.push_back(s);
+        }
+    }
+    return sent;
+}
+
+TEST(BurstMerger, ConcurrentProducersAreMergedInOrder)
+{
+    BurstMerger merger(1 << 22);
+    const int threadsCount = 8;
+    const int burstsPerThread = 50;
+    const uint32_t burstLength = 3000;
+    //threads interleave bursts in time, each submits in its own order
+    vector<thread> producers;
+    for (int t = 0; t < threadsCount; ++t)
+        producers.push_back(thread([&merger, t]()
+        {
+            for (int b = burstsPerThread-1; b >= 0; --b)
+                SubmitBurst(merger, uint64_t(b*threadsCount + t)*4000, burstLength);
+        }));
+    for (auto &producer : producers)
+        producer.join();
+
+    const vector<Sent> sent = ReadAll(merger);
+    uint64_t expected = 0;
+    uint32_t bursts = 0;
+    uint32_t inBurst = 0;
+    for (const Sent &s : sent)
+    {
+        EXPECT_EQ(s.timestamp, expected + inBurst);
+        inBurst += s.count;
+        if (s.endBurst)
+        {
+            EXPECT_EQ(inBurst, burstLength);
+            ++bursts;
+            expected += 4000;
+            inBurst = 0;
+        }
+    }
+    EXPECT_EQ(bursts, uint32_t(threadsCount*burstsPerThread));
+    EXPECT_EQ(merger.TakeOverlaps(), 0u);
+    EXPECT_EQ(merger.GetQueuedSamples(), 0u);
+}
+
+TEST(BurstMerger, OverlappingAndLateBurstsAreDropped)
+{
+    BurstMerger merger(1 << 20);
+    SubmitBurst(merger, 10000, 2000);
+    SubmitBurst(merger, 11000, 2000);   //overlaps the first one
+    SubmitBurst(merger, 12000, 500);
+    vector<Sent> sent = ReadAll(merger);
+    ASSERT_FALSE(sent.empty());
+    EXPECT_EQ(sent.front().timestamp, 10000u);
+    EXPECT_EQ(sent.back().timestamp, 12000u);
+    EXPECT_EQ(merger.TakeOverlaps(), 1u);
+
+    //burst before already sent samples is too late
+    SubmitBurst(merger, 5000, 100);
+    SubmitBurst(merger, 20000, 100);
+    sent = ReadAll(merger);
+    ASSERT_EQ(sent.size(), 1u);
+    EXPECT_EQ(sent[0].timestamp, 20000u);
+    EXPECT_EQ(merger.TakeOverlaps(), 1u);
+}
+
+TEST(BurstMerger, ProducerWaitsForSpace)
+{
+    BurstMerger merger(4000);
+    SubmitBurst(merger, 0, 3000);
+    EXPECT_EQ(merger.Allocate(2000, 10), nullptr);
+    thread consumer([&merger]() {ReadAll(merger);});
+    BurstMerger::Burst* burst = merger.Allocate(2000, 1000);
+    EXPECT_NE(burst, nullptr);
+    consumer.join();
+    if (burst)
+        merger.Discard(burst);
+    EXPECT_EQ(merger.GetQueuedSamples(), 0u);
+}
+
+TEST(BurstMerger, ClearKeepsBurstsSubmittedAfterIt)
+{
+    BurstMerger merger(1 << 20);
+    SubmitBurst(merger, 0, 4*packetSize);
+    //transmit thread is in the middle of a burst
+    vector<complex16_t> samples(packetSize);
+    IStreamChannel::Metadata meta;
+    uint32_t count;
+    ASSERT_EQ(merger.ReadPackets(samples.data(), packetSize, 1, &meta, &count, 20), 1u);
+    SubmitBurst(merger, 100000, 100);
+
+    merger.Clear();
+    SubmitBurst(merger, 50, 100);
+    vector<Sent> sent = ReadAll(merger);
+    ASSERT_EQ(sent.size(), 1u);
+    EXPECT_EQ(sent[0].timestamp, 50u);
+    EXPECT_EQ(merger.TakeOverlaps(), 0u);
+    EXPECT_EQ(merger.GetQueuedSamples(), 0u);
+}
+
+TEST(BurstMerger, SentBurstIsReused)
+{
+    BurstMerger merger(1 << 20);
+    BurstMerger::Burst* first = merger.Allocate(2*packetSize, 10);
+    ASSERT_NE(first, nullptr);
+    for (uint32_t n = 0; n < first->count; ++n)
+        first->samples[n] = {int16_t(n & 0x7FF), 0};
+    merger.Submit(first, 0);
+    ReadAll(merger);
+    BurstMerger::Burst* second = merger.Allocate(packetSize, 10);
+    EXPECT_EQ(second, first);
+    ASSERT_NE(second, nullptr);
+    EXPECT_EQ(second->samples.size(), packetSize);
+    merger.Discard(second);
+}
+
+TEST(BurstMerger, SubmitWakesTransmitThread)
+{
+    BurstMerger merger(1 << 20);
+    thread producer([&merger]() {
+        this_thread::sleep_for(chrono::milliseconds(20));
+        SubmitBurst(merger, 0, packetSize);
+    });
+    vector<complex16_t> samples(packetSize);
+    IStreamChannel::Metadata meta;
+    uint32_t count;
+    const auto start = chrono::steady_clock::now();
+    EXPECT_EQ(merger.ReadPackets(samples.data(), packetSize, 1, &meta, &count, 5000), 1u);
+    EXPECT_LT(chrono::steady_clock::now() - start, chrono::seconds(1));
+    producer.join();
+}
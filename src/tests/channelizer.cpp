@@ -0,0 +1,130 @@
+#include "gtest/gtest.h"
+#include "Channelizer.h"
+#include <cmath>
+#include <thread>
+#include <vector>
+using namespace std;
+using namespace lime;
+
+//wideband source with two tones, timestamps follow sample count
+class TwoTones
+{
+public:
+    TwoTones(double f1, double a1, double f2, double a2) : f1(f1), a1(a1), f2(f2), a2(a2), time(0) {}
+
+    uint32_t operator()(complex16_t* dest, uint32_t count, uint64_t* timestamp, int32_t)
+    {
+        *timestamp = time;
+        for (uint32_t k = 0; k < count; ++k, ++time)
+        {
+            dest[k].i = lround(a1*cos(2*M_PI*f1*time) + a2*cos(2*M_PI*f2*time));
+            dest[k].q = lround(a1*sin(2*M_PI*f1*time) + a2*sin(2*M_PI*f2*time));
+        }
+        return count;
+    }
+private:
+    double f1, a1, f2, a2;
+    uint64_t time;
+};
+
+static Channelizer::Output* CreateOutput(double frequency, uint32_t decimation)
+{
+    StreamConfig config;
+    config.isTx = false;
+    config.format = StreamConfig::STREAM_12_BIT_IN_16;
+    config.resampling.interpolation = 1;
+    config.resampling.decimation = decimation;
+    config.resampling.taps = 16;
+    config.resampling.passband = 0.8f;
+    config.resampling.stopband = 1.0f;
+    return new Channelizer::Output(nullptr, config, frequency);
+}
+
+static vector<complex16_t> ReadSamples(Channelizer::Output* output, size_t count, uint64_t* timestamp)
+{
+    vector<complex16_t> samples(count);
+    size_t received = 0;
+    bool first = true;
+    while (received < count)
+    {
+        ILimeSDRStreaming::StreamChannel::Metadata meta;
+        const int ret = output->Read(&samples[received], count-received, &meta, 1000);
+        if (ret <= 0)
+            break;
+        if (first)
+            *timestamp = meta.timestamp;
+        first = false;
+        received += ret;
+    }
+    samples.resize(received);
+    return samples;
+}
+
+static double Amplitude(const vector<complex16_t> &samples, size_t from)
+{
+    double i = 0, q = 0;
+    for (size_t n = from; n < samples.size(); ++n)
+    {
+        i += samples[n].i;
+        q += samples[n].q;
+    }
+    return sqrt(i*i + q*q)/(samples.size()-from);
+}
+
+TEST(Channelizer, OutputsSelectTheirChannels)
+{
+    TwoTones source(0.2, 2000, -0.1, 1000);
+    Channelizer channelizer(ref(source), 2);
+    Channelizer::Output* first = CreateOutput(0.2, 8);
+    Channelizer::Output* second = CreateOutput(-0.1, 8);
+    Channelizer::Output* empty = CreateOutput(0.35, 8);
+    ASSERT_EQ(channelizer.AddOutput(first), 0);
+    ASSERT_EQ(channelizer.AddOutput(second), 0);
+    ASSERT_EQ(channelizer.AddOutput(empty), 0);
+    first->Start();
+    second->Start();
+    empty->Start();
+    ASSERT_EQ(channelizer.Start(), 0);
+    EXPECT_NE(channelizer.AddOutput(CreateOutput(0, 2)), 0);
+
+    //tone at channel center becomes constant, other tone is filtered out
+    uint64_t t1 = 0, t2 = 0, t3 = 0;
+    const vector<complex16_t> out1 = ReadSamples(first, 4096, &t1);
+    const vector<complex16_t> out2 = ReadSamples(second, 4096, &t2);
+    const vector<complex16_t> out3 = ReadSamples(empty, 4096, &t3);
+    channelizer.Stop();
+    ASSERT_EQ(out1.size(), 4096u);
+    ASSERT_EQ(out2.size(), 4096u);
+    ASSERT_EQ(out3.size(), 4096u);
+    EXPECT_NEAR(Amplitude(out1, 100), 2000, 2000*0.02);
+    EXPECT_NEAR(Amplitude(out2, 100), 1000, 1000*0.02);
+    EXPECT_LT(Amplitude(out3, 100), 2000*0.03);
+}
+
+TEST(Channelizer, TimestampsAdvanceWithWidebandClock)
+{
+    TwoTones source(0.05, 1000, 0, 0);
+    Channelizer channelizer(ref(source));
+    Channelizer::Output* output = CreateOutput(0.05, 4);
+    ASSERT_EQ(channelizer.AddOutput(output), 0);
+    output->Start();
+    ASSERT_EQ(channelizer.Start(), 0);
+    uint64_t previous = 0;
+    ReadSamples(output, 1000, &previous);
+    for (int i = 0; i < 5; ++i)
+    {
+        uint64_t timestamp = 0;
+        ASSERT_EQ(ReadSamples(output, 1000, &timestamp).size(), 1000u);
+        //1000 decimated samples are 4000 wideband samples
+        EXPECT_NEAR(double(timestamp), double(previous + 4000), 1.0);
+        previous = timestamp;
+    }
+    channelizer.Stop();
+}
+
+TEST(Channelizer, ChannelOutsideBandIsRejected)
+{
+    Channelizer channelizer(TwoTones(0, 0, 0, 0));
+    EXPECT_NE(channelizer.AddOutput(CreateOutput(0.6, 4)), 0);
+    EXPECT_EQ(channelizer.AddOutput(CreateOutput(-0.5, 4)), 0);
+}
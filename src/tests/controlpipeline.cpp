@@ -0,0 +1,201 @@
+#include "gtest/gtest.h"
+#include "LMS64CProtocol.h"
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+using namespace std;
+using namespace lime;
+
+//firmware imitation answering queued control packets in order
+class FakeControlPort : public LMS64CProtocol
+{
+public:
+    FakeControlPort() : writes(0), maxQueued(0), corruptNext(false), lateResponses(0) {}
+
+    bool IsOpen(void) override {return true;}
+    eConnectionType GetType(void) override {return USB_PORT;}
+
+    int Write(const unsigned char *buffer, int length, int) override
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        queue.push_back(vector<unsigned char>(buffer, buffer+length));
+        ++writes;
+        maxQueued = max(maxQueued, queue.size());
+        queued.notify_all();
+        return length;
+    }
+
+    int Read(unsigned char *buffer, int length, int timeout_ms) override
+    {
+        std::unique_lock<std::mutex> lock(mLock);
+        if (not queued.wait_for(lock, chrono::milliseconds(timeout_ms), [this]{return not queue.empty();}))
+            return 0;
+        //response stays queued and arrives after read timed out
+        if (lateResponses > 0)
+        {
+            --lateResponses;
+            return 0;
+        }
+        const vector<unsigned char> request = queue.front();
+        queue.pop_front();
+        memset(buffer, 0, length);
+        buffer[0] = corruptNext ? CMD_GET_INFO : request[0];
+        buffer[1] = STATUS_COMPLETED_CMD;
+        buffer[2] = request[2];
+        corruptNext = false;
+        const unsigned char* data = &request[8];
+        for (int b = 0; b < request[2]; ++b)
+        {
+            if (request[0] == CMD_LMS7002_WR)
+                regs[(data[4*b] << 8) | data[4*b+1]] = (data[4*b+2] << 8) | data[4*b+3];
+            else if (request[0] == CMD_LMS7002_RD)
+            {
+                const uint16_t value = regs[(data[2*b] << 8) | data[2*b+1]];
+                buffer[8+4*b] = data[2*b];
+                buffer[8+4*b+1] = data[2*b+1];
+                buffer[8+4*b+2] = value >> 8;
+                buffer[8+4*b+3] = value & 0xFF;
+            }
+        }
+        return length;
+    }
+
+    std::mutex mLock;
+    std::condition_variable queued;
+    deque<vector<unsigned char>> queue;
+    map<uint16_t, uint16_t> regs;
+    int writes;
+    size_t maxQueued;
+    bool corruptNext;
+    int lateResponses;
+};
+
+static vector<uint32_t> WriteWords(uint16_t first, size_t count, uint16_t seed)
+{
+    vector<uint32_t> words;
+    for (size_t i = 0; i < count; ++i)
+        words.push_back((uint32_t(first+i) << 16) | uint16_t(seed+i*3));
+    return words;
+}
+
+TEST(ControlPipeline, SynchronousByDefault)
+{
+    FakeControlPort port;
+    const vector<uint32_t> words = WriteWords(0x0100, 40, 7);
+    ASSERT_EQ(port.WriteLMS7002MSPI(words.data(), words.size()), 0);
+    EXPECT_EQ(port.writes, 3);
+    EXPECT_EQ(port.maxQueued, 1u);
+}
+
+TEST(ControlPipeline, MultiPacketTransferKeepsPacketsInFlight)
+{
+    FakeControlPort port;
+    port.SetControlPipelineDepth(4);
+    const vector<uint32_t> words = WriteWords(0x0100, 14*6, 11);
+    ASSERT_EQ(port.WriteLMS7002MSPI(words.data(), words.size()), 0);
+    EXPECT_EQ(port.writes, 6);
+    EXPECT_EQ(port.maxQueued, 4u);
+
+    vector<uint32_t> addrs;
+    for (auto w : words)
+        addrs.push_back(w & 0xFFFF0000);
+    vector<uint32_t> values(addrs.size(), 0);
+    ASSERT_EQ(port.ReadLMS7002MSPI(addrs.data(), values.data(), addrs.size()), 0);
+    for (size_t i = 0; i < words.size(); ++i)
+        EXPECT_EQ(values[i], words[i] & 0xFFFF);
+}
+
+TEST(ControlPipeline, SubmittedPacketsCompleteInAnyOrder)
+{
+    FakeControlPort port;
+    port.SetControlPipelineDepth(8);
+    LMS64CProtocol::GenericPacket writePkt;
+    writePkt.cmd = CMD_LMS7002_WR;
+    writePkt.outBuffer = {0x01, 0x23, 0xAB, 0xCD};
+    LMS64CProtocol::GenericPacket readPkt;
+    readPkt.cmd = CMD_LMS7002_RD;
+    readPkt.outBuffer = {0x01, 0x23};
+
+    LMS64CProtocol::ControlTransfer writeTransfer, readTransfer;
+    ASSERT_EQ(port.SubmitPacket(writePkt, writeTransfer), 0);
+    ASSERT_EQ(port.SubmitPacket(readPkt, readTransfer), 0);
+    EXPECT_FALSE(writeTransfer.finished);
+    EXPECT_EQ(port.maxQueued, 2u);
+
+    //completing later packet collects responses of earlier ones
+    ASSERT_EQ(port.CompletePacket(readTransfer), 0);
+    ASSERT_EQ(readPkt.inBuffer.size(), 56u);
+    EXPECT_EQ(readPkt.inBuffer[2], 0xAB);
+    EXPECT_EQ(readPkt.inBuffer[3], 0xCD);
+    EXPECT_EQ(port.CompletePacket(writeTransfer), 0);
+    EXPECT_EQ(writePkt.status, STATUS_COMPLETED_CMD);
+}
+
+TEST(ControlPipeline, ConcurrentThreadsGetOwnResponses)
+{
+    FakeControlPort port;
+    port.SetControlPipelineDepth(4);
+    const int threadsCount = 4;
+    vector<int> failures(threadsCount, 0);
+    vector<thread> threads;
+    for (int t = 0; t < threadsCount; ++t)
+        threads.push_back(thread([&port, &failures, t]{
+            const uint16_t first = 0x0100*(t+1);
+            for (int iter = 0; iter < 50; ++iter)
+            {
+                const vector<uint32_t> words = WriteWords(first, 20, t*1000+iter);
+                if (port.WriteLMS7002MSPI(words.data(), words.size()) != 0)
+                    ++failures[t];
+                vector<uint32_t> addrs;
+                for (auto w : words)
+                    addrs.push_back(w & 0xFFFF0000);
+                vector<uint32_t> values(addrs.size(), 0);
+                if (port.ReadLMS7002MSPI(addrs.data(), values.data(), addrs.size()) != 0)
+                    ++failures[t];
+                for (size_t i = 0; i < words.size(); ++i)
+                    if (values[i] != (words[i] & 0xFFFF))
+                        ++failures[t];
+            }
+        }));
+    for (auto &t : threads)
+        t.join();
+    for (int t = 0; t < threadsCount; ++t)
+        EXPECT_EQ(failures[t], 0);
+    EXPECT_LE(port.maxQueued, 4u);
+}
+
+TEST(ControlPipeline, MismatchedResponseIsError)
+{
+    FakeControlPort port;
+    port.SetControlPipelineDepth(2);
+    port.corruptNext = true;
+    const vector<uint32_t> words = WriteWords(0x0100, 4, 1);
+    EXPECT_NE(port.WriteLMS7002MSPI(words.data(), words.size()), 0);
+    //pipeline stays usable for following transfers
+    EXPECT_EQ(port.WriteLMS7002MSPI(words.data(), words.size()), 0);
+}
+
+TEST(ControlPipeline, LateResponseIsDiscarded)
+{
+    FakeControlPort port;
+    port.SetControlPipelineDepth(4);
+    port.lateResponses = 1;
+    const vector<uint32_t> words = WriteWords(0x0100, 14*3, 5);
+    EXPECT_NE(port.WriteLMS7002MSPI(words.data(), words.size()), 0);
+
+    //responses of following transfers are matched to their own requests
+    ASSERT_EQ(port.WriteLMS7002MSPI(words.data(), words.size()), 0);
+    vector<uint32_t> addrs;
+    for (auto w : words)
+        addrs.push_back(w & 0xFFFF0000);
+    vector<uint32_t> values(addrs.size(), 0);
+    ASSERT_EQ(port.ReadLMS7002MSPI(addrs.data(), values.data(), addrs.size()), 0);
+    for (size_t i = 0; i < words.size(); ++i)
+        EXPECT_EQ(values[i], words[i] & 0xFFFF);
+    EXPECT_TRUE(port.queue.empty());
+}
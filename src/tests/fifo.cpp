@@ -0,0 +1,195 @@
+#include "gtest/gtest.h"
+#include "fifo.h"
+#include <thread>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+using namespace std;
+using namespace lime;
+
+static void FillPacket(complex16_t* dest, int count, int16_t first)
+{
+    for (int i = 0; i < count; ++i)
+    {
+        dest[i].i = first + i;
+        dest[i].q = -(first + i);
+    }
+}
+
+TEST(RingFIFO, pushPop)
+{
+    RingFIFO fifo(64*SamplesPacket::maxSamplesInPacket);
+    vector<complex16_t> src(1000);
+    FillPacket(src.data(), src.size(), 0);
+    ASSERT_EQ(fifo.push_samples(src.data(), src.size(), 1, 100, 100), src.size());
+
+    vector<complex16_t> dest(src.size());
+    uint64_t timestamp = 0;
+    ASSERT_EQ(fifo.pop_samples(dest.data(), dest.size(), 1, &timestamp, 100), dest.size());
+    EXPECT_EQ(timestamp, 100u);
+    for (size_t i = 0; i < dest.size(); ++i)
+        ASSERT_EQ(dest[i].i, src[i].i);
+}
+
+TEST(RingFIFO, directReadWhenReaderWaiting)
+{
+    const int packetSize = 1020;
+    const int packetsCount = 8;
+    RingFIFO fifo(64*SamplesPacket::maxSamplesInPacket);
+    vector<complex16_t> dest(packetSize*packetsCount);
+    uint64_t timestamp = 0;
+    int popped = 0;
+    thread reader([&]()
+    {
+        popped = fifo.pop_samples(dest.data(), dest.size(), 1, &timestamp, 1000);
+    });
+
+    int directPackets = 0;
+    vector<complex16_t> scratch(packetSize);
+    for (int p = 0; p < packetsCount; ++p)
+    {
+        const uint64_t ts = 500 + p*packetSize;
+        complex16_t* buf = nullptr;
+        //give reader time to block on empty FIFO
+        for (int retry = 0; retry < 100 && buf == nullptr; ++retry)
+        {
+            buf = fifo.AcquireDirect(packetSize, ts);
+            if (buf == nullptr)
+                this_thread::sleep_for(chrono::milliseconds(1));
+        }
+        if (buf)
+        {
+            FillPacket(buf, packetSize, p*packetSize);
+            fifo.CommitDirect(packetSize);
+            ++directPackets;
+        }
+        else
+        {
+            FillPacket(scratch.data(), packetSize, p*packetSize);
+            fifo.push_samples(scratch.data(), packetSize, 1, ts, 100);
+        }
+    }
+    reader.join();
+
+    EXPECT_EQ(directPackets, packetsCount);
+    ASSERT_EQ(popped, (int)dest.size());
+    EXPECT_EQ(timestamp, 500u);
+    for (size_t i = 0; i < dest.size(); ++i)
+        ASSERT_EQ(dest[i].i, (int16_t)i);
+    EXPECT_EQ(fifo.GetInfo().itemsFilled, 0u);
+}
+
+TEST(RingFIFO, directReadNotUsedWithoutReader)
+{
+    RingFIFO fifo(64*SamplesPacket::maxSamplesInPacket);
+    EXPECT_EQ(fifo.AcquireDirect(100, 0), nullptr);
+}
+
+TEST(RingFIFO, directReadStopsAtEndOfBurst)
+{
+    const int packetSize = 1020;
+    RingFIFO fifo(64*SamplesPacket::maxSamplesInPacket);
+    vector<complex16_t> dest(packetSize*4);
+    uint32_t flags = 0;
+    int popped = 0;
+    thread reader([&]()
+    {
+        uint64_t timestamp;
+        popped = fifo.pop_samples(dest.data(), dest.size(), 1, &timestamp, 1000, &flags);
+    });
+    complex16_t* buf = nullptr;
+    for (int retry = 0; retry < 100 && buf == nullptr; ++retry)
+    {
+        buf = fifo.AcquireDirect(packetSize, 0);
+        if (buf == nullptr)
+            this_thread::sleep_for(chrono::milliseconds(1));
+    }
+    ASSERT_NE(buf, nullptr);
+    FillPacket(buf, packetSize, 0);
+    fifo.CommitDirect(packetSize, IStreamChannel::Metadata::END_BURST);
+    reader.join();
+    EXPECT_EQ(popped, packetSize);
+    EXPECT_TRUE(flags & IStreamChannel::Metadata::END_BURST);
+}
+
+TEST(RingFIFO, concurrentReadersGetOwnSamples)
+{
+    const int packetSize = 1020;
+    const int packetsCount = 64;
+    RingFIFO fifo(128*SamplesPacket::maxSamplesInPacket);
+    vector<int16_t> received[2];
+    thread readers[2];
+    for (int r = 0; r < 2; ++r)
+        readers[r] = thread([&fifo, &received, r]()
+        {
+            vector<complex16_t> dest(packetSize);
+            uint64_t timestamp;
+            int popped;
+            while ((popped = fifo.pop_samples(dest.data(), dest.size(), 1, &timestamp, 200)) > 0)
+                for (int i = 0; i < popped; ++i)
+                    received[r].push_back(dest[i].i);
+        });
+
+    vector<complex16_t> scratch(packetSize);
+    for (int p = 0; p < packetsCount; ++p)
+    {
+        complex16_t* buf = fifo.AcquireDirect(packetSize, p*packetSize);
+        if (buf)
+        {
+            FillPacket(buf, packetSize, p*packetSize);
+            fifo.CommitDirect(packetSize);
+        }
+        else
+        {
+            FillPacket(scratch.data(), packetSize, p*packetSize);
+            fifo.push_samples(scratch.data(), packetSize, 1, p*packetSize, 100);
+        }
+        this_thread::sleep_for(chrono::microseconds(200));
+    }
+    for (auto &reader : readers)
+        reader.join();
+
+    //every sample is delivered once, in order for each reader
+    vector<int16_t> all;
+    for (auto &samples : received)
+    {
+        for (size_t i = 1; i < samples.size(); ++i)
+            ASSERT_GT((int16_t)(samples[i]-samples[i-1]), 0);
+        all.insert(all.end(), samples.begin(), samples.end());
+    }
+    ASSERT_EQ(all.size(), size_t(packetSize*packetsCount));
+    sort(all.begin(), all.end(), [](int16_t a, int16_t b){return uint16_t(a) < uint16_t(b);});
+    for (size_t i = 0; i < all.size(); ++i)
+        ASSERT_EQ(all[i], (int16_t)i);
+}
+
+TEST(RingFIFO, popPacketsStopsAtEndOfBurst)
+{
+    const int packetSize = 680;
+    RingFIFO fifo(64*SamplesPacket::maxSamplesInPacket);
+    vector<complex16_t> src(packetSize*3 + 100);
+    FillPacket(src.data(), src.size(), 0);
+    fifo.push_samples(src.data(), src.size(), 1, 1000, 100, IStreamChannel::Metadata::SYNC_TIMESTAMP | IStreamChannel::Metadata::END_BURST);
+    fifo.push_samples(src.data(), packetSize, 1, 9000, 100);
+
+    const int packetsCount = 8;
+    vector<complex16_t> dest(packetSize*packetsCount);
+    IStreamChannel::Metadata meta[packetsCount];
+    uint32_t counts[packetsCount];
+    ASSERT_EQ(fifo.pop_packets(dest.data(), packetSize, packetsCount, meta, counts, 100), 4u);
+    for (int p = 0; p < 3; ++p)
+    {
+        EXPECT_EQ(counts[p], (uint32_t)packetSize);
+        EXPECT_EQ(meta[p].timestamp, 1000u + p*packetSize);
+        EXPECT_TRUE(meta[p].flags & IStreamChannel::Metadata::SYNC_TIMESTAMP);
+    }
+    EXPECT_EQ(counts[3], 100u);
+    EXPECT_TRUE(meta[3].flags & IStreamChannel::Metadata::END_BURST);
+    for (size_t i = 0; i < src.size(); ++i)
+        ASSERT_EQ(dest[i].i, src[i].i);
+
+    //next burst stays in FIFO, timeout ends the incomplete packet
+    ASSERT_EQ(fifo.pop_packets(dest.data(), packetSize, packetsCount, meta, counts, 10), 1u);
+    EXPECT_EQ(meta[0].timestamp, 9000u);
+    EXPECT_EQ(counts[0], (uint32_t)packetSize);
+}
@@ -0,0 +1,75 @@
+#include "gtest/gtest.h"
+#include "IQCorrector.h"
+#include <cmath>
+#include <vector>
+using namespace std;
+using namespace lime;
+
+static IQCorrection Imbalanced()
+{
+    IQCorrection corr;
+    corr.dcI = 12.5f;
+    corr.dcQ = -7.25f;
+    corr.matrix[0][0] = 1.0f;
+    corr.matrix[0][1] = 0.0f;
+    corr.matrix[1][0] = -0.05f;
+    corr.matrix[1][1] = 1.03f;
+    return corr;
+}
+
+TEST(IQCorrector, DefaultIsIdentity)
+{
+    vector<complex16_t> samples(37);
+    for (size_t n = 0; n < samples.size(); ++n)
+    {
+        samples[n].i = n*100-1800;
+        samples[n].q = 1700-n*93;
+    }
+    const vector<complex16_t> original = samples;
+    IQCorrector(IQCorrection()).Apply(samples.data(), samples.size());
+    for (size_t n = 0; n < samples.size(); ++n)
+    {
+        EXPECT_EQ(samples[n].i, original[n].i);
+        EXPECT_EQ(samples[n].q, original[n].q);
+    }
+}
+
+TEST(IQCorrector, MatchesReferenceFormula)
+{
+    const IQCorrection corr = Imbalanced();
+    //odd count exercises vector and scalar paths
+    vector<complex16_t> samples(1001);
+    for (size_t n = 0; n < samples.size(); ++n)
+    {
+        samples[n].i = lround(2000*cos(0.01*n));
+        samples[n].q = lround(1500*sin(0.013*n));
+    }
+    const vector<complex16_t> original = samples;
+    IQCorrector(corr).Apply(samples.data(), samples.size());
+    for (size_t n = 0; n < samples.size(); ++n)
+    {
+        const double i = original[n].i - corr.dcI;
+        const double q = original[n].q - corr.dcQ;
+        EXPECT_NEAR(samples[n].i, corr.matrix[0][0]*i + corr.matrix[0][1]*q, 1.0);
+        EXPECT_NEAR(samples[n].q, corr.matrix[1][0]*i + corr.matrix[1][1]*q, 1.0);
+    }
+}
+
+TEST(IQCorrector, OutputSaturates)
+{
+    IQCorrection corr;
+    corr.matrix[0][0] = 2.0f;
+    corr.matrix[1][1] = 2.0f;
+    vector<complex16_t> samples(8);
+    for (size_t n = 0; n < samples.size(); ++n)
+    {
+        samples[n].i = 30000;
+        samples[n].q = -30000;
+    }
+    IQCorrector(corr).Apply(samples.data(), samples.size());
+    for (size_t n = 0; n < samples.size(); ++n)
+    {
+        EXPECT_EQ(samples[n].i, 32767);
+        EXPECT_EQ(samples[n].q, -32768);
+    }
+}
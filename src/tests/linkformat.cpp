@@ -0,0 +1,153 @@
+#include "gtest/gtest.h"
+#include "ILimeSDRStreaming.h"
+#include "dataTypes.h"
+#include <chrono>
+#include <functional>
+#include <map>
+#include <thread>
+#include <vector>
+using namespace std;
+using namespace lime;
+
+//board imitation receiving constant 12 bit samples on channel A
+class FakeLinkBoard : public ILimeSDRStreaming
+{
+public:
+    FakeLinkBoard()
+    {
+        RxLoopFunction = bind(&FakeLinkBoard::ReceivePacketsLoop, this, std::placeholders::_1);
+        TxLoopFunction = bind(&FakeLinkBoard::TransmitPacketsLoop, this, std::placeholders::_1);
+    }
+    ~FakeLinkBoard()
+    {
+        for (auto s : mStreamers)
+            s->UpdateThreads(true);
+    }
+
+    bool IsOpen(void) override {return true;}
+
+    int TransferPacket(GenericPacket &pkt) override
+    {
+        std::lock_guard<std::mutex> lock(regsLock);
+        auto &regs = (pkt.cmd == CMD_BRDSPI_WR || pkt.cmd == CMD_BRDSPI_RD) ? fpgaRegs : chipRegs;
+        pkt.inBuffer.clear();
+        if (pkt.cmd == CMD_BRDSPI_WR || pkt.cmd == CMD_LMS7002_WR)
+            for (size_t i = 0; i+3 < pkt.outBuffer.size(); i += 4)
+                regs[(pkt.outBuffer[i] << 8) | pkt.outBuffer[i+1]] = (pkt.outBuffer[i+2] << 8) | pkt.outBuffer[i+3];
+        else if (pkt.cmd == CMD_BRDSPI_RD || pkt.cmd == CMD_LMS7002_RD)
+            for (size_t i = 0; i+1 < pkt.outBuffer.size(); i += 2)
+            {
+                const uint16_t value = regs[(pkt.outBuffer[i] << 8) | pkt.outBuffer[i+1]];
+                pkt.inBuffer.push_back(pkt.outBuffer[i]);
+                pkt.inBuffer.push_back(pkt.outBuffer[i+1]);
+                pkt.inBuffer.push_back(value >> 8);
+                pkt.inBuffer.push_back(value & 0xFF);
+            }
+        pkt.status = STATUS_COMPLETED_CMD;
+        return 0;
+    }
+
+    int Write(const unsigned char *, int, int) override {return -1;}
+    int Read(unsigned char *, int, int) override {return -1;}
+    int UpdateExternalDataRate(const size_t, const double, const double) override {return 0;}
+    eConnectionType GetType(void) override {return CONNECTION_UNDEFINED;}
+
+    //! Value of I samples, Q is negated
+    static const int16_t sampleValue = 256;
+
+    std::mutex regsLock;
+    std::map<uint16_t, uint16_t> fpgaRegs;
+    std::map<uint16_t, uint16_t> chipRegs;
+
+protected:
+    void ReceivePacketsLoop(Streamer* stream) override
+    {
+        const bool packed = stream->mRxStreams[0]->config.linkFormat == StreamConfig::STREAM_12_BIT_COMPRESSED;
+        const int samplesInPacket = (packed ? samples12InPkt : samples16InPkt)/stream->streamSize;
+        StreamChannel::Frame scratch;
+        uint64_t counter = 0;
+        while (not stream->terminateRx.load())
+        {
+            {
+                std::lock_guard<std::mutex> streamsLock(stream->rxStreamsLock);
+                StreamChannel* receiving = stream->mRxStreams[0];
+                if (receiving && receiving->IsReceiving())
+                {
+                    //samples as decoded from link packet
+                    complex16_t* dest = receiving->AcquirePacketBuffer(scratch, samplesInPacket, counter);
+                    for (int i = 0; i < samplesInPacket; ++i)
+                    {
+                        dest[i].i = packed ? sampleValue : sampleValue << 4;
+                        dest[i].q = -dest[i].i;
+                    }
+                    IStreamChannel::Metadata meta;
+                    meta.timestamp = counter;
+                    meta.flags = IStreamChannel::Metadata::OVERWRITE_OLD;
+                    receiving->CommitPacketBuffer(samplesInPacket, &meta, 100);
+                }
+            }
+            counter += samplesInPacket;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    void TransmitPacketsLoop(Streamer*) override {}
+};
+
+static StreamConfig RxConfig(StreamConfig::StreamDataFormat format)
+{
+    StreamConfig config;
+    config.isTx = false;
+    config.channelID = 0;
+    config.format = format;
+    return config;
+}
+
+static void ExpectInt8Samples(FakeLinkBoard &board, const size_t streamId, const int8_t expected)
+{
+    vector<int8_t> samples(2*1000);
+    StreamMetadata meta;
+    ASSERT_EQ(board.ReadStream(streamId, samples.data(), samples.size()/2, 1000, meta), int(samples.size()/2));
+    EXPECT_EQ(samples[0], expected);
+    EXPECT_EQ(samples[1], -expected);
+}
+
+TEST(LinkFormat, Int8TapOnCompressedLink)
+{
+    FakeLinkBoard board;
+    size_t owner = 0;
+    ASSERT_EQ(board.SetupStream(owner, RxConfig(StreamConfig::STREAM_12_BIT_COMPRESSED)), 0);
+    size_t tap = 0;
+    ASSERT_EQ(board.SetupStream(tap, RxConfig(StreamConfig::STREAM_COMPLEX_INT8)), 0);
+    ASSERT_EQ(board.ControlStream(owner, true), 0);
+    ASSERT_EQ(board.ControlStream(tap, true), 0);
+    //default int8 shift keeps 8 most significant of 12 bits
+    ExpectInt8Samples(board, tap, FakeLinkBoard::sampleValue >> 4);
+
+    //tap set up while streaming follows configured link
+    size_t late = 0;
+    ASSERT_EQ(board.SetupStream(late, RxConfig(StreamConfig::STREAM_COMPLEX_INT8)), 0);
+    ASSERT_EQ(board.ControlStream(late, true), 0);
+    ExpectInt8Samples(board, late, FakeLinkBoard::sampleValue >> 4);
+
+    EXPECT_EQ(board.CloseStream(late), 0);
+    EXPECT_EQ(board.CloseStream(tap), 0);
+    EXPECT_EQ(board.CloseStream(owner), 0);
+}
+
+TEST(LinkFormat, Int8SubStreamOnCompressedLink)
+{
+    FakeLinkBoard board;
+    size_t wideband = 0;
+    ASSERT_EQ(board.SetupStream(wideband, RxConfig(StreamConfig::STREAM_12_BIT_COMPRESSED)), 0);
+    size_t sub = 0;
+    ASSERT_EQ(board.SetupSubStream(sub, wideband, 0, RxConfig(StreamConfig::STREAM_COMPLEX_INT8)), 0);
+    ASSERT_EQ(board.ControlStream(sub, true), 0);
+    ASSERT_EQ(board.ControlStream(wideband, true), 0);
+    //outputs convert with link format resolved when streaming starts
+    ExpectInt8Samples(board, sub, FakeLinkBoard::sampleValue >> 4);
+
+    EXPECT_EQ(board.ControlStream(wideband, false), 0);
+    EXPECT_EQ(board.CloseStream(sub), 0);
+    EXPECT_EQ(board.CloseStream(wideband), 0);
+}
@@ -0,0 +1,107 @@
+#include "gtest/gtest.h"
+#include "PacketFanout.h"
+#include <vector>
+using namespace std;
+using namespace lime;
+
+static const uint32_t packetSize = 1360;
+
+static void Produce(PacketFanout &fanout, uint64_t timestamp, uint32_t flags = 0)
+{
+    complex16_t* dest = fanout.Acquire(packetSize, timestamp);
+    ASSERT_NE(dest, nullptr);
+    for (uint32_t n = 0; n < packetSize; ++n)
+    {
+        dest[n].i = (timestamp+n) & 0x7FFF;
+        dest[n].q = -dest[n].i;
+    }
+    fanout.Commit(packetSize, flags);
+}
+
+TEST(PacketFanout, ConsumersReadIndependently)
+{
+    shared_ptr<PacketFanout> fanout = make_shared<PacketFanout>();
+    PacketFanout::Consumer fast(fanout, 64);
+    PacketFanout::Consumer slow(fanout, 64);
+    fast.SetActive(true);
+    slow.SetActive(true);
+    for (int p = 0; p < 10; ++p)
+        Produce(*fanout, p*packetSize);
+
+    //fast consumer reads everything in odd sized chunks
+    vector<complex16_t> samples(1000);
+    uint64_t expected = 0;
+    for (int r = 0; r < 13; ++r)
+    {
+        uint64_t timestamp = 0;
+        const uint32_t cnt = fast.Pop(samples.data(), samples.size(), &timestamp, 100, nullptr);
+        ASSERT_EQ(cnt, 1000u);
+        EXPECT_EQ(timestamp, expected);
+        for (uint32_t n = 0; n < cnt; ++n)
+            ASSERT_EQ(samples[n].i, int16_t((expected+n) & 0x7FFF));
+        expected += cnt;
+    }
+    //slow consumer still starts from the beginning
+    uint64_t timestamp = 1;
+    EXPECT_EQ(slow.Pop(samples.data(), 100, &timestamp, 100, nullptr), 100u);
+    EXPECT_EQ(timestamp, 0u);
+    EXPECT_EQ(slow.GetQueuedSamples(), 10*packetSize-100);
+}
+
+TEST(PacketFanout, SlowConsumerOverflowsAlone)
+{
+    shared_ptr<PacketFanout> fanout = make_shared<PacketFanout>();
+    PacketFanout::Consumer fast(fanout, 8);
+    PacketFanout::Consumer slow(fanout, 4);
+    fast.SetActive(true);
+    slow.SetActive(true);
+    vector<complex16_t> samples(packetSize);
+    for (int p = 0; p < 100; ++p)
+    {
+        Produce(*fanout, p*packetSize);
+        uint64_t timestamp = 0;
+        ASSERT_EQ(fast.Pop(samples.data(), packetSize, &timestamp, 100, nullptr), packetSize);
+        EXPECT_EQ(timestamp, p*packetSize);
+    }
+    EXPECT_EQ(fast.TakeOverflows(), 0u);
+    EXPECT_EQ(slow.TakeOverflows(), 96u);
+    //slow consumer keeps the newest packets
+    uint64_t timestamp = 0;
+    slow.Pop(samples.data(), packetSize, &timestamp, 100, nullptr);
+    EXPECT_EQ(timestamp, 96*packetSize);
+}
+
+TEST(PacketFanout, InactiveConsumerGetsNothing)
+{
+    shared_ptr<PacketFanout> fanout = make_shared<PacketFanout>();
+    PacketFanout::Consumer active(fanout, 4);
+    PacketFanout::Consumer idle(fanout, 4);
+    active.SetActive(true);
+    vector<complex16_t> samples(packetSize);
+    //buffers return to pool after the only reader is done
+    for (int p = 0; p < 50; ++p)
+    {
+        Produce(*fanout, p*packetSize);
+        ASSERT_EQ(active.Pop(samples.data(), packetSize, nullptr, 100, nullptr), packetSize);
+    }
+    EXPECT_EQ(idle.GetQueuedSamples(), 0u);
+    EXPECT_EQ(idle.Pop(samples.data(), packetSize, nullptr, 10, nullptr), 0u);
+}
+
+TEST(PacketFanout, ReadStopsAtEndOfBurst)
+{
+    shared_ptr<PacketFanout> fanout = make_shared<PacketFanout>();
+    PacketFanout::Consumer consumer(fanout, 8);
+    consumer.SetActive(true);
+    vector<complex16_t> samples(4*packetSize);
+    vector<complex16_t> burst(2000);
+    EXPECT_EQ(fanout->Push(burst.data(), burst.size(), 5000, IStreamChannel::Metadata::END_BURST), 2000u);
+    Produce(*fanout, 100000);
+    uint64_t timestamp = 0;
+    uint32_t flags = 0;
+    EXPECT_EQ(consumer.Pop(samples.data(), samples.size(), &timestamp, 100, &flags), 2000u);
+    EXPECT_EQ(timestamp, 5000u);
+    EXPECT_TRUE(flags & IStreamChannel::Metadata::END_BURST);
+    EXPECT_EQ(consumer.Pop(samples.data(), samples.size(), &timestamp, 10, &flags), packetSize);
+    EXPECT_EQ(timestamp, 100000u);
+}
@@ -0,0 +1,98 @@
+#include "gtest/gtest.h"
+#include "FilePlayback.h"
+#include <cstdio>
+#include <vector>
+using namespace std;
+using namespace lime;
+
+static void WriteFile(const char* path, const void* data, size_t bytes)
+{
+    FILE* file = fopen(path, "wb");
+    ASSERT_NE(file, nullptr);
+    fwrite(data, 1, bytes, file);
+    fclose(file);
+}
+
+//unpacks single channel 12 bit compressed payload
+static complex16_t Unpack12(const uint8_t* data, int index)
+{
+    const uint8_t* b = &data[3*index];
+    complex16_t value;
+    value.i = int16_t((b[0] | (b[1] << 8)) << 4) >> 4;
+    value.q = int16_t(((b[1] >> 4) | (b[2] << 4)) << 4) >> 4;
+    return value;
+}
+
+TEST(FilePlayback, cs16CopiedToPackets)
+{
+    const int count = samples16InPkt + 100;
+    vector<complex16_t> samples(count);
+    for (int i = 0; i < count; ++i)
+    {
+        samples[i].i = i;
+        samples[i].q = -i;
+    }
+    WriteFile("playback_test.cs16", samples.data(), count*sizeof(complex16_t));
+
+    PlaybackConfig config;
+    config.path = "playback_test.cs16";
+    config.timestamp = 1000;
+    config.useTimestamp = true;
+    FilePlayback playback;
+    ASSERT_EQ(playback.Open(config), 0);
+
+    FPGA_DataPacket packets[4];
+    ASSERT_EQ(playback.FillPackets(packets, 4, false, 1), 2);
+    EXPECT_EQ(packets[0].counter, 1000u);
+    EXPECT_EQ(packets[1].counter, 1000u + samples16InPkt);
+    EXPECT_EQ(packets[0].reserved[0] & 0x10, 0);
+    const complex16_t* payload = (const complex16_t*)packets[1].data;
+    EXPECT_EQ(payload[99].i, count-1);
+    EXPECT_EQ(payload[100].i, 0); //padded with zeros
+    EXPECT_EQ(playback.FillPackets(packets, 4, false, 1), 0);
+    remove("playback_test.cs16");
+}
+
+TEST(FilePlayback, channelsMismatchIsReported)
+{
+    vector<complex16_t> samples(1000);
+    WriteFile("playback_test.cs16", samples.data(), samples.size()*sizeof(complex16_t));
+    PlaybackConfig config;
+    config.path = "playback_test.cs16";
+    FilePlayback playback;
+    ASSERT_EQ(playback.Open(config), 0);
+    FPGA_DataPacket packets[2];
+    EXPECT_EQ(playback.FillPackets(packets, 2, false, 2), -1);
+    //playback stops
+    EXPECT_EQ(playback.FillPackets(packets, 2, false, 1), 0);
+    remove("playback_test.cs16");
+}
+
+TEST(FilePlayback, loopConvertsToCompressedLink)
+{
+    const int count = 1000;
+    vector<complex16_t> samples(count);
+    for (int i = 0; i < count; ++i)
+    {
+        samples[i].i = i*16;
+        samples[i].q = -i*16;
+    }
+    WriteFile("playback_test.cs16", samples.data(), count*sizeof(complex16_t));
+
+    PlaybackConfig config;
+    config.path = "playback_test.cs16";
+    config.loop = true;
+    FilePlayback playback;
+    ASSERT_EQ(playback.Open(config), 0);
+
+    FPGA_DataPacket packets[3];
+    ASSERT_EQ(playback.FillPackets(packets, 3, true, 1), 3);
+    EXPECT_NE(packets[0].reserved[0] & 0x10, 0);
+    for (int i = 0; i < samples12InPkt; ++i)
+    {
+        const complex16_t value = Unpack12(packets[1].data, i);
+        ASSERT_EQ(value.i, (samples12InPkt + i) % count);
+        ASSERT_EQ(value.q, -value.i);
+    }
+    remove("playback_test.cs16");
+}
@@ -0,0 +1,82 @@
+#include "gtest/gtest.h"
+#include "StreamRecorder.h"
+#include "dataTypes.h"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+using namespace std;
+using namespace lime;
+
+//generates counting samples, skips timestamps after given sample
+class FakeRxStream : public IStreamChannel
+{
+public:
+    FakeRxStream(uint64_t total, uint64_t gapAt, uint64_t gapLength) :
+        total(total), gapAt(gapAt), gapLength(gapLength), produced(0), timestamp(0) {};
+    int Start() {return 0;}
+    int Stop() {return 0;}
+    int Read(void* samples, const uint32_t count, Metadata* meta, const int32_t timeout_ms)
+    {
+        if (produced >= total)
+            return 0;
+        uint32_t cnt = count;
+        if (produced < gapAt && produced + cnt > gapAt)
+            cnt = gapAt - produced;
+        if (produced + cnt > total)
+            cnt = total - produced;
+        if (produced == gapAt)
+            timestamp += gapLength;
+        complex16_t* dest = (complex16_t*)samples;
+        for (uint32_t i = 0; i < cnt; ++i)
+        {
+            dest[i].i = (produced + i) & 0x7FFF;
+            dest[i].q = -dest[i].i;
+        }
+        meta->timestamp = timestamp;
+        timestamp += cnt;
+        produced += cnt;
+        return cnt;
+    }
+    int Write(const void*, const uint32_t, const Metadata*, const int32_t) {return 0;}
+    Info GetInfo() {return Info();}
+    uint64_t total, gapAt, gapLength, produced, timestamp;
+};
+
+TEST(StreamRecorder, recordsSamplesAndGaps)
+{
+    const uint64_t total = 100000;
+    FakeRxStream stream(total, 30000, 500);
+    RecorderConfig config;
+    config.path = "recorder_test";
+    config.blockSize = 64*1024;
+    config.blocksCount = 4;
+    config.sampleRate = 1e6;
+    StreamRecorder recorder;
+    ASSERT_EQ(recorder.Start(vector<IStreamChannel*>(1, &stream), config), 0);
+    while (recorder.GetStatus().samples < total)
+        std::this_thread::yield();
+    ASSERT_EQ(recorder.Stop(), 0);
+
+    const StreamRecorder::Status status = recorder.GetStatus();
+    EXPECT_EQ(status.gaps, 1u);
+    EXPECT_EQ(status.droppedSamples, 500u);
+    EXPECT_EQ(status.bytesWritten, total*sizeof(complex16_t));
+
+    ifstream data("recorder_test.sigmf-data", ios::binary);
+    vector<complex16_t> samples(total);
+    data.read((char*)samples.data(), total*sizeof(complex16_t));
+    ASSERT_EQ((uint64_t)data.gcount(), total*sizeof(complex16_t));
+    for (uint64_t i = 0; i < total; ++i)
+        ASSERT_EQ(samples[i].i, int16_t(i & 0x7FFF));
+
+    ifstream metaFile("recorder_test.sigmf-meta");
+    stringstream meta;
+    meta << metaFile.rdbuf();
+    EXPECT_NE(meta.str().find("\"core:datatype\": \"ci16_le\""), string::npos);
+    EXPECT_NE(meta.str().find("\"core:sample_start\": 30000, \"core:global_index\": 30500"), string::npos);
+    remove("recorder_test.sigmf-data");
+    remove("recorder_test.sigmf-meta");
+}
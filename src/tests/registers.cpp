@@ -0,0 +1,435 @@
+#include "gtest/gtest.h"
+#include "LMS7002M.h"
+#include "LMS7002M_RegistersMap.h"
+#include "IConnection.h"
+#include <map>
+#include <vector>
+using namespace std;
+using namespace lime;
+
+//chip imitation keeping registers per channel and counting SPI transactions
+class FakeChip : public IConnection
+{
+public:
+    FakeChip() : writes(0), reads(0) {}
+
+    bool IsOpen(void) override {return true;}
+
+    int WriteLMS7002MSPI(const uint32_t *writeData, size_t size, unsigned) override
+    {
+        ++writes;
+        for (size_t i = 0; i < size; ++i)
+        {
+            const uint16_t address = (writeData[i] >> 16) & 0x7FFF;
+            const uint16_t value = writeData[i] & 0xFFFF;
+            log.push_back(writeData[i]);
+            if (address == 0x0020 || address < 0x0100)
+                regs[0][address] = value;
+            else
+            {
+                if (regs[0][0x0020] & 1) regs[0][address] = value;
+                if (regs[0][0x0020] & 2) regs[1][address] = value;
+            }
+        }
+        return 0;
+    }
+
+    int ReadLMS7002MSPI(const uint32_t *writeData, uint32_t *readData, size_t size, unsigned) override
+    {
+        ++reads;
+        for (size_t i = 0; i < size; ++i)
+        {
+            const uint16_t address = (writeData[i] >> 16) & 0x7FFF;
+            const int space = (address >= 0x0100 && (regs[0][0x0020] & 3) == 2) ? 1 : 0;
+            readData[i] = (uint32_t(address) << 16) | regs[space][address];
+        }
+        return 0;
+    }
+
+    int ProgramMCU(const uint8_t *, const size_t, const MCU_PROG_MODE, ProgrammingCallback) override {return 0;}
+
+    int writes;
+    int reads;
+    vector<uint32_t> log;
+    map<uint16_t, uint16_t> regs[2];
+};
+
+//registers changed by chip itself, written by every apply
+static bool IsChangedByChip(const uint16_t address)
+{
+    static const uint16_t intervals[][2] = {{0x0000, 0x0006}, {0x002F, 0x002F}, {0x008C, 0x008C},
+        {0x00A8, 0x00AC}, {0x0123, 0x0123}, {0x0209, 0x020B}, {0x040E, 0x040F}, {0x05C0, 0x05CC}, {0x0640, 0x0641}};
+    for (const auto &interval : intervals)
+        if (address >= interval[0] && address <= interval[1])
+            return true;
+    return false;
+}
+
+class RegistersFixture : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        chip.regs[0][0x0020] = 0xFFFD;
+        rfic.SetConnection(&chip);
+        chip.writes = chip.reads = 0;
+        chip.log.clear();
+    }
+    FakeChip chip;
+    LMS7002M rfic;
+};
+
+TEST_F(RegistersFixture, WritesAreMergedIntoOneTransaction)
+{
+    {
+        LMS7002M_SPIBatch batch(&rfic);
+        rfic.Modify_SPI_Reg_bits(LMS7param(LML1_MODE), 0);
+        rfic.Modify_SPI_Reg_bits(LMS7param(LML2_MODE), 0);
+        rfic.Modify_SPI_Reg_bits(LMS7param(LML1_FIDM), 1);
+        rfic.Modify_SPI_Reg_bits(LMS7param(PD_RX_AFE1), 0);
+        rfic.Modify_SPI_Reg_bits(LMS7param(PD_TX_AFE1), 0);
+        EXPECT_EQ(chip.writes, 0);
+    }
+    EXPECT_EQ(chip.writes, 1);
+    //one word per register, last value wins
+    ASSERT_EQ(chip.log.size(), 2u);
+    EXPECT_EQ(chip.regs[0][0x0023], rfic.SPI_read(0x0023));
+    EXPECT_EQ(chip.regs[0][0x0082], rfic.SPI_read(0x0082));
+    EXPECT_EQ(rfic.Get_SPI_Reg_bits(LMS7param(LML1_FIDM), true), 1);
+}
+
+TEST_F(RegistersFixture, ChipReadsOncePerRegister)
+{
+    chip.regs[0][0x0023] = 0x5555;
+    {
+        LMS7002M_SPIBatch batch(&rfic);
+        rfic.Modify_SPI_Reg_bits(LMS7param(LML1_MODE), 0, true);
+        rfic.Modify_SPI_Reg_bits(LMS7param(LML2_MODE), 0, true);
+        rfic.Modify_SPI_Reg_bits(LMS7param(LML1_FIDM), 0, true);
+        //value modified in batch is read back from cache
+        EXPECT_EQ(rfic.Get_SPI_Reg_bits(LMS7param(LML1_MODE), true), 0);
+        EXPECT_EQ(chip.reads, 1);
+        //other register needs chip, pending write goes first
+        rfic.Modify_SPI_Reg_bits(LMS7param(PD_RX_AFE1), 0, true);
+        EXPECT_EQ(chip.writes, 1);
+        EXPECT_EQ(chip.reads, 2);
+    }
+    EXPECT_EQ(chip.writes, 2);
+    EXPECT_EQ(chip.regs[0][0x0023], rfic.SPI_read(0x0023));
+}
+
+TEST_F(RegistersFixture, ChannelChangeKeepsOrder)
+{
+    {
+        LMS7002M_SPIBatch batch(&rfic);
+        rfic.Modify_SPI_Reg_bits(LMS7param(MAC), 1);
+        rfic.SPI_write(0x0100, 0x1111);
+        rfic.Modify_SPI_Reg_bits(LMS7param(MAC), 2);
+        rfic.SPI_write(0x0100, 0x2222);
+        rfic.SPI_write(0x0100, 0x3333);
+        rfic.Modify_SPI_Reg_bits(LMS7param(MAC), 1);
+    }
+    EXPECT_EQ(chip.writes, 1);
+    EXPECT_EQ(chip.log.size(), 5u);
+    EXPECT_EQ(chip.regs[0][0x0100], 0x1111);
+    EXPECT_EQ(chip.regs[1][0x0100], 0x3333);
+}
+
+TEST_F(RegistersFixture, SyncedRegistersAreNotReadFromChip)
+{
+    rfic.Modify_SPI_Reg_bits(LMS7param(MAC), 1, true);
+    rfic.Modify_SPI_Reg_bits(LMS7param(LML1_MODE), 1, true);
+    EXPECT_EQ(chip.reads, 2);
+    chip.reads = 0;
+    rfic.Modify_SPI_Reg_bits(LMS7param(LML1_MODE), 0, true);
+    rfic.Modify_SPI_Reg_bits(LMS7param(PD_RX_AFE1), 1);
+    EXPECT_EQ(rfic.Get_SPI_Reg_bits(LMS7param(PD_RX_AFE1), true), 1);
+    EXPECT_EQ(chip.reads, 0);
+
+    //comparators are changed by chip
+    chip.regs[0][0x0123] = 0x3000;
+    EXPECT_EQ(rfic.SPI_read(0x0123, true), 0x3000);
+    EXPECT_EQ(chip.reads, 1);
+
+    //channel B register space was not accessed yet
+    rfic.Modify_SPI_Reg_bits(LMS7param(MAC), 2, true);
+    rfic.SPI_read(0x0100, true);
+    EXPECT_EQ(chip.reads, 2);
+
+    chip.regs[0][0x0023] = 0x1234;
+    rfic.InvalidateRegisterCache();
+    EXPECT_EQ(rfic.SPI_read(0x0023, true), 0x1234);
+}
+
+TEST_F(RegistersFixture, InvalidatedRegisterIsReadFromChip)
+{
+    rfic.SPI_write(0x0082, 0x0001);
+    rfic.SPI_write(0x0023, 0x0001);
+    chip.regs[0][0x0082] = 0x0003;
+    chip.reads = 0;
+    rfic.InvalidateRegisterCache(0x0082);
+    EXPECT_EQ(rfic.SPI_read(0x0082, true), 0x0003);
+    EXPECT_EQ(rfic.SPI_read(0x0023, true), 0x0001);
+    EXPECT_EQ(chip.reads, 1);
+}
+
+TEST_F(RegistersFixture, GainIsReadFromChipWhileAGCRuns)
+{
+    rfic.SetActiveChannel(LMS7002M::ChA);
+    rfic.SPI_write(0x0119, 0x0010);
+    rfic.SetAGCRunning(true);
+    chip.regs[0][0x0119] = 0x0011;
+    chip.reads = 0;
+    EXPECT_EQ(rfic.SPI_read(0x0119, true), 0x0011);
+    chip.regs[0][0x0119] = 0x0012;
+    EXPECT_EQ(rfic.SPI_read(0x0119, true), 0x0012);
+    EXPECT_EQ(chip.reads, 2);
+
+    //gain left by AGC is read once, then cached again
+    rfic.SetAGCRunning(false);
+    EXPECT_EQ(rfic.SPI_read(0x0119, true), 0x0012);
+    EXPECT_EQ(rfic.SPI_read(0x0119, true), 0x0012);
+    EXPECT_EQ(chip.reads, 3);
+}
+
+TEST_F(RegistersFixture, WriteByOtherObjectInvalidatesCache)
+{
+    rfic.SPI_write(0x0082, 0x0001);
+    LMS7002M other;
+    other.SetConnection(&chip);
+    other.SPI_write(0x0082, 0x0002);
+    chip.reads = 0;
+    EXPECT_EQ(rfic.SPI_read(0x0082, true), 0x0002);
+    EXPECT_EQ(chip.reads, 1);
+    EXPECT_EQ(rfic.SPI_read(0x0082, true), 0x0002);
+    EXPECT_EQ(chip.reads, 1);
+}
+
+TEST_F(RegistersFixture, RestoreWritesOnlyChangedRegisters)
+{
+    rfic.SetActiveChannel(LMS7002M::ChA);
+    LMS7002M_RegistersMap* backup = rfic.BackupRegisterMap();
+    EXPECT_EQ(chip.writes, 1);
+    const uint16_t afe = rfic.SPI_read(0x0082);
+    rfic.Modify_SPI_Reg_bits(LMS7param(PD_RX_AFE1), ~afe >> 4 & 1);
+    //same value as in backup
+    rfic.Modify_SPI_Reg_bits(LMS7param(LML1_FIDM), rfic.Get_SPI_Reg_bits(LMS7param(LML1_FIDM)));
+    chip.log.clear();
+    rfic.RestoreRegisterMap(backup);
+    EXPECT_EQ(rfic.SPI_read(0x0082), afe);
+    EXPECT_EQ(chip.regs[0][0x0082], afe);
+    //0x0082 for channel A, MAC selections around each register space
+    size_t data = 0;
+    for (auto word : chip.log)
+        if (((word >> 16) & 0x7FFF) != 0x0020)
+            ++data;
+    EXPECT_EQ(data, 1u);
+}
+
+TEST_F(RegistersFixture, RestoreOfChannelBBackupWritesChannelA)
+{
+    rfic.SetActiveChannel(LMS7002M::ChB);
+    LMS7002M_RegistersMap* backup = rfic.BackupRegisterMap();
+    const uint16_t original = rfic.SPI_read(0x0100);
+    rfic.SetActiveChannel(LMS7002M::ChA);
+    rfic.SPI_write(0x0100, original ^ 0x0001);
+    chip.regs[1][0x0100] = original;
+    rfic.RestoreRegisterMap(backup);
+    //channel A register is restored in channel A, channel B is left alone
+    EXPECT_EQ(chip.regs[0][0x0100], original);
+    EXPECT_EQ(chip.regs[1][0x0100], original);
+    EXPECT_EQ(rfic.GetActiveChannel(true), LMS7002M::ChA);
+}
+
+TEST_F(RegistersFixture, FieldsOfOneRegisterAreModifiedTogether)
+{
+    static_assert(LMS7Field<LMS7param(LML2_S1S)>::mask == 0x0C00, "LML2_S1S mask");
+    static_assert(LMS7Fields<LMS7param(LML2_S0S), LMS7param(LML2_S3S)>::mask == 0xC300, "combined mask");
+    chip.regs[0][0x0027] = 0x00FF;
+    rfic.Modify_SPI_Reg_bits<LMS7param(LML2_S0S), LMS7param(LML2_S1S),
+        LMS7param(LML2_S2S), LMS7param(LML2_S3S)>({1, 0, 3, 2}, true);
+    EXPECT_EQ(chip.reads, 1);
+    EXPECT_EQ(chip.writes, 1);
+    EXPECT_EQ(chip.regs[0][0x0027], 0x00FF | 2 << 14 | 3 << 12 | 1 << 8);
+    EXPECT_EQ(rfic.Get_SPI_Reg_bits<LMS7param(LML2_S2S)>(), 3);
+    EXPECT_EQ(rfic.Get_SPI_Reg_bits<LMS7param(LML2_S2S)>(), rfic.Get_SPI_Reg_bits(LMS7param(LML2_S2S)));
+}
+
+TEST_F(RegistersFixture, HopWritesChangedSXRegistersAtOnce)
+{
+    LMS7002M::SX_HopTable table;
+    table.tx = true;
+    table.referenceClock = rfic.GetReferenceClk_SX(true);
+    //EN_DIV2_DIVPROG, FRAC[15:0], INT|FRAC[19:16], DIV_LOCH, CSW|SEL_VCO
+    table.entries.push_back({1800e6, {0x0400, 0x1234, 100 << 4 | 0x5, 2 << 6, 120 << 3 | 2 << 1}});
+    table.entries.push_back({1810e6, {0x0400, 0x4321, 100 << 4 | 0x5, 2 << 6, 130 << 3 | 2 << 1}});
+    chip.regs[1][0x011F] = 0x0007;
+
+    ASSERT_EQ(rfic.HopSX(table, 0), 0);
+    EXPECT_EQ(chip.regs[1][0x011D], 0x1234);
+    //fields not set by SX tuning are kept
+    EXPECT_EQ(chip.regs[1][0x011F], 0x0087);
+    EXPECT_EQ(chip.regs[0][0x0020] & 3, 1);
+
+    chip.writes = chip.reads = 0;
+    chip.log.clear();
+    ASSERT_EQ(rfic.HopSX(table, 1), 0);
+    EXPECT_EQ(chip.reads, 0);
+    EXPECT_EQ(chip.writes, 1);
+    //SXT selection, two changed registers, channel restore
+    ASSERT_EQ(chip.log.size(), 4u);
+    EXPECT_EQ(chip.regs[1][0x011D], 0x4321);
+    EXPECT_EQ(chip.regs[1][0x0121], 130 << 3 | 2 << 1);
+    EXPECT_EQ(chip.regs[0][0x0020] & 3, 1);
+
+    EXPECT_NE(rfic.HopSX(table, 2), 0);
+}
+
+//VCO comparators showing lock for CSW in [lockLow, lockHigh]
+class FakeVCOChip : public FakeChip
+{
+public:
+    FakeVCOChip() : lockLow(100), lockHigh(110), comparatorReads(0) {}
+
+    int ReadLMS7002MSPI(const uint32_t *writeData, uint32_t *readData, size_t size, unsigned index) override
+    {
+        FakeChip::ReadLMS7002MSPI(writeData, readData, size, index);
+        const int space = (regs[0][0x0020] & 3) == 2 ? 1 : 0;
+        const int csw = LMS7Field<LMS7param(CSW_VCO)>::Decode(regs[space][0x0121]);
+        for (size_t i = 0; i < size; ++i)
+            if (((writeData[i] >> 16) & 0x7FFF) == 0x0123)
+            {
+                ++comparatorReads;
+                const uint16_t cmphl = csw < lockLow ? 0 : (csw > lockHigh ? 3 : 2);
+                readData[i] = (readData[i] & 0xFFFF0000) | cmphl << 12;
+            }
+        return 0;
+    }
+
+    int lockLow;
+    int lockHigh;
+    int comparatorReads;
+};
+
+TEST(TuneVCO, SeedIsVerifiedWithoutSearch)
+{
+    FakeVCOChip chip;
+    chip.regs[0][0x0020] = 0xFFFD;
+    LMS7002M rfic;
+    rfic.SetConnection(&chip);
+
+    ASSERT_EQ(rfic.TuneVCOFromSeed(LMS7002M::VCO_SXR, 105), 0);
+    EXPECT_EQ(chip.comparatorReads, 1);
+    EXPECT_EQ(rfic.Get_SPI_Reg_bits(LMS7param(CSW_VCO)), 105);
+
+    //just below lock range, comparators point up, result is moved off the edge
+    chip.comparatorReads = 0;
+    ASSERT_EQ(rfic.TuneVCOFromSeed(LMS7002M::VCO_SXT, 98), 0);
+    EXPECT_EQ(chip.comparatorReads, 6);
+    rfic.SetActiveChannel(LMS7002M::ChSXT);
+    EXPECT_EQ(rfic.Get_SPI_Reg_bits(LMS7param(CSW_VCO)), 104);
+    rfic.SetActiveChannel(LMS7002M::ChA);
+
+    //above lock range, probing stops at the other edge
+    chip.lockLow = 100;
+    chip.lockHigh = 104;
+    chip.comparatorReads = 0;
+    ASSERT_EQ(rfic.TuneVCOFromSeed(LMS7002M::VCO_SXR, 106), 0);
+    EXPECT_EQ(chip.comparatorReads, 5);
+    EXPECT_EQ(rfic.Get_SPI_Reg_bits(LMS7param(CSW_VCO)), 102);
+    chip.lockHigh = 110;
+
+    chip.comparatorReads = 0;
+    EXPECT_NE(rfic.TuneVCOFromSeed(LMS7002M::VCO_SXR, 60), 0);
+    EXPECT_EQ(chip.comparatorReads, 2);
+
+    //full search needs many more comparator reads
+    chip.comparatorReads = 0;
+    ASSERT_EQ(rfic.TuneVCO(LMS7002M::VCO_SXR), 0);
+    EXPECT_GT(chip.comparatorReads, 10);
+    const int csw = rfic.Get_SPI_Reg_bits(LMS7param(CSW_VCO));
+    EXPECT_GE(csw, chip.lockLow);
+    EXPECT_LE(csw, chip.lockHigh);
+}
+
+TEST_F(RegistersFixture, ApplyWritesOnlyDifferingRegisters)
+{
+    rfic.SetActiveChannel(LMS7002M::ChA);
+    //registers not known to match chip are written by first apply
+    LMS7002M_RegistersMap* profile = rfic.BackupRegisterMap();
+    ASSERT_EQ(rfic.ApplyRegisterMap(*profile), 0);
+    chip.writes = chip.reads = 0;
+    chip.log.clear();
+    ASSERT_EQ(rfic.ApplyRegisterMap(*profile), 0);
+    EXPECT_EQ(chip.reads, 0);
+    size_t data = 0;
+    for (auto word : chip.log)
+        if (((word >> 16) & 0x7FFF) != 0x0020 && not IsChangedByChip((word >> 16) & 0x7FFF))
+            ++data;
+    EXPECT_EQ(data, 0u);
+
+    profile->SetValue(0, 0x0082, rfic.SPI_read(0x0082) ^ 0x0010);
+    profile->SetValue(1, 0x0100, profile->GetValue(1, 0x0100) ^ 0x0001);
+    chip.writes = 0;
+    chip.log.clear();
+    ASSERT_EQ(rfic.ApplyRegisterMap(*profile), 0);
+    EXPECT_EQ(chip.writes, 1);
+    data = 0;
+    for (auto word : chip.log)
+        if (((word >> 16) & 0x7FFF) != 0x0020 && not IsChangedByChip((word >> 16) & 0x7FFF))
+            ++data;
+    EXPECT_EQ(data, 2u);
+    EXPECT_EQ(chip.regs[0][0x0082], profile->GetValue(0, 0x0082));
+    EXPECT_EQ(chip.regs[1][0x0100], profile->GetValue(1, 0x0100));
+    EXPECT_EQ(rfic.GetActiveChannel(false), LMS7002M::ChA);
+
+    //explicit chip snapshot replaces cache in comparison
+    LMS7002M_RegistersMap snapshot(*profile);
+    snapshot.SetValue(0, 0x0023, profile->GetValue(0, 0x0023) ^ 0x0001);
+    chip.log.clear();
+    ASSERT_EQ(rfic.ApplyRegisterMap(*profile, &snapshot), 0);
+    data = 0;
+    for (auto word : chip.log)
+        if (((word >> 16) & 0x7FFF) == 0x0023)
+            ++data;
+    EXPECT_EQ(data, 1u);
+    delete profile;
+}
+
+TEST_F(RegistersFixture, ApplyWritesRegistersChangedByChip)
+{
+    rfic.SetActiveChannel(LMS7002M::ChA);
+    LMS7002M_RegistersMap* profile = rfic.BackupRegisterMap();
+    ASSERT_EQ(rfic.ApplyRegisterMap(*profile), 0);
+    //DC calibration changed register without SPI write
+    chip.regs[0][0x05C0] = profile->GetValue(0, 0x05C0) ^ 0x8000;
+    ASSERT_EQ(rfic.ApplyRegisterMap(*profile), 0);
+    EXPECT_EQ(chip.regs[0][0x05C0], profile->GetValue(0, 0x05C0));
+    //read-only registers are never written
+    for (auto word : chip.log)
+        EXPECT_NE((word >> 16) & 0x7FFF, 0x002F);
+    delete profile;
+}
+
+TEST_F(RegistersFixture, CaptureReadsOnlyUnknownRegisters)
+{
+    chip.regs[0][0x0082] = 0x1234;
+    chip.regs[1][0x0100] = 0x4321;
+    LMS7002M_RegistersMap image;
+    ASSERT_EQ(rfic.CaptureRegisterMap(image), 0);
+    //channel selection and one batch per channel
+    EXPECT_EQ(chip.reads, 3);
+    EXPECT_EQ(image.GetValue(0, 0x0082), 0x1234);
+    EXPECT_EQ(image.GetValue(1, 0x0100), 0x4321);
+
+    //second capture reads only registers changed by chip itself
+    chip.reads = 0;
+    chip.log.clear();
+    ASSERT_EQ(rfic.CaptureRegisterMap(image), 0);
+    EXPECT_LE(chip.reads, 2);
+    chip.writes = 0;
+    ASSERT_EQ(rfic.ApplyRegisterMap(image), 0);
+    for (auto word : chip.log)
+        if (not IsChangedByChip((word >> 16) & 0x7FFF))
+            EXPECT_EQ((word >> 16) & 0x7FFF, 0x0020u);
+}
@@ -0,0 +1,188 @@
+#include "gtest/gtest.h"
+#include "RemoteServer.h"
+#include "ILimeSDRStreaming.h"
+#include "ConnectionRegistry.h"
+#include "dataTypes.h"
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <memory>
+#include <thread>
+#include <vector>
+using namespace std;
+using namespace lime;
+
+//board imitation executing control packets and generating counted RX packets
+class FakeBoard : public ILimeSDRStreaming
+{
+public:
+    FakeBoard() : txPackets(0), txFirstCounter(0)
+    {
+        RxLoopFunction = bind(&FakeBoard::ReceivePacketsLoop, this, std::placeholders::_1);
+        TxLoopFunction = bind(&FakeBoard::TransmitPacketsLoop, this, std::placeholders::_1);
+    }
+    ~FakeBoard()
+    {
+        for (auto s : mStreamers)
+            s->UpdateThreads(true);
+    }
+
+    bool IsOpen(void) override {return true;}
+
+    int TransferPacket(GenericPacket &pkt) override
+    {
+        std::lock_guard<std::mutex> lock(regsLock);
+        auto &regs = (pkt.cmd == CMD_BRDSPI_WR || pkt.cmd == CMD_BRDSPI_RD) ? fpgaRegs : chipRegs;
+        pkt.inBuffer.clear();
+        if (pkt.cmd == CMD_BRDSPI_WR || pkt.cmd == CMD_LMS7002_WR)
+            for (size_t i = 0; i+3 < pkt.outBuffer.size(); i += 4)
+                regs[(pkt.outBuffer[i] << 8) | pkt.outBuffer[i+1]] = (pkt.outBuffer[i+2] << 8) | pkt.outBuffer[i+3];
+        else if (pkt.cmd == CMD_BRDSPI_RD || pkt.cmd == CMD_LMS7002_RD)
+            for (size_t i = 0; i+1 < pkt.outBuffer.size(); i += 2)
+            {
+                const uint16_t value = regs[(pkt.outBuffer[i] << 8) | pkt.outBuffer[i+1]];
+                pkt.inBuffer.push_back(pkt.outBuffer[i]);
+                pkt.inBuffer.push_back(pkt.outBuffer[i+1]);
+                pkt.inBuffer.push_back(value >> 8);
+                pkt.inBuffer.push_back(value & 0xFF);
+            }
+        pkt.status = STATUS_COMPLETED_CMD;
+        return 0;
+    }
+
+    int Write(const unsigned char *, int, int) override {return -1;}
+    int Read(unsigned char *, int, int) override {return -1;}
+    int UpdateExternalDataRate(const size_t, const double, const double) override {return 0;}
+    eConnectionType GetType(void) override {return CONNECTION_UNDEFINED;}
+
+    std::mutex regsLock;
+    std::map<uint16_t, uint16_t> fpgaRegs;
+    std::map<uint16_t, uint16_t> chipRegs;
+    std::atomic<int> txPackets;
+    std::atomic<uint64_t> txFirstCounter;
+
+protected:
+    void ReceivePacketsLoop(Streamer* stream) override
+    {
+        const bool packed = stream->mRxStreams[0]->config.linkFormat == StreamConfig::STREAM_12_BIT_COMPRESSED;
+        const int samplesInPacket = (packed ? samples12InPkt : samples16InPkt)/stream->streamSize;
+        vector<FPGA_DataPacket> packets(16);
+        memset(packets.data(), 0, packets.size()*sizeof(FPGA_DataPacket));
+        uint64_t counter = 0;
+        while (not stream->terminateRx.load())
+        {
+            for (auto &pkt : packets)
+            {
+                pkt.counter = counter;
+                counter += samplesInPacket;
+            }
+            stream->ForwardRxPackets(packets.data(), packets.size());
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    void TransmitPacketsLoop(Streamer* stream) override
+    {
+        const bool packed = stream->mTxStreams[0]->config.linkFormat == StreamConfig::STREAM_12_BIT_COMPRESSED;
+        vector<FPGA_DataPacket> packets(4);
+        while (not stream->terminateTx.load())
+        {
+            const int count = stream->FillTxPackets(packets.data(), packets.size(), packed, 100);
+            if (count > 0 && txPackets.load() == 0)
+                txFirstCounter.store(packets[0].counter);
+            txPackets += count;
+        }
+    }
+};
+
+class RemoteFixture : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        server.reset(new RemoteServer(&board));
+        ASSERT_EQ(server->Start("127.0.0.1", 0), 0);
+        ASSERT_NE(server->GetPort(), 0);
+        const ConnectionHandle handle("module=Remote,addr=127.0.0.1:" + std::to_string(server->GetPort()));
+        conn = ConnectionRegistry::makeConnection(handle);
+        ASSERT_NE(conn, nullptr);
+    }
+
+    void TearDown() override
+    {
+        if (conn)
+            ConnectionRegistry::freeConnection(conn);
+        server.reset();
+    }
+
+    FakeBoard board;
+    std::unique_ptr<RemoteServer> server;
+    IConnection* conn;
+};
+
+TEST_F(RemoteFixture, RegistersAreTunnelled)
+{
+    ASSERT_EQ(conn->WriteRegister(0x0010, 0x1234), 0);
+    uint32_t value = 0;
+    ASSERT_EQ(conn->ReadRegister(0x0010, value), 0);
+    EXPECT_EQ(value, 0x1234u);
+    EXPECT_EQ(board.fpgaRegs[0x0010], 0x1234);
+
+    const uint32_t spiWrite = (1u << 31) | (0x0020u << 16) | 0xABCD;
+    ASSERT_EQ(conn->WriteLMS7002MSPI(&spiWrite, 1), 0);
+    EXPECT_EQ(board.chipRegs[0x0020], 0xABCD);
+}
+
+TEST_F(RemoteFixture, RxStreamKeepsTimestamps)
+{
+    StreamConfig config;
+    config.isTx = false;
+    config.channelID = 0;
+    config.format = StreamConfig::STREAM_12_BIT_COMPRESSED;
+    size_t streamId = 0;
+    ASSERT_EQ(conn->SetupStream(streamId, config), 0);
+    ASSERT_EQ(conn->ControlStream(streamId, true), 0);
+
+    vector<complex16_t> samples(4080);
+    StreamMetadata meta;
+    uint64_t expected = 0;
+    bool first = true;
+    for (int i = 0; i < 20; ++i)
+    {
+        const int count = conn->ReadStream(streamId, samples.data(), samples.size(), 1000, meta);
+        ASSERT_EQ(count, int(samples.size()));
+        if (not first)
+            EXPECT_EQ(meta.timestamp, expected);
+        first = false;
+        expected = meta.timestamp + count;
+    }
+
+    EXPECT_EQ(conn->ControlStream(streamId, false), 0);
+    EXPECT_EQ(conn->CloseStream(streamId), 0);
+}
+
+TEST_F(RemoteFixture, TxStreamReachesBoard)
+{
+    StreamConfig config;
+    config.isTx = true;
+    config.channelID = 0;
+    config.format = StreamConfig::STREAM_12_BIT_COMPRESSED;
+    size_t streamId = 0;
+    ASSERT_EQ(conn->SetupStream(streamId, config), 0);
+    ASSERT_EQ(conn->ControlStream(streamId, true), 0);
+
+    vector<complex16_t> samples(1360*8);
+    StreamMetadata meta;
+    meta.hasTimestamp = true;
+    meta.timestamp = 1000000;
+    ASSERT_EQ(conn->WriteStream(streamId, samples.data(), samples.size(), 1000, meta), int(samples.size()));
+
+    for (int i = 0; i < 100 && board.txPackets.load() < 8; ++i)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_GE(board.txPackets.load(), 8);
+    EXPECT_EQ(board.txFirstCounter.load(), 1000000u);
+
+    EXPECT_EQ(conn->ControlStream(streamId, false), 0);
+    EXPECT_EQ(conn->CloseStream(streamId), 0);
+}
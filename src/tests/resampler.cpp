@@ -0,0 +1,139 @@
+#include "gtest/gtest.h"
+#include "Resampler.h"
+#include <cmath>
+#include <vector>
+using namespace std;
+using namespace lime;
+
+static vector<complex16_t> Tone(size_t count, double frequency, double amplitude)
+{
+    vector<complex16_t> samples(count);
+    for (size_t n = 0; n < count; ++n)
+    {
+        samples[n].i = lround(amplitude*cos(2*M_PI*frequency*n));
+        samples[n].q = lround(amplitude*sin(2*M_PI*frequency*n));
+    }
+    return samples;
+}
+
+static double Amplitude(const vector<complex16_t> &samples, size_t from)
+{
+    double power = 0;
+    for (size_t n = from; n < samples.size(); ++n)
+        power += double(samples[n].i)*samples[n].i + double(samples[n].q)*samples[n].q;
+    return sqrt(power/(samples.size()-from));
+}
+
+//feeds input in uneven chunks, as popped from FIFO
+static vector<complex16_t> ResampleChunks(Resampler &resampler, const vector<complex16_t> &input, uint64_t timestamp)
+{
+    vector<complex16_t> output(input.size()*resampler.GetInterpolation()/resampler.GetDecimation() + 16);
+    size_t produced = 0;
+    size_t consumed = 0;
+    const size_t chunks[] = {100, 1360, 7, 4096};
+    for (int c = 0; consumed < input.size(); ++c)
+    {
+        const size_t count = min(chunks[c%4], input.size()-consumed);
+        uint64_t outTimestamp;
+        produced += resampler.Process(&input[consumed], count, timestamp+consumed, &output[produced], output.size()-produced, &outTimestamp);
+        consumed += count;
+    }
+    output.resize(produced);
+    return output;
+}
+
+TEST(Resampler, PassbandToneKeepsAmplitude)
+{
+    Resampler resampler;
+    ASSERT_EQ(resampler.Configure(3, 4, 16, 0.8f, 1.0f), 0);
+    const double amplitude = 1000;
+    //0.1 of input rate is 0.133 of output rate, inside the passband
+    const vector<complex16_t> output = ResampleChunks(resampler, Tone(40000, 0.1, amplitude), 0);
+    EXPECT_NEAR(output.size(), 30000u, 2u);
+    EXPECT_NEAR(Amplitude(output, 100), amplitude, amplitude*0.02);
+
+    //frequency is scaled by rate change, phase step per sample is 2*pi*0.1*4/3
+    const double expected = 2*M_PI*0.1*4/3;
+    double step = 0;
+    for (size_t n = 1000; n < 1100; ++n)
+    {
+        const double a = atan2(output[n].q, output[n].i);
+        const double b = atan2(output[n+1].q, output[n+1].i);
+        step += remainder(b-a, 2*M_PI);
+    }
+    EXPECT_NEAR(step/100, expected, 0.01);
+}
+
+TEST(Resampler, StopbandToneIsAttenuated)
+{
+    Resampler resampler;
+    ASSERT_EQ(resampler.Configure(1, 4, 16, 0.8f, 1.0f), 0);
+    //0.3 of input rate aliases into decimated output
+    const vector<complex16_t> output = ResampleChunks(resampler, Tone(40000, 0.3, 10000), 0);
+    EXPECT_EQ(output.size(), 10000u);
+    EXPECT_LT(Amplitude(output, 100), 10000*0.03);
+}
+
+TEST(Resampler, InputsRequiredGivesExactOutputCount)
+{
+    const uint32_t ratios[][2] = {{3, 2}, {2, 3}, {1, 5}, {7, 5}};
+    for (auto &ratio : ratios)
+    {
+        Resampler resampler;
+        ASSERT_EQ(resampler.Configure(ratio[0], ratio[1], 8, 0.8f, 1.0f), 0);
+        const vector<complex16_t> input = Tone(120000, 0.01, 1000);
+        vector<complex16_t> output(4096);
+        size_t consumed = 0;
+        const size_t requests[] = {1, 1000, 13, 4096, 2};
+        for (int r = 0; r < 20; ++r)
+        {
+            const size_t wanted = requests[r%5];
+            const size_t needed = resampler.InputsRequired(wanted);
+            ASSERT_LE(consumed+needed, input.size());
+            uint64_t timestamp;
+            EXPECT_EQ(resampler.Process(&input[consumed], needed, consumed, output.data(), wanted, &timestamp), wanted);
+            consumed += needed;
+            EXPECT_EQ(resampler.InputsRequired(0), 0u);
+        }
+    }
+}
+
+TEST(Resampler, TimestampsFollowDeviceClock)
+{
+    Resampler resampler;
+    ASSERT_EQ(resampler.Configure(2, 5, 16, 0.8f, 1.0f), 0);
+    const vector<complex16_t> input = Tone(50000, 0.01, 1000);
+    vector<complex16_t> output(1000);
+    const uint64_t start = 1000000;
+    size_t consumed = 0;
+    uint64_t firstTimestamp = 0;
+    for (int block = 0; block < 10; ++block)
+    {
+        const size_t needed = resampler.InputsRequired(output.size());
+        uint64_t timestamp = 0;
+        ASSERT_EQ(resampler.Process(&input[consumed], needed, start+consumed, output.data(), output.size(), &timestamp), output.size());
+        consumed += needed;
+        if (block == 0)
+            firstTimestamp = timestamp;
+        //1000 output samples are 2500 device samples
+        EXPECT_NEAR(double(timestamp), double(firstTimestamp + block*2500), 1.0);
+    }
+    //first output is delayed by the filter
+    EXPECT_LE(firstTimestamp, start);
+
+    //gap in input timestamps restarts filter at new time
+    const size_t needed = resampler.InputsRequired(output.size());
+    uint64_t timestamp = 0;
+    resampler.Process(&input[consumed], needed, start+consumed+100000, output.data(), output.size(), &timestamp);
+    EXPECT_NEAR(double(timestamp), double(firstTimestamp + 100000 + consumed), 1.0);
+}
+
+TEST(Resampler, LongFilterIsRejected)
+{
+    Resampler resampler;
+    EXPECT_NE(resampler.Configure(160, 147, 16, 0.8f, 1.0f), 0);
+    EXPECT_NE(resampler.Configure(1, 2, 16, 1.0f, 0.8f), 0);
+    EXPECT_EQ(resampler.Configure(320, 640, 16, 0.8f, 1.0f), 0);
+    EXPECT_EQ(resampler.GetInterpolation(), 1u);
+    EXPECT_EQ(resampler.GetDecimation(), 2u);
+}
@@ -0,0 +1,76 @@
+#include "gtest/gtest.h"
+#include "SampleConversion.h"
+#include <vector>
+using namespace std;
+using namespace lime;
+
+TEST(SampleConversion, int8RoundTrip)
+{
+    const int count = 37; //not multiple of vector width
+    vector<complex16_t> src(count);
+    for (int i = 0; i < count; ++i)
+    {
+        src[i].i = (i-18)*113;
+        src[i].q = -(i-18)*113;
+    }
+    vector<int8_t> bytes(2*count);
+    ConvertI16ToI8(src.data(), bytes.data(), count, 4);
+    vector<complex16_t> dest(count);
+    ConvertI8ToI16(bytes.data(), dest.data(), count, 4);
+    for (int i = 0; i < count; ++i)
+    {
+        ASSERT_EQ(bytes[2*i], src[i].i >> 4);
+        ASSERT_EQ(dest[i].i, (src[i].i >> 4) << 4);
+        ASSERT_EQ(dest[i].q, (src[i].q >> 4) << 4);
+    }
+}
+
+TEST(SampleConversion, int8Saturates)
+{
+    complex16_t src[9];
+    for (int i = 0; i < 9; ++i)
+    {
+        src[i].i = 32767;
+        src[i].q = -32768;
+    }
+    int8_t dest[18];
+    ConvertI16ToI8(src, dest, 9, 4);
+    for (int i = 0; i < 9; ++i)
+    {
+        EXPECT_EQ(dest[2*i], 127);
+        EXPECT_EQ(dest[2*i+1], -128);
+    }
+}
+
+TEST(SampleConversion, halfInPlace)
+{
+    const int count = 11;
+    vector<complex16_t> buf(count);
+    for (int i = 0; i < count; ++i)
+    {
+        buf[i].i = i*2000;
+        buf[i].q = -i*2000;
+    }
+    const vector<complex16_t> src(buf);
+    uint16_t* halfs = (uint16_t*)buf.data();
+    ConvertI16ToF16(buf.data(), halfs, count, 1.0f/32767.0f);
+    for (int i = 0; i < count; ++i)
+    {
+        ASSERT_NEAR(HalfToFloat(halfs[2*i]), src[i].i/32767.0f, 1e-3);
+        ASSERT_NEAR(HalfToFloat(halfs[2*i+1]), src[i].q/32767.0f, 1e-3);
+    }
+    vector<complex16_t> dest(count);
+    ConvertF16ToI16(halfs, dest.data(), count, 32767.0f);
+    for (int i = 0; i < count; ++i)
+        ASSERT_NEAR(dest[i].i, src[i].i, 16);
+}
+
+TEST(SampleConversion, halfSpecialValues)
+{
+    EXPECT_EQ(FloatToHalf(1.0f), 0x3C00);
+    EXPECT_EQ(FloatToHalf(-2.0f), 0xC000);
+    EXPECT_EQ(FloatToHalf(65520.0f), 0x7C00); //rounds to infinity
+    EXPECT_EQ(FloatToHalf(5.96046448e-8f), 0x0001); //smallest subnormal
+    EXPECT_EQ(HalfToFloat(0x0001), 5.96046448e-8f);
+    EXPECT_EQ(HalfToFloat(0x7BFF), 65504.0f);
+}
@@ -0,0 +1,118 @@
+#include "gtest/gtest.h"
+#include "SharedStream.h"
+#include <string>
+#include <unistd.h>
+using namespace std;
+using namespace lime;
+
+static string RingName()
+{
+    return "/lime-test-" + to_string(getpid());
+}
+
+static void PublishPacket(SharedStreamPublisher &pub, uint32_t count, uint64_t timestamp)
+{
+    complex16_t* dest = pub.Acquire(count, timestamp);
+    ASSERT_NE(dest, nullptr);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        dest[i].i = int16_t(timestamp + i);
+        dest[i].q = -int16_t(timestamp + i);
+    }
+    pub.Commit(count, 0);
+}
+
+TEST(SharedStream, consumersReadSameSlots)
+{
+    SharedStreamPublisher pub;
+    ASSERT_EQ(pub.Open(RingName(), 8, 2*samples12InPkt, 1e6), 0);
+    SharedStreamConsumer a, b;
+    ASSERT_EQ(a.Attach(RingName()), 0);
+    ASSERT_EQ(b.Attach(RingName()), 0);
+
+    //two packets fill single slot
+    PublishPacket(pub, samples12InPkt, 0);
+    PublishPacket(pub, samples12InPkt, samples12InPkt);
+
+    for (SharedStreamConsumer* c : {&a, &b})
+    {
+        const complex16_t* samples = nullptr;
+        uint64_t timestamp = 1;
+        ASSERT_EQ(c->Acquire(&samples, &timestamp, nullptr, 100), 2*samples12InPkt);
+        EXPECT_EQ(timestamp, 0u);
+        EXPECT_EQ(samples[samples12InPkt+5].i, int16_t(samples12InPkt+5));
+        EXPECT_TRUE(c->Release());
+        EXPECT_EQ(c->Acquire(&samples, &timestamp, nullptr, 10), 0);
+    }
+}
+
+TEST(SharedStream, timestampGapCompletesSlot)
+{
+    SharedStreamPublisher pub;
+    ASSERT_EQ(pub.Open(RingName(), 8, 4*samples12InPkt, 1e6), 0);
+    SharedStreamConsumer c;
+    ASSERT_EQ(c.Attach(RingName()), 0);
+
+    PublishPacket(pub, 100, 0);
+    PublishPacket(pub, 100, 1000);
+    pub.Flush();
+
+    const complex16_t* samples = nullptr;
+    uint64_t timestamp = 0;
+    ASSERT_EQ(c.Acquire(&samples, &timestamp, nullptr, 100), 100);
+    EXPECT_EQ(timestamp, 0u);
+    c.Release();
+    ASSERT_EQ(c.Acquire(&samples, &timestamp, nullptr, 100), 100);
+    EXPECT_EQ(timestamp, 1000u);
+    EXPECT_EQ(samples[0].i, 1000);
+    c.Release();
+}
+
+TEST(SharedStream, slowConsumerSkipsOverwrittenSlots)
+{
+    const uint32_t slots = 4;
+    SharedStreamPublisher pub;
+    ASSERT_EQ(pub.Open(RingName(), slots, samples12InPkt, 1e6), 0);
+    SharedStreamConsumer c;
+    ASSERT_EQ(c.Attach(RingName()), 0);
+
+    const complex16_t* samples = nullptr;
+    uint64_t timestamp = 0;
+    PublishPacket(pub, samples12InPkt, 0);
+    ASSERT_EQ(c.Acquire(&samples, &timestamp, nullptr, 100), samples12InPkt);
+    //publisher laps the consumer while it holds the slot
+    for (int i = 1; i <= 10; ++i)
+        PublishPacket(pub, samples12InPkt, i*samples12InPkt);
+    EXPECT_FALSE(c.Release());
+
+    //oldest valid slot is the one after currently writable
+    ASSERT_EQ(c.Acquire(&samples, &timestamp, nullptr, 100), samples12InPkt);
+    EXPECT_EQ(timestamp, uint64_t(10-slots+2)*samples12InPkt);
+    EXPECT_TRUE(c.Release());
+    EXPECT_EQ(c.GetInfo().overflows, 1u + 10-slots+1);
+}
+
+TEST(SharedStream, closedPublisherEndsWait)
+{
+    SharedStreamPublisher pub;
+    ASSERT_EQ(pub.Open(RingName(), 4, samples12InPkt, 1e6), 0);
+    SharedStreamConsumer c;
+    ASSERT_EQ(c.Attach(RingName()), 0);
+    pub.Close();
+    const complex16_t* samples = nullptr;
+    EXPECT_EQ(c.Acquire(&samples, nullptr, nullptr, 5000), 0);
+    EXPECT_FALSE(c.GetInfo().publisherAlive);
+    EXPECT_NE(c.Attach(RingName()), 0);
+}
+
+TEST(SharedStream, existingRingIsNotTakenOver)
+{
+    SharedStreamPublisher pub, other;
+    ASSERT_EQ(pub.Open(RingName(), 4, samples12InPkt, 1e6), 0);
+    EXPECT_NE(other.Open(RingName(), 4, samples12InPkt, 1e6), 0);
+    SharedStreamConsumer c;
+    ASSERT_EQ(c.Attach(RingName()), 0);
+    EXPECT_TRUE(c.GetInfo().publisherAlive);
+    pub.Close();
+    EXPECT_EQ(other.Open(RingName(), 4, samples12InPkt, 1e6), 0);
+}
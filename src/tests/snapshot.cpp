@@ -0,0 +1,120 @@
+#include "gtest/gtest.h"
+#include "lms7_snapshot.h"
+#include <cstdio>
+#include <vector>
+using namespace std;
+
+static LMS7_Snapshot MakeSnapshot()
+{
+    LMS7_Snapshot snapshot;
+    snapshot.chips.resize(2);
+    for (size_t i = 0; i < snapshot.chips.size(); ++i)
+    {
+        LMS7_Snapshot::Chip &chip = snapshot.chips[i];
+        chip.refClkRx = 30.72e6;
+        chip.refClkTx = 40e6 + i;
+        chip.registers.SetValue(0, 0x0020, 0xFFFD);
+        chip.registers.SetValue(0, 0x0082, 0x800B + i);
+        chip.registers.SetValue(0, 0x011C, 0xAD43);
+        chip.registers.SetValue(1, 0x011C, 0xAD41);
+    }
+    snapshot.rxChannels.push_back({5e6, 0, 30.72e6, 2.4e9});
+    snapshot.rxChannels.push_back({10e6, 1e6, 30.72e6, 2.4e9});
+    snapshot.txChannels.push_back({20e6, -2e6, 15.36e6, 1.8e9});
+    snapshot.fpgaAddresses = LMS7_Snapshot::defaultFPGARegisters;
+    snapshot.fpgaValues = {0x0003, 0x0102};
+    return snapshot;
+}
+
+static void ExpectEqual(const LMS7_Snapshot &a, const LMS7_Snapshot &b)
+{
+    ASSERT_EQ(a.chips.size(), b.chips.size());
+    for (size_t i = 0; i < a.chips.size(); ++i)
+    {
+        EXPECT_EQ(a.chips[i].refClkRx, b.chips[i].refClkRx);
+        EXPECT_EQ(a.chips[i].refClkTx, b.chips[i].refClkTx);
+        for (int space = 0; space < 2; ++space)
+        {
+            const vector<uint16_t> addrs = a.chips[i].registers.GetUsedAddresses(space);
+            EXPECT_EQ(addrs, b.chips[i].registers.GetUsedAddresses(space));
+            for (auto addr : addrs)
+                EXPECT_EQ(a.chips[i].registers.GetValue(space, addr), b.chips[i].registers.GetValue(space, addr));
+        }
+    }
+    ASSERT_EQ(a.rxChannels.size(), b.rxChannels.size());
+    for (size_t i = 0; i < a.rxChannels.size(); ++i)
+    {
+        EXPECT_EQ(a.rxChannels[i].lpfBandwidth, b.rxChannels[i].lpfBandwidth);
+        EXPECT_EQ(a.rxChannels[i].ncoOffset, b.rxChannels[i].ncoOffset);
+        EXPECT_EQ(a.rxChannels[i].frequency, b.rxChannels[i].frequency);
+    }
+    ASSERT_EQ(a.txChannels.size(), b.txChannels.size());
+    EXPECT_EQ(a.txChannels[0].sampleRate, b.txChannels[0].sampleRate);
+    EXPECT_EQ(a.fpgaAddresses, b.fpgaAddresses);
+    EXPECT_EQ(a.fpgaValues, b.fpgaValues);
+}
+
+TEST(Snapshot, SerializationRoundTrip)
+{
+    const LMS7_Snapshot original = MakeSnapshot();
+    vector<uint8_t> data;
+    original.Serialize(data);
+    //only used registers are stored
+    EXPECT_LT(data.size(), 256u);
+
+    LMS7_Snapshot decoded;
+    ASSERT_EQ(decoded.Deserialize(data.data(), data.size()), 0);
+    ExpectEqual(original, decoded);
+}
+
+TEST(Snapshot, DamagedDataIsRejected)
+{
+    const LMS7_Snapshot original = MakeSnapshot();
+    vector<uint8_t> data;
+    original.Serialize(data);
+
+    LMS7_Snapshot decoded = MakeSnapshot();
+    EXPECT_NE(decoded.Deserialize(data.data(), data.size()-1), 0);
+    vector<uint8_t> longer(data);
+    longer.push_back(0);
+    EXPECT_NE(decoded.Deserialize(longer.data(), longer.size()), 0);
+    vector<uint8_t> wrongMagic(data);
+    wrongMagic[0] ^= 0xFF;
+    EXPECT_NE(decoded.Deserialize(wrongMagic.data(), wrongMagic.size()), 0);
+    //failed decoding keeps previous contents
+    ExpectEqual(original, decoded);
+}
+
+TEST(Snapshot, CountBeyondDataIsRejected)
+{
+    const LMS7_Snapshot original = MakeSnapshot();
+    vector<uint8_t> data;
+    original.Serialize(data);
+
+    //chip count follows magic and version
+    LMS7_Snapshot decoded = MakeSnapshot();
+    vector<uint8_t> manyChips(data);
+    manyChips[6] = 0xFF;
+    manyChips[7] = 0xFF;
+    EXPECT_NE(decoded.Deserialize(manyChips.data(), manyChips.size()), 0);
+    //FPGA register count is in the last entries
+    vector<uint8_t> manyRegisters(data.begin(), data.end() - 8*original.fpgaAddresses.size());
+    manyRegisters[manyRegisters.size()-2] = 0xFF;
+    manyRegisters[manyRegisters.size()-1] = 0xFF;
+    EXPECT_NE(decoded.Deserialize(manyRegisters.data(), manyRegisters.size()), 0);
+    vector<uint8_t> header(data.begin(), data.begin()+8);
+    EXPECT_NE(decoded.Deserialize(header.data(), header.size()), 0);
+    ExpectEqual(original, decoded);
+}
+
+TEST(Snapshot, SaveAndLoadFile)
+{
+    const LMS7_Snapshot original = MakeSnapshot();
+    const char* filename = "snapshot_test.bin";
+    ASSERT_EQ(original.Save(filename), 0);
+    LMS7_Snapshot loaded;
+    ASSERT_EQ(loaded.Load(filename), 0);
+    remove(filename);
+    ExpectEqual(original, loaded);
+    EXPECT_NE(loaded.Load("missing_snapshot.bin"), 0);
+}
@@ -0,0 +1,99 @@
+#include "gtest/gtest.h"
+#include "TriggeredCapture.h"
+#include <vector>
+using namespace std;
+using namespace lime;
+
+struct Packet
+{
+    uint32_t count;
+    uint64_t timestamp;
+    bool last;
+    int16_t firstI;
+};
+
+static const uint32_t packetSize = 1360;
+
+//feeds packets with given amplitude, idle packets have small noise-like values
+static void Feed(TriggeredCapture &capture, vector<Packet> &out, uint64_t &timestamp, int16_t amplitude, int packets)
+{
+    for (int p = 0; p < packets; ++p)
+    {
+        complex16_t* dest = capture.Acquire(packetSize, timestamp);
+        for (uint32_t n = 0; n < packetSize; ++n)
+        {
+            dest[n].i = (n & 1) ? amplitude : -amplitude;
+            dest[n].q = 0;
+        }
+        //small marker to identify packet, below trigger level
+        dest[0].i = (timestamp/packetSize) % 16;
+        capture.Commit(packetSize, [&](const complex16_t* samples, uint32_t count, uint64_t ts, bool last)
+        {
+            Packet pkt = {count, ts, last, samples[0].i};
+            out.push_back(pkt);
+        });
+        timestamp += packetSize;
+    }
+}
+
+static TriggerConfig Config(uint32_t pre, uint32_t post)
+{
+    TriggerConfig config;
+    config.level = 100;
+    config.window = 32;
+    config.preTriggerPackets = pre;
+    config.postTriggerPackets = post;
+    return config;
+}
+
+TEST(TriggeredCapture, IdlePacketsAreDropped)
+{
+    TriggeredCapture capture(Config(4, 2), packetSize);
+    vector<Packet> out;
+    uint64_t timestamp = 0;
+    Feed(capture, out, timestamp, 10, 100);
+    EXPECT_TRUE(out.empty());
+    EXPECT_EQ(capture.GetTriggersCount(), 0u);
+}
+
+TEST(TriggeredCapture, SegmentHasHistoryAndExactTimestamps)
+{
+    TriggeredCapture capture(Config(3, 2), packetSize);
+    vector<Packet> out;
+    uint64_t timestamp = 1000*packetSize;
+    Feed(capture, out, timestamp, 10, 20);
+    const uint64_t burstStart = timestamp;
+    Feed(capture, out, timestamp, 1000, 5);
+    Feed(capture, out, timestamp, 10, 20);
+
+    //3 history, 5 burst, packet where level falls, 2 post-trigger
+    ASSERT_EQ(out.size(), 11u);
+    EXPECT_EQ(capture.GetTriggersCount(), 1u);
+    for (size_t k = 0; k < out.size(); ++k)
+    {
+        const uint64_t expected = burstStart + (int64_t(k)-3)*packetSize;
+        EXPECT_EQ(out[k].timestamp, expected);
+        EXPECT_EQ(out[k].firstI, int16_t((expected/packetSize) % 16));
+        EXPECT_EQ(out[k].count, packetSize);
+        EXPECT_EQ(out[k].last, k == out.size()-1);
+    }
+}
+
+TEST(TriggeredCapture, RearmsAfterSegment)
+{
+    TriggeredCapture capture(Config(1, 1), packetSize);
+    vector<Packet> out;
+    uint64_t timestamp = 0;
+    Feed(capture, out, timestamp, 10, 5);
+    Feed(capture, out, timestamp, 1000, 1);
+    Feed(capture, out, timestamp, 10, 5);
+    Feed(capture, out, timestamp, 1000, 2);
+    Feed(capture, out, timestamp, 10, 5);
+    EXPECT_EQ(capture.GetTriggersCount(), 2u);
+    //history packet, burst, packet where level falls and one post-trigger
+    ASSERT_EQ(out.size(), 9u);
+    EXPECT_EQ(out[0].timestamp, 4*packetSize);
+    EXPECT_TRUE(out[3].last);
+    EXPECT_EQ(out[4].timestamp, 10*packetSize);
+    EXPECT_TRUE(out[8].last);
+}